@@ -0,0 +1,90 @@
+/// @file bench-async-io.c
+/// @brief Benchmark reading thousands of small files using synchronous reads compared to the async I/O backends
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/io/pbl-async-io.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @brief Amount of generated files
+#define FILE_AMOUNT 4000
+
+/// @brief Size of every generated file
+#define FILE_SIZE 4096
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+static void Report(const char *name, size_t bytes, double ms) {
+  printf("%-24s %10zu bytes  %9.1f ms (%7.1f MB/s)\n", name, bytes, ms, (double) bytes / 1024 / 1024 / (ms / 1e3));
+}
+
+static void BenchSyncReads(PblIOStream_T **streams, char *buffers) {
+  double start = NowInMs();
+  size_t bytes = 0;
+  for (size_t i = 0; i < FILE_AMOUNT; i++) {
+    bytes += (size_t) pread((int) streams[i]->actual.fd->actual, buffers + i * FILE_SIZE, FILE_SIZE, 0);
+  }
+  Report("sync pread", bytes, NowInMs() - start);
+}
+
+static void CountBytes(PblAsyncIOHandle_T *handle, void *user_data) {
+  if (handle->result > 0) *(size_t *) user_data += (size_t) handle->result;
+}
+
+static void BenchAsyncReads(PblIOStream_T **streams, char *buffers, enum PblAsyncIOBackend backend) {
+  PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.queue_depth = 256, .threads = 8, .backend = backend);
+  if (engine == NULL) {
+    printf("%-24s not supported\n", PblGetAsyncIOBackendName(backend));
+    return;
+  }
+
+  double start = NowInMs();
+  size_t bytes = 0;
+  for (size_t i = 0; i < FILE_AMOUNT; i++) {
+    PblAsyncRead(.engine = engine, .stream = streams[i], .buffer = buffers + i * FILE_SIZE, .len = FILE_SIZE,
+                 .callback = CountBytes, .user_data = &bytes);
+  }
+  PblAsyncIOWait(engine, FILE_AMOUNT);
+  Report(PblGetAsyncIOBackendName(backend), bytes, NowInMs() - start);
+  PblAsyncIODestroyEngine(engine);
+}
+
+int main(void) {
+  char dir[] = "/tmp/pbl-bench-async-io-XXXXXX";
+  if (mkdtemp(dir) == NULL) return 1;
+
+  char content[FILE_SIZE];
+  memset(content, 'x', sizeof(content));
+  PblIOStream_T **streams = PblMalloc(FILE_AMOUNT * sizeof(PblIOStream_T *));
+  char path[256];
+  for (size_t i = 0; i < FILE_AMOUNT; i++) {
+    snprintf(path, sizeof(path), "%s/%zu", dir, i);
+    FILE *file = fopen(path, "w");
+    fwrite(content, 1, sizeof(content), file);
+    fclose(file);
+    streams[i] = PblStreamOpen(.path = PblGetStringT(path));
+  }
+  char *buffers = PblMallocAtomic((size_t) FILE_AMOUNT * FILE_SIZE);
+  memset(buffers, 0, (size_t) FILE_AMOUNT * FILE_SIZE);
+
+  // The files are in the page cache, so this measures the submission overhead rather than the device latency. Drop
+  // the caches (echo 3 > /proc/sys/vm/drop_caches) between runs to measure cold reads
+  BenchSyncReads(streams, buffers);
+  BenchAsyncReads(streams, buffers, PBL_ASYNC_IO_BACKEND_IO_URING);
+  BenchAsyncReads(streams, buffers, PBL_ASYNC_IO_BACKEND_THREAD_POOL);
+
+  for (size_t i = 0; i < FILE_AMOUNT; i++) {
+    PblStreamClose(streams[i]);
+    snprintf(path, sizeof(path), "%s/%zu", dir, i);
+    unlink(path);
+  }
+  rmdir(dir);
+  return 0;
+}
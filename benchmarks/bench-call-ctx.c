@@ -0,0 +1,72 @@
+/// @file bench-call-ctx.c
+/// @brief Benchmark comparing calls of a Pbl function with call ctxs located in the heap and in the stack, where the
+/// callee sometimes raises an exception
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/func/pbl-function.h>
+#include <time.h>
+
+/// @brief Amount of calls per measurement
+#define CALLS 2000000
+
+/// @brief Every n-th call raises an exception
+#define RAISE_EVERY 1000
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(Validate, PblInt_T *value)
+PblInt_T *Validate(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  if (value->actual % RAISE_EVERY == 0) {
+    PblException_T *exception = PblGetExceptionT(PblGetStringT("invalid value"), PblInternCString("ValueError"),
+                                                 PblGetStringT(__FILE__), PblGetUIntT(__LINE__), NULL, NULL, NULL);
+    PBL_RAISE_EXCEPTION(exception, PblInt_T);
+  }
+  return value;
+}
+
+PblInt_T *ValidateHeap(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  PblInt_T *result;
+  PBL_CALL_FUNC_HEAP(Validate, result, X1, this_call_meta->actual.is_threaded, this_call_meta, value);
+  if (unique_id_Validate_CALLCTX->actual.is_failure->actual) { return NULL; }
+  return result;
+}
+
+PblInt_T *ValidateStack(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  PblInt_T *result;
+  PBL_CALL_FUNC_STACK(Validate, result, X1, this_call_meta->actual.is_threaded, this_call_meta, value);
+  if (unique_id_Validate_CALLCTX->actual.is_failure->actual) {
+    // The exception escapes this frame, so the ctx has to outlive it
+    PblPromoteCallCtx(unique_id_Validate_CALLCTX);
+    return NULL;
+  }
+  return result;
+}
+
+static void RunBench(const char *name, PblInt_T *(*func)(PblFunctionCallMetaData_T *, PblInt_T *)) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+  this_call_meta->actual.is_threaded = PblGetBoolT(false);
+  PblInt_T *value = PblGetIntT(0);
+
+  size_t failures = 0;
+  double start = NowInMs();
+  for (int i = 1; i <= CALLS; i++) {
+    value->actual = i;
+    if (func(this_call_meta, value) == NULL) failures++;
+  }
+  double total_ms = NowInMs() - start;
+  printf("%-6s calls: %d  failures: %zu  total: %8.1f ms  per call: %6.1f ns\n", name, CALLS, failures, total_ms,
+         total_ms * 1e6 / CALLS);
+}
+
+int main(void) {
+  RunBench("heap", ValidateHeap);
+  RunBench("stack", ValidateStack);
+  return 0;
+}
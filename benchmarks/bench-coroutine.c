@@ -0,0 +1,55 @@
+/// @file bench-coroutine.c
+/// @brief Benchmark measuring the cost of switching between coroutines and of spawning many suspended coroutines
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/func/pbl-coroutine.h>
+#include <time.h>
+
+/// @brief Amount of yields per measurement
+#define YIELDS 2000000
+
+/// @brief Amount of coroutines that are suspended at the same time
+#define COROUTINES 20000
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, Yielder,, int yields)
+
+PblInt_T *Yielder_Base(int yields) {
+  for (int i = 0; i < yields; i++) PblYield();
+  return NULL;
+}
+
+PblInt_T *Yielder_Overhead(struct Yielder_Args in) { return Yielder_Base(in.yields); }
+
+int main(void) {
+  PblScheduler_T *scheduler = PblSchedulerCreate();
+
+  // Two coroutines yielding to each other, where every yield switches to the scheduler and into the other coroutine
+  PblAsync(scheduler, Yielder, .yields = YIELDS / 2);
+  PblAsync(scheduler, Yielder, .yields = YIELDS / 2);
+  double start = NowInMs();
+  PblSchedulerRun(scheduler);
+  double yield_ms = NowInMs() - start;
+  printf("yield      yields: %d  total: %8.1f ms  per yield: %6.1f ns\n", YIELDS, yield_ms, yield_ms * 1e6 / YIELDS);
+
+  // Many coroutines suspended at the same time, which is the first round mapping the stacks and the second reusing
+  // the pooled ones as far as the pool allows it
+  for (int round = 0; round < 2; round++) {
+    start = NowInMs();
+    for (int i = 0; i < COROUTINES; i++) PblAsync(scheduler, Yielder, .yields = 1);
+    PblSchedulerRun(scheduler);
+    double spawn_ms = NowInMs() - start;
+    printf("spawn %d   coroutines: %d  total: %8.1f ms  per coroutine: %6.1f ns\n", round + 1, COROUTINES, spawn_ms,
+           spawn_ms * 1e6 / COROUTINES);
+  }
+
+  PblSchedulerDestroy(scheduler);
+  return 0;
+}
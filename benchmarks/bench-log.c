@@ -0,0 +1,90 @@
+/// @file bench-log.c
+/// @brief Benchmark measuring the per-call latency of 'PblLogMany' compared to 'fprintf' onto a shared file from
+/// several threads
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/io/pbl-log.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @brief Amount of threads that log concurrently
+#define LOG_THREADS 8
+
+/// @brief Amount of records every thread logs
+#define RECORDS_PER_THREAD 200000
+
+static FILE *BENCH_FILE = NULL;
+static bool BENCH_USE_PBL_LOG = false;
+
+static uint64_t NowInNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static int CompareU64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *) a;
+  uint64_t y = *(const uint64_t *) b;
+  return (x > y) - (x < y);
+}
+
+static void *LogWorker(void *arg) {
+  uint64_t *latencies = arg;
+  int id = (int) latencies[0];
+  for (int i = 0; i < RECORDS_PER_THREAD; i++) {
+    uint64_t start = NowInNs();
+    if (BENCH_USE_PBL_LOG) {
+      PblLogMany("worker ", id, " handled request ", i, " in ", 0.25, " ms");
+    } else {
+      fprintf(BENCH_FILE, "worker %d handled request %d in %g ms\n", id, i, 0.25);
+    }
+    latencies[i] = NowInNs() - start;
+  }
+  return NULL;
+}
+
+static void RunBench(const char *name) {
+  pthread_t threads[LOG_THREADS];
+  uint64_t *latencies = PblMallocAtomic(sizeof(uint64_t) * LOG_THREADS * RECORDS_PER_THREAD);
+
+  uint64_t start = NowInNs();
+  for (int t = 0; t < LOG_THREADS; t++) {
+    latencies[t * RECORDS_PER_THREAD] = (uint64_t) t;
+    pthread_create(&threads[t], NULL, LogWorker, &latencies[t * RECORDS_PER_THREAD]);
+  }
+  for (int t = 0; t < LOG_THREADS; t++) pthread_join(threads[t], NULL);
+  double total_ms = (double) (NowInNs() - start) / 1e6;
+
+  size_t amount = (size_t) LOG_THREADS * RECORDS_PER_THREAD;
+  qsort(latencies, amount, sizeof(uint64_t), CompareU64);
+  printf("%-10s total: %8.1f ms  p50: %6lu ns  p99: %7lu ns  p99.9: %8lu ns  max: %9lu ns\n", name, total_ms,
+         (unsigned long) latencies[amount / 2], (unsigned long) latencies[amount * 99 / 100],
+         (unsigned long) latencies[amount * 999 / 1000], (unsigned long) latencies[amount - 1]);
+}
+
+int main(void) {
+  char path[] = "/tmp/pbl-bench-log-XXXXXX";
+  close(mkstemp(path));
+
+  BENCH_FILE = fopen(path, "w");
+  BENCH_USE_PBL_LOG = false;
+  RunBench("fprintf");
+  fclose(BENCH_FILE);
+
+  PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path), .mode = PblGetStringT("w"));
+  PblLogStart(.stream = stream, .overflow = PBL_LOG_OVERFLOW_BLOCK);
+  BENCH_USE_PBL_LOG = true;
+  RunBench("PblLog");
+  PblLogStop();
+  PblStreamClose(stream);
+
+  PblLogStats_T stats = PblLogGetStats();
+  printf("PblLog     records: %lu  dropped: %lu  batches: %lu\n", (unsigned long) stats.records_logged,
+         (unsigned long) stats.records_dropped, (unsigned long) stats.batches_written);
+
+  unlink(path);
+  return 0;
+}
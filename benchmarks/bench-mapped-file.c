@@ -0,0 +1,122 @@
+/// @file bench-mapped-file.c
+/// @brief Benchmark counting the lines of a large file through 'PblMappedFile_T' compared to the buffered stream path
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/io/pbl-io.h>
+#include <libpbl/io/pbl-mmap.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @brief Size of the generated file, which is used if no path is passed
+#define GENERATED_FILE_SIZE (256 * 1024 * 1024)
+
+/// @brief Size of the chunks and blocks that are read per iteration
+#define READ_BLOCK_SIZE (1024 * 1024)
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+static size_t CountNewlines(const char *data, size_t len) {
+  size_t count = 0;
+  const char *end = data + len;
+  while ((data = memchr(data, '\n', (size_t) (end - data))) != NULL) {
+    count++;
+    data++;
+  }
+  return count;
+}
+
+static void Report(const char *name, size_t lines, size_t bytes, double ms) {
+  printf("%-28s lines: %10zu  %9.1f ms (%7.1f MB/s)\n", name, lines, ms, (double) bytes / 1024 / 1024 / (ms / 1e3));
+}
+
+static void BenchMappedView(PblString_T *path, size_t size) {
+  double start = NowInMs();
+  PblMappedFile_T *file = PblMapFile(.path = path, .advice = PBL_MAP_ADVICE_SEQUENTIAL | PBL_MAP_ADVICE_WILLNEED);
+  PblStringView_T view = PblGetMappedFileView(file);
+  size_t lines = CountNewlines(view.actual.ptr, view.actual.len);
+  PblUnmapFile(file);
+  Report("mapped view", lines, size, NowInMs() - start);
+}
+
+static void BenchMappedChunks(PblString_T *path, size_t size) {
+  double start = NowInMs();
+  PblMappedFile_T *file = PblMapFile(.path = path, .advice = PBL_MAP_ADVICE_SEQUENTIAL, .chunked = true);
+  PblMappedChunkIter_T iter = PblGetMappedChunkIter(file, READ_BLOCK_SIZE, false);
+  PblStringView_T chunk;
+  size_t lines = 0;
+  while (PblMappedChunkIterNext(&iter, &chunk)) lines += CountNewlines(chunk.actual.ptr, chunk.actual.len);
+  PblUnmapFile(file);
+  Report("mapped chunks", lines, size, NowInMs() - start);
+}
+
+static void BenchStreamBlocks(PblString_T *path, size_t size) {
+  double start = NowInMs();
+  PblIOStream_T *stream = PblStreamOpen(.path = path, .buffer_size = READ_BLOCK_SIZE);
+  char *block = malloc(READ_BLOCK_SIZE);
+  size_t lines = 0, amount;
+  while ((amount = PblStreamRead(stream, block, READ_BLOCK_SIZE)) > 0) lines += CountNewlines(block, amount);
+  free(block);
+  PblStreamClose(stream);
+  Report("buffered stream blocks", lines, size, NowInMs() - start);
+}
+
+static void BenchLineIterator(PblString_T *path, size_t size) {
+  double start = NowInMs();
+  PblIOStream_T *stream = PblStreamOpen(.path = path);
+  PblLineIterator_T iter = PblGetLineIterator(stream, PBL_LINE_ITERATOR_DEFAULT_BLOCK_SIZE);
+  PblStringView_T line;
+  size_t lines = 0;
+  while (PblLineIteratorNext(&iter, &line)) lines++;
+  PblStreamClose(stream);
+  Report("buffered line iterator", lines, size, NowInMs() - start);
+}
+
+int main(int argc, char **argv) {
+  char generated_path[] = "/tmp/pbl-bench-mapped-file-XXXXXX";
+  const char *path = argc > 1 ? argv[1] : generated_path;
+
+  if (argc <= 1) {
+    int fd = mkstemp(generated_path);
+    if (fd == -1) {
+      fprintf(stderr, "Failed to create a temporary file\n");
+      return 1;
+    }
+    const char *line = "2026-10-19T10:00:00Z INFO  request handled path=/api/v1/items status=200 duration=12ms\n";
+    size_t line_len = strlen(line);
+    char *block = malloc(READ_BLOCK_SIZE);
+    for (size_t i = 0; i + line_len <= READ_BLOCK_SIZE; i += line_len) memcpy(block + i, line, line_len);
+    size_t block_len = READ_BLOCK_SIZE / line_len * line_len;
+    for (size_t written = 0; written < GENERATED_FILE_SIZE; written += block_len) {
+      if (write(fd, block, block_len) != (ssize_t) block_len) {
+        fprintf(stderr, "Failed to write the temporary file\n");
+        return 1;
+      }
+    }
+    free(block);
+    close(fd);
+  }
+
+  PblString_T *pbl_path = PblGetStringT(path);
+  PblMappedFile_T *file = PblMapFile(.path = pbl_path, .chunked = true);
+  if (file == NULL) {
+    fprintf(stderr, "Failed to open '%s'\n", path);
+    return 1;
+  }
+  size_t size = file->actual.size;
+  PblUnmapFile(file);
+
+  printf("counting lines of %zu MB in %s\n", size / 1024 / 1024, path);
+  BenchMappedView(pbl_path, size);
+  BenchMappedChunks(pbl_path, size);
+  BenchStreamBlocks(pbl_path, size);
+  BenchLineIterator(pbl_path, size);
+
+  if (argc <= 1) unlink(generated_path);
+  return 0;
+}
@@ -0,0 +1,68 @@
+/// @file bench-memoize.c
+/// @brief Benchmark comparing calls of a config-resolution style function with and without memoisation, where the
+/// function is called many times with a handful of distinct inputs
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/func/pbl-memoize.h>
+#include <stdio.h>
+#include <time.h>
+
+/// @brief Amount of calls per measurement
+#define CALLS 2000000
+
+/// @brief Amount of distinct keys the calls are spread across
+#define KEYS 8
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+PBL_CREATE_FUNC_OVERHEAD(PblString_T *, ResolveSetting,, PblString_T *key, PblInt_T *profile)
+
+PblString_T *ResolveSetting_Base(PblString_T *key, PblInt_T *profile) {
+  // Stands in for merging several config layers, which allocates the resolved value
+  PblString_T *resolved = PblGetStringT("");
+  for (int layer = 0; layer <= profile->actual; layer++) {
+    resolved = PblGetStringT(PblGetStringBytes(key));
+    if (PblStringContains(resolved, PblGetStringT("."))) resolved = PblGetStringT(PblGetStringBytes(resolved));
+  }
+  return resolved;
+}
+
+PblString_T *ResolveSetting_Overhead(struct ResolveSetting_Args in) {
+  return ResolveSetting_Base(in.key, in.profile != NULL ? in.profile : PblGetIntT(0));
+}
+
+PBL_MEMOIZE(PblString_T *, ResolveSetting, 256, key, profile)
+
+int main(void) {
+  PblString_T *keys[KEYS];
+  PblInt_T *profiles[KEYS];
+  for (int i = 0; i < KEYS; i++) {
+    char name[32];
+    snprintf(name, sizeof(name), "service.setting.%d", i);
+    keys[i] = PblGetStringT(name);
+    profiles[i] = PblGetIntT(i % 3);
+  }
+
+  double start = NowInMs();
+  for (int i = 0; i < CALLS; i++)
+    ResolveSetting_Overhead((struct ResolveSetting_Args){.key = keys[i % KEYS], .profile = profiles[i % KEYS]});
+  double direct_ms = NowInMs() - start;
+  printf("direct     calls: %d  total: %8.1f ms  per call: %6.1f ns\n", CALLS, direct_ms, direct_ms * 1e6 / CALLS);
+
+  start = NowInMs();
+  for (int i = 0; i < CALLS; i++) PblMemoized(ResolveSetting, .key = keys[i % KEYS], .profile = profiles[i % KEYS]);
+  double memo_ms = NowInMs() - start;
+  printf("memoized   calls: %d  total: %8.1f ms  per call: %6.1f ns\n", CALLS, memo_ms, memo_ms * 1e6 / CALLS);
+
+  PblMemoStats_T stats;
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(ResolveSetting), &stats);
+  printf("hits: %llu  misses: %llu  evictions: %llu  size: %llu\n", (unsigned long long) stats.hits,
+         (unsigned long long) stats.misses, (unsigned long long) stats.evictions, (unsigned long long) stats.size);
+  return 0;
+}
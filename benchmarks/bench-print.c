@@ -0,0 +1,107 @@
+/// @file bench-print.c
+/// @brief Benchmark printing 100 MB through 'PblPrint' compared to the previous per-char fprintf implementation, and
+/// printing lines made of several parts using 'PblPrintMany' compared to one 'PblPrint' per part
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/io/pbl-io.h>
+#include <time.h>
+
+/// @brief Total amount of bytes that are printed per measurement
+#define PRINT_TOTAL_SIZE (100 * 1024 * 1024)
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+/// @brief The previous implementation of 'PblPrint_Base', which formats every char on its own
+static void PrintPerChar(PblString_T *out, FILE *file, char end) {
+  for (int i = 0; i < out->actual.len->actual; i++) fprintf(file, "%c", (out->actual.str[i].actual));
+  fprintf(file, "%c", end);
+}
+
+static void BenchPrint(PblIOStream_T *stream, const char *line) {
+  PblString_T *out = PblGetStringT(line);
+  PblChar_T *end = PblGetCharT('\n');
+  size_t line_size = strlen(line) + 1;
+  size_t amount = PRINT_TOTAL_SIZE / line_size;
+
+  double start = NowInMs();
+  for (size_t i = 0; i < amount; i++) PblPrint(out, stream, end);
+  fflush(stream->actual.file->actual);
+  double pbl_ms = NowInMs() - start;
+
+  start = NowInMs();
+  for (size_t i = 0; i < amount; i++) PrintPerChar(out, stream->actual.file->actual, '\n');
+  fflush(stream->actual.file->actual);
+  double per_char_ms = NowInMs() - start;
+
+  printf("line size %8zu B x %9zu  pbl: %9.1f ms (%7.1f MB/s)  per-char: %9.1f ms  (x%.1f)\n", line_size, amount, pbl_ms,
+         (double) (amount * line_size) / 1024 / 1024 / (pbl_ms / 1e3), per_char_ms, per_char_ms / pbl_ms);
+}
+
+/// @brief Amount of lines that are printed per measurement of 'BenchPrintMany'
+#define PRINT_MANY_LINES (1000 * 1000)
+
+static void BenchPrintMany(PblIOStream_T *stream, const char *name) {
+  PblString_T *key = PblGetStringT("request");
+  PblString_T *status_key = PblGetStringT("status=");
+  PblString_T *status = PblGetStringT("200");
+  PblString_T *duration_key = PblGetStringT("duration=");
+  PblString_T *duration = PblGetStringT("12.5");
+  PblChar_T *space = PblGetCharT(' ');
+  PblChar_T *end = PblGetCharT('\n');
+
+  double start = NowInMs();
+  for (int i = 0; i < PRINT_MANY_LINES; i++) {
+    PblPrint(key, stream, space);
+    PblPrint(status_key, stream, &(PblChar_T){.meta = {.defined = true}, .actual = '\0'});
+    PblPrint(status, stream, space);
+    PblPrint(duration_key, stream, &(PblChar_T){.meta = {.defined = true}, .actual = '\0'});
+    PblPrint(duration, stream, end);
+  }
+  fflush(stream->actual.file->actual);
+  double per_part_ms = NowInMs() - start;
+
+  start = NowInMs();
+  for (int i = 0; i < PRINT_MANY_LINES; i++)
+    PblPrintMany(stream, key, " status=", 200, " duration=", 12.5, "\n");
+  double many_ms = NowInMs() - start;
+
+  printf("%d lines (%s)  PblPrintMany: %9.1f ms  PblPrint per part (pre-formatted): %9.1f ms  (x%.1f)\n",
+         PRINT_MANY_LINES, name, many_ms, per_part_ms, per_part_ms / many_ms);
+}
+
+int main(int argc, char **argv) {
+  // Printing to /dev/null per default, so the measurement is not limited by a terminal
+  const char *path = argc > 1 ? argv[1] : "/dev/null";
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    fprintf(stderr, "Failed to open '%s'\n", path);
+    return 1;
+  }
+  PblIOStream_T *stream = PblMalloc(sizeof(PblIOStream_T));
+  *stream = PblStream_T_DefDefault;
+  stream->actual.file = PblGetIOFileT(file);
+
+  printf("printing %d MB to %s\n", PRINT_TOTAL_SIZE / 1024 / 1024, path);
+  BenchPrint(stream, "2026-10-19T10:00:00Z INFO  request handled path=/api/v1/items status=200 duration=12ms");
+
+  // A single long line of 64 KiB
+  char *long_line = malloc(64 * 1024);
+  memset(long_line, 'x', 64 * 1024 - 1);
+  long_line[64 * 1024 - 1] = '\0';
+  BenchPrint(stream, long_line);
+  free(long_line);
+
+  BenchPrintMany(stream, "buffered");
+  // Unbuffered streams like stderr issue a system call per write, where the parts are gathered into a single writev
+  setvbuf(file, NULL, _IONBF, 0);
+  BenchPrintMany(stream, "unbuffered");
+
+  fclose(file);
+  return 0;
+}
@@ -0,0 +1,60 @@
+/// @file bench-profile.c
+/// @brief Benchmark measuring the overhead the function-level profiler adds to every call
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#define PBL_STACK_CALL_CTX
+#define PBL_PROFILE_CALLS
+#include <libpbl/func/pbl-profile.h>
+#include <time.h>
+
+/// @brief Amount of calls per measurement
+#define CALLS 5000000
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(Identity, PblInt_T *value)
+PblInt_T *Identity(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) { return value; }
+
+PBL_CREATE_FUNC_DESCRIPTOR(Loop, PblInt_T *value)
+PblInt_T *Loop(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  for (int i = 0; i < CALLS; i++) {
+    PblInt_T *result;
+    PBL_CALL_FUNC(Identity, result, X1, this_call_meta->actual.is_threaded, this_call_meta, value);
+    (void) result;
+  }
+  return value;
+}
+
+int main(void) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+  this_call_meta->actual.is_threaded = PblGetBoolT(false);
+  PblInt_T *value = PblGetIntT(1);
+
+  // The hooks alone, which is the overhead added to every profiled call
+  double start = NowInMs();
+  for (int i = 0; i < CALLS; i++) {
+    PblProfileEnter(&Identity_Descriptor);
+    PblProfileExit(false);
+  }
+  double hooks_ms = NowInMs() - start;
+  printf("hooks           calls: %d  total: %8.1f ms  per call: %6.1f ns\n", CALLS, hooks_ms, hooks_ms * 1e6 / CALLS);
+
+  start = NowInMs();
+  PblInt_T *result;
+  PBL_CALL_FUNC(Loop, result, X1, PblGetBoolT(false), this_call_meta, value);
+  double calls_ms = NowInMs() - start;
+  printf("profiled calls  calls: %d  total: %8.1f ms  per call: %6.1f ns\n", CALLS, calls_ms, calls_ms * 1e6 / CALLS);
+
+  PblProfileStats_T stats;
+  PblProfileGetStats(Identity_Descriptor.id, &stats);
+  printf("recorded        calls: %llu  inclusive: %llu ns\n", (unsigned long long) stats.calls,
+         (unsigned long long) stats.inclusive_ns);
+  return result == NULL;
+}
@@ -0,0 +1,115 @@
+/// @file bench-string-search.c
+/// @brief Benchmark comparing the search functions of 'pbl-string.h' with naive byte-by-byte loops on a multi-MB
+/// log-like haystack
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#include <libpbl/types/pbl-string.h>
+#include <time.h>
+
+/// @brief Size of the generated haystack in bytes
+#define HAYSTACK_SIZE (16 * 1024 * 1024)
+/// @brief Amount of repetitions per measurement
+#define REPETITIONS 10
+
+static double NowInMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e3 + (double) ts.tv_nsec / 1e6;
+}
+
+static size_t NaiveFind(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  for (size_t i = 0; i + needle_len <= haystack_len; i++) {
+    size_t j = 0;
+    while (j < needle_len && haystack[i + j] == needle[j]) j++;
+    if (j == needle_len) return i;
+  }
+  return PBL_STRING_NOT_FOUND;
+}
+
+static size_t NaiveFindAnyOf(const char *haystack, size_t haystack_len, const char *char_set, size_t char_set_len) {
+  for (size_t i = 0; i < haystack_len; i++) {
+    for (size_t j = 0; j < char_set_len; j++)
+      if (haystack[i] == char_set[j]) return i;
+  }
+  return PBL_STRING_NOT_FOUND;
+}
+
+/// @brief Creates a string from the passed bytes without going through 'PblGetStringT', which relies on strlen
+static PblString_T *CreateString(const char *content, size_t len) {
+  PblChar_T *chars = PblMalloc(sizeof(PblChar_T) * (len + 1));
+  for (size_t i = 0; i < len; i++) { PBL_ASSIGN_TO_VAR(chars[i], PblChar_T, content[i]); }
+  return PblCreateStringT(chars, PblGetUIntT(len));
+}
+
+static void BenchFind(PblString_T *haystack, const char *needle) {
+  PblString_T *pbl_needle = PblGetStringT(needle);
+  size_t found = 0;
+
+  double start = NowInMs();
+  for (int i = 0; i < REPETITIONS; i++) found += PblStringFind(haystack, pbl_needle);
+  double pbl_ms = (NowInMs() - start) / REPETITIONS;
+
+  start = NowInMs();
+  for (int i = 0; i < REPETITIONS; i++)
+    found -= NaiveFind(PblGetStringBytes(haystack), haystack->actual.len->actual, needle, strlen(needle));
+  double naive_ms = (NowInMs() - start) / REPETITIONS;
+
+  printf("find      %-72.72s pbl: %8.3f ms  naive: %8.3f ms  (x%.1f)%s\n", needle, pbl_ms, naive_ms,
+         naive_ms / pbl_ms, found != 0 ? " MISMATCH" : "");
+}
+
+static void BenchFindAnyOf(PblString_T *haystack, const char *char_set) {
+  PblString_T *pbl_char_set = PblGetStringT(char_set);
+  size_t found = 0;
+
+  double start = NowInMs();
+  for (int i = 0; i < REPETITIONS; i++) found += PblStringFindAnyOf(haystack, pbl_char_set);
+  double pbl_ms = (NowInMs() - start) / REPETITIONS;
+
+  start = NowInMs();
+  for (int i = 0; i < REPETITIONS; i++)
+    found -= NaiveFindAnyOf(PblGetStringBytes(haystack), haystack->actual.len->actual, char_set, strlen(char_set));
+  double naive_ms = (NowInMs() - start) / REPETITIONS;
+
+  printf("any-of    %-72.72s pbl: %8.3f ms  naive: %8.3f ms  (x%.1f)%s\n", char_set, pbl_ms, naive_ms,
+         naive_ms / pbl_ms, found != 0 ? " MISMATCH" : "");
+}
+
+int main() {
+  // Generating log-like lines, where the searched patterns only occur at the very end
+  const char *lines[] = {
+    "2026-10-19T10:00:00Z INFO  request handled path=/api/v1/items status=200 duration=12ms\n",
+    "2026-10-19T10:00:01Z DEBUG cache lookup key=user:1234 hit=true\n",
+    "2026-10-19T10:00:02Z WARN  slow query table=orders duration=812ms\n",
+  };
+  char *content = malloc(HAYSTACK_SIZE + 256);
+  size_t len = 0;
+  for (size_t i = 0; len < HAYSTACK_SIZE; i++) {
+    size_t line_len = strlen(lines[i % 3]);
+    memcpy(content + len, lines[i % 3], line_len);
+    len += line_len;
+  }
+  const char *tail = "2026-10-19T10:00:03Z ERROR connection reset by peer upstream=10.0.0.7:5432 retries=3 "
+                     "last_error=ECONNRESET\n";
+  memcpy(content + len, tail, strlen(tail));
+  len += strlen(tail);
+
+  PblString_T *haystack = CreateString(content, len);
+  free(content);
+
+  printf("haystack: %zu bytes, %d repetitions\n", len, REPETITIONS);
+  BenchFind(haystack, "ERROR");
+  BenchFind(haystack, "connection reset");
+  BenchFind(haystack, "upstream=10.0.0.7:5432 retries=3");
+  BenchFind(haystack, "ERROR connection reset by peer upstream=10.0.0.7:5432 retries=3 last_error=ECONNRESET");
+  BenchFind(haystack, "not contained at all");
+  BenchFindAnyOf(haystack, "!#");
+  BenchFindAnyOf(haystack, "!#$%&");
+
+  double start = NowInMs();
+  size_t count = PblStringCount(haystack, PblGetStringT("INFO"));
+  printf("count     %-72.72s pbl: %8.3f ms  (%zu occurrences)\n", "INFO", NowInMs() - start, count);
+  return 0;
+}
@@ -0,0 +1,255 @@
+/// @file pbl-coroutine.h
+/// @brief Stackful coroutines, which run async Pbl functions on pooled, guard-paged stacks and are scheduled by a
+/// single-threaded event loop that also drives an async I/O engine
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-function.h"
+#include "../io/pbl-async-io.h"
+#include "../mem/pbl-mem.h"
+#include "../types/pbl-types.h"
+
+#ifndef PBL_MODULES_COROUTINE_H
+#define PBL_MODULES_COROUTINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Scheduler Type ------------------------------------------------------------------------------------------------
+
+/// @brief The size of the stack of a coroutine if no size was passed to the scheduler. Only the pages that are
+/// actually used are backed by memory. Every stack and its guard page take two memory mappings, so the amount of
+/// coroutines that exist at the same time is limited to about half of 'vm.max_map_count' (65530 per default)
+#define PBL_COROUTINE_DEFAULT_STACK_SIZE (64 * 1024)
+
+/// @brief The max. amount of stacks a scheduler keeps for reuse once their coroutines finished, which keeps the pages
+/// that were used by the coroutines. Further stacks are unmapped, which is far slower than reusing them. This is kept
+/// far below 'vm.max_map_count', as every pooled stack takes two mappings and up to 'stack_size' of touched pages
+#define PBL_COROUTINE_STACK_POOL_SIZE 1024
+
+/// @brief The amount of coroutines that are resumed before the I/O engine of the scheduler is polled again, which
+/// keeps coroutines that yield in a loop from starving the I/O
+#define PBL_COROUTINE_IO_POLL_INTERVAL 64
+
+/// @brief The state of a scheduler, which holds its ready queue and stack pool
+struct PblSchedulerState;
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblScheduler_T' in bytes
+#define PblScheduler_T_Size (sizeof(struct PblSchedulerState *) + sizeof(PblAsyncIOEngine_T *) + sizeof(size_t))
+/// @brief Returns the declaration default for the type 'PblScheduler_T'
+#define PblScheduler_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblScheduler_T)
+/// @brief Returns the definition default for the type 'PblScheduler_T', which was not created yet
+#define PblScheduler_T_DefDefault                                                                                      \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblScheduler_T, .state = NULL, .engine = NULL, .stack_size = 0)
+
+/// @brief Base Struct of PblScheduler - avoid using this type
+struct PblScheduler_Base {
+  /// @brief The state of the scheduler - NULL after the scheduler was destroyed
+  struct PblSchedulerState *state;
+  /// @brief The engine, whose operations are awaited by 'PblAwaitRead' and 'PblAwaitWrite' - NULL if there is none
+  PblAsyncIOEngine_T *engine;
+  /// @brief The size of the stack of every coroutine in bytes, excluding the guard page
+  size_t stack_size;
+};
+
+/// @brief Event loop, which runs coroutines on the thread calling 'PblSchedulerRun' or 'PblAwait'
+struct PblScheduler { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblScheduler_Base) };
+/// @brief Event loop, which runs coroutines on the thread calling 'PblSchedulerRun' or 'PblAwait'
+typedef struct PblScheduler PblScheduler_T;
+
+// ---- End of Scheduler Type -----------------------------------------------------------------------------------------
+
+// ---- Coroutine Type ------------------------------------------------------------------------------------------------
+
+/// @brief The state of a coroutine
+enum PblCoroutineState {
+  /// @brief The coroutine is in the ready queue of its scheduler
+  PBL_COROUTINE_READY,
+  /// @brief The coroutine is running
+  PBL_COROUTINE_RUNNING,
+  /// @brief The coroutine waits for another coroutine or an I/O operation
+  PBL_COROUTINE_SUSPENDED,
+  /// @brief The function of the coroutine returned, and its stack was released
+  PBL_COROUTINE_DONE,
+  /// @brief The scheduler was destroyed before the function returned, and its stack was released without unwinding it
+  PBL_COROUTINE_CANCELLED
+};
+
+/// @brief The stack and saved context of a running coroutine
+struct PblCoroutineFrame;
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblCoroutine_T' in bytes
+#define PblCoroutine_T_Size                                                                                            \
+  (sizeof(int) + sizeof(void *) + sizeof(const PblFunctionDescriptor_T *) + sizeof(struct PblSchedulerState *) +       \
+   sizeof(struct PblCoroutineFrame *))
+/// @brief Returns the declaration default for the type 'PblCoroutine_T'
+#define PblCoroutine_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblCoroutine_T)
+/// @brief Returns the definition default for the type 'PblCoroutine_T', which is ready to run
+#define PblCoroutine_T_DefDefault                                                                                      \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblCoroutine_T, .state = PBL_COROUTINE_READY, .result = NULL,         \
+                                                 .descriptor = NULL, .scheduler = NULL, .frame = NULL)
+
+/// @brief Base Struct of PblCoroutine - avoid using this type
+struct PblCoroutine_Base {
+  /// @brief The 'enum PblCoroutineState' of the coroutine
+  int state;
+  /// @brief The return of the function, which is set once the coroutine is done
+  void *result;
+  /// @brief The descriptor of the function the coroutine runs
+  const PblFunctionDescriptor_T *descriptor;
+  /// @brief The state of the scheduler the coroutine belongs to - NULL once the coroutine was cancelled
+  struct PblSchedulerState *scheduler;
+  /// @brief The stack and context of the coroutine - NULL once the coroutine is done or was cancelled
+  struct PblCoroutineFrame *frame;
+};
+
+/// @brief Coroutine running an async Pbl function, which is awaited using 'PblAwait'
+struct PblCoroutine { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblCoroutine_Base) };
+/// @brief Coroutine running an async Pbl function, which is awaited using 'PblAwait'
+typedef struct PblCoroutine PblCoroutine_T;
+
+/// @brief The entry of a coroutine, which is called with the argument passed to 'PblCoroutineSpawn'
+typedef void *(*PblCoroutineEntry_T)(void *arg);
+
+// ---- End of Coroutine Type -----------------------------------------------------------------------------------------
+
+// ---- Async Function Macros -----------------------------------------------------------------------------------------
+
+/// @brief Macro Function to get the standardised identifier for the 'Async' spawner of a PBL function
+/// @note For this identifier to be valid, the macro function 'PBL_CREATE_ASYNC_FUNC_OVERHEAD' has to be used before
+/// @return The identifier in the '<func_identifier>_Async' format
+#define PBL_GET_FUNC_ASYNC_IDENTIFIER(func_identifier) func_identifier##_Async
+
+/// @brief Async variant of 'PBL_CREATE_FUNC_OVERHEAD', which additionally creates the spawner '<identifier>_Async',
+/// which runs the overhead of the function in a new coroutine - see 'PblAsync'
+/// @param ret_signature The return signature the function should have, which has to be a pointer
+/// @param identifier The identifier for the function
+/// @param _attribute_ The attribute for the function (right side)
+/// @param args The arguments for the function, which should also be contained in the type struct itself
+/// @note The function may call 'PblAwait', 'PblYield', 'PblAwaitRead' and 'PblAwaitWrite' to suspend the coroutine
+#define PBL_CREATE_ASYNC_FUNC_OVERHEAD(ret_signature, identifier, _attribute_, args...)                                \
+  PBL_CREATE_FUNC_OVERHEAD(ret_signature, identifier, _attribute_, args)                                               \
+  __attribute__((unused)) static void *identifier##_AsyncEntry(void *in) {                                             \
+    struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) *in_args = (struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) *) in; \
+    return (void *) PBL_GET_FUNC_OVERHEAD_IDENTIFIER(identifier)(*in_args);                                            \
+  }                                                                                                                    \
+  __attribute__((unused)) static PblCoroutine_T *PBL_GET_FUNC_ASYNC_IDENTIFIER(identifier)(                            \
+    PblScheduler_T *scheduler, struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) in) {                                   \
+    struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) *in_copy =                                                         \
+      (struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) *) PblMalloc(sizeof(in));                                       \
+    *in_copy = in;                                                                                                     \
+    return PblCoroutineSpawn(scheduler, &PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(identifier), identifier##_AsyncEntry,      \
+                             in_copy);                                                                                 \
+  }
+
+/// @brief Spawns an async Pbl function as a new coroutine, which runs once the scheduler runs
+/// @param scheduler The scheduler the coroutine should run on.
+/// @param func The function, which has to be created using 'PBL_CREATE_ASYNC_FUNC_OVERHEAD'.
+/// @param args The named arguments to pass to the function, same as for its overhead (e.g. '.value = x').
+/// @return The new coroutine
+#define PblAsync(scheduler, func, args...)                                                                             \
+  PBL_GET_FUNC_ASYNC_IDENTIFIER(func)(scheduler, (struct PBL_GET_FUNC_ARGS_IDENTIFIER(func)){args})
+
+// ---- End of Async Function Macros ----------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblSchedulerCreate'
+PBL_CREATE_FUNC_OVERHEAD(PblScheduler_T *, PblSchedulerCreate,, PblAsyncIOEngine_T *engine, size_t stack_size)
+
+/**
+ * @brief Creates a new scheduler
+ * @param engine The async I/O engine, whose operations are awaited by coroutines. If per default NULL
+ * @param stack_size The size of the stack of every coroutine in bytes, which is rounded up to whole pages. If per
+ * default 'PBL_COROUTINE_DEFAULT_STACK_SIZE'
+ * @return The new scheduler
+ * @note A scheduler and its coroutines may only be used by a single thread
+ */
+#define PblSchedulerCreate(args...)                                                                                    \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblSchedulerCreate)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblSchedulerCreate)){args})
+
+/**
+ * @brief Runs the coroutines of the scheduler until all of them are done, or the remaining ones wait for each other
+ * @param scheduler The scheduler
+ * @note This may not be called inside a coroutine
+ */
+void PblSchedulerRun(PblScheduler_T *scheduler);
+
+/**
+ * @brief Destroys the scheduler and unmaps its stacks. Coroutines that are not done are cancelled, after the I/O
+ * operations they wait for completed
+ * @param scheduler The scheduler, which may not be running
+ * @note The stacks of cancelled coroutines are released without unwinding them, so cleanup code inside them never runs
+ */
+void PblSchedulerDestroy(PblScheduler_T *scheduler);
+
+/**
+ * @brief Spawns a new coroutine - use 'PblAsync' instead of calling this directly
+ * @param scheduler The scheduler the coroutine should run on
+ * @param descriptor The descriptor of the function the coroutine runs
+ * @param entry The entry of the coroutine
+ * @param arg The argument passed to the entry
+ * @return The new coroutine, which is appended to the ready queue of the scheduler
+ */
+PblCoroutine_T *PblCoroutineSpawn(PblScheduler_T *scheduler, const PblFunctionDescriptor_T *descriptor,
+                                  PblCoroutineEntry_T entry, void *arg);
+
+/**
+ * @brief Gets the coroutine running on the current thread
+ * @return The coroutine, or NULL if the current thread does not run a coroutine
+ */
+PblCoroutine_T *PblCoroutineCurrent(void);
+
+/**
+ * @brief Waits until the coroutine is done. Inside a coroutine, this suspends the current coroutine until the awaited
+ * one returned. Outside of a coroutine, this runs the scheduler of the awaited coroutine until it is done
+ * @param coroutine The coroutine to wait for, which has to belong to the scheduler of the current coroutine
+ * @return The return of the function of the coroutine, or NULL if the coroutine can never finish, since all other
+ * coroutines of the scheduler wait as well, or if it was cancelled
+ */
+void *PblAwait(PblCoroutine_T *coroutine);
+
+/**
+ * @brief Suspends the current coroutine and appends it to the end of the ready queue, so other coroutines can run.
+ * Outside of a coroutine, this does nothing
+ */
+void PblYield(void);
+
+/**
+ * @brief Reads from the file descriptor of the stream using the engine of the scheduler, and suspends the current
+ * coroutine until the read completed
+ * @param stream The stream that is read from
+ * @param buffer The buffer the bytes are read into
+ * @param len The max. amount of bytes that should be read
+ * @param offset The offset in the file where the read starts
+ * @return The amount of read bytes, or the negative errno if the read failed
+ * @note This has to be called inside a coroutine, whose scheduler has an engine - see 'PblAsyncRead'
+ */
+int64_t PblAwaitRead(PblIOStream_T *stream, void *buffer, size_t len, int64_t offset);
+
+/**
+ * @brief Writes onto the file descriptor of the stream using the engine of the scheduler, and suspends the current
+ * coroutine until the write completed
+ * @param stream The stream that is written to
+ * @param buffer The bytes that should be written
+ * @param len The amount of bytes that should be written
+ * @param offset The offset in the file where the write starts
+ * @return The amount of written bytes, or the negative errno if the write failed
+ * @note This has to be called inside a coroutine, whose scheduler has an engine - see 'PblAsyncWrite'
+ */
+int64_t PblAwaitWrite(PblIOStream_T *stream, const void *buffer, size_t len, int64_t offset);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_COROUTINE_H
@@ -0,0 +1,230 @@
+/// @file pbl-executor.h
+/// @brief Work-stealing thread pool, which runs Pbl functions in parallel and returns futures for their results
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-function.h"
+#include "../mem/pbl-mem.h"
+#include "../types/pbl-types.h"
+
+#ifndef PBL_MODULES_EXECUTOR_H
+#define PBL_MODULES_EXECUTOR_H
+
+#ifdef __cplusplus
+/// @brief Argument of a spawned function, which converts back to the pointer type of its parameter, as C++ does not
+/// convert 'void *' implicitly
+struct PblSpawnArg {
+  void *value;
+  template<typename T>
+  operator T *() const {
+    return static_cast<T *>(value);
+  }
+};
+/// @brief Converts the spawned argument to the type of the parameter it is passed to
+#define PBL_SPAWN_ARG(value) (PblSpawnArg{value})
+#else
+/// @brief Converts the spawned argument to the type of the parameter it is passed to
+#define PBL_SPAWN_ARG(value) (value)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Executor Type -------------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of arguments of a function that is spawned using 'PblSpawn'
+#define PBL_SPAWN_MAX_ARGS 8
+
+/// @brief The amount of tasks the deque of a worker can hold. Further tasks spawned by the worker are queued in the
+/// shared queue of the executor
+#define PBL_EXECUTOR_DEQUE_SIZE 4096
+
+/// @brief The state of an executor, which is shared with its worker threads
+struct PblExecutorState;
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblExecutor_T' in bytes
+#define PblExecutor_T_Size (sizeof(struct PblExecutorState *) + sizeof(size_t))
+/// @brief Returns the declaration default for the type 'PblExecutor_T'
+#define PblExecutor_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblExecutor_T)
+/// @brief Returns the definition default for the type 'PblExecutor_T', which has no worker threads yet
+#define PblExecutor_T_DefDefault                                                                                       \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblExecutor_T, .state = NULL, .threads = 0)
+
+/// @brief Base Struct of PblExecutor - avoid using this type
+struct PblExecutor_Base {
+  /// @brief The state shared with the worker threads - NULL after the executor was shut down
+  struct PblExecutorState *state;
+  /// @brief The amount of worker threads
+  size_t threads;
+};
+
+/// @brief Thread pool, where every worker owns a Chase-Lev deque of tasks and steals from the others once it is empty
+struct PblExecutor { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblExecutor_Base) };
+/// @brief Thread pool, where every worker owns a Chase-Lev deque of tasks and steals from the others once it is empty
+typedef struct PblExecutor PblExecutor_T;
+
+// ---- End of Executor Type ------------------------------------------------------------------------------------------
+
+// ---- Future Type ---------------------------------------------------------------------------------------------------
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblFuture_T' in bytes
+#define PblFuture_T_Size                                                                                               \
+  (sizeof(int) + sizeof(void *) + sizeof(PblFunctionCallMetaData_T *) + sizeof(struct PblExecutorState *))
+/// @brief Returns the declaration default for the type 'PblFuture_T'
+#define PblFuture_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblFuture_T)
+/// @brief Returns the definition default for the type 'PblFuture_T', which is still pending
+#define PblFuture_T_DefDefault                                                                                         \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblFuture_T, .done = 0, .result = NULL, .ctx = NULL, .state = NULL)
+
+/// @brief Base Struct of PblFuture - avoid using this type
+struct PblFuture_Base {
+  /// @brief Whether the function returned, which is written atomically by the worker - use 'PblFutureIsDone'
+  int done;
+  /// @brief The return of the function, or NULL if it raised an exception
+  void *result;
+  /// @brief The call ctx the function was called with, which is set once the function returned
+  PblFunctionCallMetaData_T *ctx;
+  /// @brief The state of the executor the function was spawned on
+  struct PblExecutorState *state;
+};
+
+/// @brief The result of a function that was spawned on an executor
+struct PblFuture { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblFuture_Base) };
+/// @brief The result of a function that was spawned on an executor
+typedef struct PblFuture PblFuture_T;
+
+/// @brief The arguments of a spawned function, which are stored in the task until a worker calls the function
+typedef struct PblSpawnArgs {
+  /// @brief The amount of passed arguments
+  unsigned int amount;
+  /// @brief The passed arguments
+  void *values[PBL_SPAWN_MAX_ARGS];
+} PblSpawnArgs_T;
+
+/// @brief Typed entry of a spawned Pbl function, which passes the arguments to the parameters of the function - created
+/// using 'PBL_CREATE_SPAWN_FUNC'
+typedef void *(*PblSpawnEntry_T)(PblFunctionCallMetaData_T *ctx, void *const *values);
+
+// ---- End of Future Type --------------------------------------------------------------------------------------------
+
+// ---- Spawn Macros --------------------------------------------------------------------------------------------------
+
+/// @brief Macro Function to get the standardised identifier for the 'SpawnEntry' of a PBL function
+/// @note For this identifier to be valid, the macro function 'PBL_CREATE_SPAWN_FUNC' has to be used before
+/// @return The identifier in the '<func_identifier>_SpawnEntry' format
+#define PBL_GET_FUNC_SPAWN_ENTRY_IDENTIFIER(func_identifier) func_identifier##_SpawnEntry
+
+#define PBL_SPAWN_ENTRY_ARGS_0(values)
+#define PBL_SPAWN_ENTRY_ARGS_1(values) , PBL_SPAWN_ARG(values[0])
+#define PBL_SPAWN_ENTRY_ARGS_2(values) PBL_SPAWN_ENTRY_ARGS_1(values), PBL_SPAWN_ARG(values[1])
+#define PBL_SPAWN_ENTRY_ARGS_3(values) PBL_SPAWN_ENTRY_ARGS_2(values), PBL_SPAWN_ARG(values[2])
+#define PBL_SPAWN_ENTRY_ARGS_4(values) PBL_SPAWN_ENTRY_ARGS_3(values), PBL_SPAWN_ARG(values[3])
+#define PBL_SPAWN_ENTRY_ARGS_5(values) PBL_SPAWN_ENTRY_ARGS_4(values), PBL_SPAWN_ARG(values[4])
+#define PBL_SPAWN_ENTRY_ARGS_6(values) PBL_SPAWN_ENTRY_ARGS_5(values), PBL_SPAWN_ARG(values[5])
+#define PBL_SPAWN_ENTRY_ARGS_7(values) PBL_SPAWN_ENTRY_ARGS_6(values), PBL_SPAWN_ARG(values[6])
+#define PBL_SPAWN_ENTRY_ARGS_8(values) PBL_SPAWN_ENTRY_ARGS_7(values), PBL_SPAWN_ARG(values[7])
+#define PBL_SPAWN_ENTRY_ARGS_EXPAND(amount, values) PBL_SPAWN_ENTRY_ARGS_##amount(values)
+
+/// @brief Passes the first 'amount' spawned arguments to the parameters of the function (with a leading comma)
+#define PBL_SPAWN_ENTRY_ARGS(amount, values) PBL_SPAWN_ENTRY_ARGS_EXPAND(amount, values)
+
+/// @brief Declares a Pbl function that may be spawned using 'PblSpawn', and creates its descriptor and its typed entry
+/// '<identifier>_SpawnEntry', which calls the function with the arguments of the task
+/// @param ret_signature The return type of the function, which has to be a pointer
+/// @param identifier The name of the function
+/// @param args The parameters of the function after 'this_call_meta' (at most 'PBL_SPAWN_MAX_ARGS'), which have to be
+/// pointers, which is the case for all Pbl types
+#define PBL_CREATE_SPAWN_FUNC(ret_signature, identifier, args...)                                                      \
+  ret_signature identifier(PblFunctionCallMetaData_T *this_call_meta IFN(args)(, args));                               \
+  PBL_CREATE_FUNC_DESCRIPTOR(identifier, args)                                                                         \
+  __attribute__((unused)) static void *PBL_GET_FUNC_SPAWN_ENTRY_IDENTIFIER(identifier)(PblFunctionCallMetaData_T *ctx, \
+                                                                                       void *const *values) {          \
+    return (void *) identifier(ctx PBL_SPAWN_ENTRY_ARGS(IFNE(args)(PBL_COUNT_VA_ARGS(args), 0), values));              \
+  }
+
+/// @brief Spawns a Pbl function on the executor, which calls it on one of the worker threads with a threaded call ctx
+/// @param executor The executor the function should run on.
+/// @param func The function, which has to be declared using 'PBL_CREATE_SPAWN_FUNC'.
+/// @param args The arguments to pass to the function (at most 'PBL_SPAWN_MAX_ARGS'), which have to be pointers.
+/// @return The future of the result
+#define PblSpawn(executor, func, args...)                                                                              \
+  PblSpawnTask(executor, &PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(func), PBL_GET_FUNC_SPAWN_ENTRY_IDENTIFIER(func),         \
+               (PblSpawnArgs_T){.amount = IFNE(args)(PBL_COUNT_VA_ARGS(args), 0), .values = {args}})
+
+/// @brief Waits for the future and passes its result to the passed variable. If the spawned function raised an
+/// exception, it is passed on to the caller of the current function just like 'PBL_CALL_FUNC_AND_CATCH'
+/// @param future The future to wait for.
+/// @param var_to_pass The variable the result should be passed to.
+/// @note This requires the existence of 'this_call_meta' of type 'PblMetaFunctionCallCtx_T'
+#define PBL_AWAIT_AND_CATCH(future, var_to_pass)                                                                       \
+  (var_to_pass) = (__typeof__(var_to_pass)) PblFutureAwait(future, this_call_meta);                                   \
+  if (this_call_meta->actual.is_failure->actual) { return NULL; }
+
+// ---- End of Spawn Macros -------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblExecutorCreate'
+PBL_CREATE_FUNC_OVERHEAD(PblExecutor_T *, PblExecutorCreate,, size_t threads)
+
+/**
+ * @brief Creates a new executor and starts its worker threads, which are registered with the garbage collector
+ * @param threads The amount of worker threads. Per default the amount of online processors
+ * @return The new executor
+ */
+#define PblExecutorCreate(args...)                                                                                     \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblExecutorCreate)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblExecutorCreate)){args})
+
+/**
+ * @brief Waits until all spawned functions returned and stops the worker threads
+ * @param executor The executor
+ * @note Functions must not be spawned on the executor afterwards
+ */
+void PblExecutorShutdown(PblExecutor_T *executor);
+
+/**
+ * @brief Spawns a function on the executor - use 'PblSpawn' instead of calling this directly
+ * @param executor The executor the function should run on
+ * @param descriptor The descriptor of the function
+ * @param entry The typed entry of the function, which is called with a new threaded call ctx and the arguments
+ * @param args The passed arguments, whose amount has to match the descriptor
+ * @return The future of the result
+ * @note Functions spawned on a worker thread are pushed onto the deque of the worker, where they are run in LIFO order
+ * unless another worker steals them. Functions spawned on other threads are queued in the shared queue
+ */
+PblFuture_T *PblSpawnTask(PblExecutor_T *executor, const PblFunctionDescriptor_T *descriptor, PblSpawnEntry_T entry,
+                          PblSpawnArgs_T args);
+
+/**
+ * @brief Returns whether the spawned function returned
+ * @param future The future
+ * @return True if the function returned or raised an exception
+ */
+bool PblFutureIsDone(PblFuture_T *future);
+
+/**
+ * @brief Waits until the spawned function returned. The waiting thread runs other tasks of the executor meanwhile, so
+ * functions running on a worker may wait for functions they spawned themselves
+ * @param future The future
+ * @param ctx The call ctx of the waiting function or NULL. If the spawned function raised an exception, the exception
+ * and its 'failure_origin_ctx' are passed on to this ctx, and the call ctx of the spawned function is linked to it as
+ * its 'call_origin_ctx', so the traceback continues into the waiting function
+ * @return The return of the function, or NULL if it raised an exception
+ * @note If the waiting thread is not a worker, it has to be registered with the garbage collector, as it may run tasks
+ */
+void *PblFutureAwait(PblFuture_T *future, PblFunctionCallMetaData_T *ctx);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_EXECUTOR_H
@@ -92,13 +92,182 @@ extern "C" {
 /// @note At max. 127 args are allowed
 /// @note Both the macro for accessing the base and overhead have to be defined yourself!
 /// (This macro is only for headers)
-/// @return The struct definition, and the base and overhead declaration
+/// @return The struct definition, the base and overhead declaration and the descriptor of the function (see
+/// 'PBL_CREATE_FUNC_DESCRIPTOR')
 #define PBL_CREATE_FUNC_OVERHEAD(ret_signature, identifier, _attribute_, args...)                                     \
   struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) {                                                                    \
     PBL_APPLY_MACRO(PBL_CREATE_FUNC_OVERHEAD_CREATE_STRUCT_CHILD, args)                                                \
   };                                                                                                                   \
   ret_signature PBL_GET_FUNC_BASE_IDENTIFIER(identifier)(args) _attribute_;                                            \
-  ret_signature PBL_GET_FUNC_OVERHEAD_IDENTIFIER(identifier)(struct identifier##_Args in) _attribute_;
+  ret_signature PBL_GET_FUNC_OVERHEAD_IDENTIFIER(identifier)(struct identifier##_Args in) _attribute_;                 \
+  PBL_CREATE_FUNC_DESCRIPTOR(identifier, args)
+
+/// @brief Macro Function to get the standardised identifier for the 'Descriptor' of a PBL function
+/// @note For this identifier to be valid, the macro function 'PBL_CREATE_FUNC_DESCRIPTOR' or
+/// 'PBL_CREATE_FUNC_OVERHEAD' has to be used before
+/// @return The identifier in the '<func_identifier>_Descriptor' format
+#define PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(func_identifier) func_identifier##_Descriptor
+
+/// @brief Returns the char at the index of the passed string literal as 'uint64_t', or 0 if the index is out of range
+#define PBL_FUNC_ID_CHAR(str, i)                                                                                       \
+  ((uint64_t) ((i) < sizeof(str) - 1 ? (unsigned char) (str)[(i) < sizeof(str) ? (i) : 0] : 0))
+
+/// @brief Applies a single FNV-1a step using the char at the index of the passed string literal
+#define PBL_FUNC_ID_STEP(hash, str, i) (((hash) ^ PBL_FUNC_ID_CHAR(str, i)) * 0x100000001b3ULL)
+
+/// @brief Applies eight FNV-1a steps starting at the index of the passed string literal
+#define PBL_FUNC_ID_STEP_8(hash, str, i)                                                                               \
+  PBL_FUNC_ID_STEP(                                                                                                    \
+    PBL_FUNC_ID_STEP(                                                                                                  \
+      PBL_FUNC_ID_STEP(                                                                                                \
+        PBL_FUNC_ID_STEP(                                                                                              \
+          PBL_FUNC_ID_STEP(PBL_FUNC_ID_STEP(PBL_FUNC_ID_STEP(PBL_FUNC_ID_STEP(hash, str, i), str, (i) + 1), str,       \
+                                            (i) + 2),                                                                  \
+                           str, (i) + 3),                                                                              \
+          str, (i) + 4),                                                                                               \
+        str, (i) + 5),                                                                                                 \
+      str, (i) + 6),                                                                                                   \
+    str, (i) + 7)
+
+/// @brief The max. amount of chars of a function name that are hashed by 'PBL_FUNC_ID'
+#define PBL_FUNC_ID_MAX_HASHED_CHARS 64
+
+/// @brief Calculates the numeric id of a function on compile time, which is the FNV-1a hash of the first
+/// 'PBL_FUNC_ID_MAX_HASHED_CHARS' chars of the name (padded with null chars) combined with the length of the name
+/// @param str The name of the function as string literal
+/// @note 'PblGetFunctionId' calculates the same id on runtime
+#define PBL_FUNC_ID(str)                                                                                               \
+  (PBL_FUNC_ID_STEP_8(                                                                                                 \
+     PBL_FUNC_ID_STEP_8(                                                                                               \
+       PBL_FUNC_ID_STEP_8(                                                                                             \
+         PBL_FUNC_ID_STEP_8(                                                                                           \
+           PBL_FUNC_ID_STEP_8(PBL_FUNC_ID_STEP_8(PBL_FUNC_ID_STEP_8(PBL_FUNC_ID_STEP_8(0xcbf29ce484222325ULL, str, 0), \
+                                                                    str, 8),                                           \
+                                                 str, 16),                                                             \
+                              str, 24),                                                                                \
+           str, 32),                                                                                                   \
+         str, 40),                                                                                                     \
+       str, 48),                                                                                                       \
+     str, 56)                                                                                                          \
+   ^ (uint64_t) (sizeof(str) - 1))
+
+// Descriptors are weak symbols, so every translation unit declaring a function can define its descriptor, while call
+// sites are able to check whether the called function has a descriptor at all - see 'PBL_CREATE_CALL_SITE_DESCRIPTOR'
+#define PBL_FUNC_DESCRIPTOR_ATTRIBUTES __attribute__((weak, visibility("hidden")))
+#ifdef __cplusplus
+#define PBL_FUNC_DESCRIPTOR_DEFINITION extern const PblFunctionDescriptor_T
+#else
+#define PBL_FUNC_DESCRIPTOR_DEFINITION const PblFunctionDescriptor_T
+#endif
+
+/// @brief Creates the static descriptor of a function, which is referenced by all call ctxs of the function, so the
+/// name and amount of arguments are never re-created on runtime
+/// @param identifier The identifier of the function
+/// @param args The arguments of the function. For Pbl functions, these are the arguments after the call ctx
+/// @note This is done automatically by 'PBL_CREATE_FUNC_OVERHEAD'. Calls of functions without a descriptor use a
+/// descriptor of the call site instead (see 'PBL_CREATE_CALL_SITE_DESCRIPTOR')
+/// @note The descriptor has to be created at file scope. All descriptors of a function are merged by the linker, as
+/// they are weak symbols
+#define PBL_CREATE_FUNC_DESCRIPTOR(identifier, args...)                                                                \
+  PBL_FUNC_DESCRIPTOR_DEFINITION PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(identifier) PBL_FUNC_DESCRIPTOR_ATTRIBUTES = {     \
+    .name = #identifier,                                                                                               \
+    .arg_amount = IFNE(args)(PBL_COUNT_VA_ARGS(args), 0),                                                              \
+    .filename = __FILE__,                                                                                              \
+    .line = __LINE__,                                                                                                  \
+    .id = PBL_FUNC_ID(#identifier),                                                                                    \
+    .is_call_site = false};
+
+/// @brief Gets the descriptor of the called function, or creates a static descriptor of the call site if the function
+/// has none, which has the same id as a descriptor of the function would have
+/// @param func The function that is called
+/// @param args The arguments passed to the function
+/// @return The pointer 'unique_id_<func>_DESCRIPTOR' to the descriptor
+#define PBL_CREATE_CALL_SITE_DESCRIPTOR(func, args)                                                                    \
+  extern const PblFunctionDescriptor_T PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(func) PBL_FUNC_DESCRIPTOR_ATTRIBUTES;        \
+  static const PblFunctionDescriptor_T unique_id_##func##_SITE_DESCRIPTOR = {                                         \
+    .name = #func,                                                                                                     \
+    .arg_amount = IFNE(args)(PBL_COUNT_VA_ARGS(args), 0),                                                              \
+    .filename = __FILE__,                                                                                              \
+    .line = __LINE__,                                                                                                  \
+    .id = PBL_FUNC_ID(#func),                                                                                          \
+    .is_call_site = true};                                                                                             \
+  const PblFunctionDescriptor_T *const unique_id_##func##_DESCRIPTOR =                                                 \
+    &PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(func) != NULL ? &PBL_GET_FUNC_DESCRIPTOR_IDENTIFIER(func)                      \
+                                                      : &unique_id_##func##_SITE_DESCRIPTOR;
+
+// Calls are only recorded if 'PBL_PROFILE_CALLS' is defined before including this header - see 'pbl-profile.h'
+#ifdef PBL_PROFILE_CALLS
+/// @brief Records the start of a call in the profile of the current thread
+/// @param descriptor_ptr The descriptor of the called function.
+#define PBL_PROFILE_ENTER(descriptor_ptr) PblProfileEnter(descriptor_ptr);
+/// @brief Records the end of a call started using 'PBL_PROFILE_ENTER'
+/// @param ctx The call ctx of the finished call, whose failure is counted as an exception of the function.
+#define PBL_PROFILE_EXIT(ctx) PblProfileExit((ctx)->actual.is_failure->actual);
+#else
+#define PBL_PROFILE_ENTER(descriptor_ptr)
+#define PBL_PROFILE_EXIT(ctx)
+#endif
+
+// Calls are only traced if 'PBL_TRACE_CALLS' is defined before including this header - see 'pbl-profile.h'
+#ifdef PBL_TRACE_CALLS
+/// @brief Records a begin event for the call in the trace of the current thread
+/// @param descriptor_ptr The descriptor of the called function.
+/// @param ctx The call ctx of the call.
+#define PBL_TRACE_ENTER(descriptor_ptr, ctx)                                                                           \
+  PblTraceEnter(descriptor_ptr, (ctx)->actual.is_threaded != NULL && (ctx)->actual.is_threaded->actual);
+/// @brief Records an end event for the call started using 'PBL_TRACE_ENTER'
+/// @param ctx The call ctx of the finished call, whose exception is recorded as well.
+#define PBL_TRACE_EXIT(ctx)                                                                                            \
+  PblTraceExit((ctx)->actual.is_failure->actual ? (ctx)->actual.exception : NULL);
+#else
+#define PBL_TRACE_ENTER(descriptor_ptr, ctx)
+#define PBL_TRACE_EXIT(ctx)
+#endif
+
+/// @brief Calls a function, passes the args and creates the appropriate unique identifier for the function call. The
+/// call ctx is allocated in the heap, which means it stays valid after the caller returned.
+/// @param func The function that should be called with the passed variadic arguments.
+/// @param var_to_pass The variable the return of the function should be passed to.
+/// @param unique_id The unique id the call ctx should be declared as. It follows the following scheme: unique##_##func.
+/// @param is_threaded Whether this macro is invoked in a threaded context. This variable is directly passed to the
+/// created context.
+/// @param meta_ctx The meta_ctx that should be used as a parent ctx (invocation context) of the child function
+/// @param args The arguments to pass to the local function
+/// @note The function identifier is interned, meaning it is not re-allocated on every call
+#define PBL_CALL_FUNC_HEAP(func, var_to_pass, unique_id, is_threaded, meta_ctx, args)                                  \
+  PBL_CREATE_CALL_SITE_DESCRIPTOR(func, IFN(args)(args))                                                               \
+  PblFunctionCallMetaData_T *unique_id_##func##_CALLCTX = PblGetMetaFunctionCallCtxT(                                  \
+    PblInternCString(#func), PblGetBoolT(false), PblGetUIntT(IFNE(args)(PBL_COUNT_VA_ARGS(args), 0)), is_threaded,     \
+    NULL, meta_ctx, NULL);                                                                                             \
+  unique_id_##func##_CALLCTX->actual.descriptor = unique_id_##func##_DESCRIPTOR;                                       \
+  PBL_TRACE_ENTER(unique_id_##func##_DESCRIPTOR, unique_id_##func##_CALLCTX)                                           \
+  PBL_PROFILE_ENTER(unique_id_##func##_DESCRIPTOR)                                                                     \
+  (var_to_pass) = func(unique_id_##func##_CALLCTX IFN(args)(, args));                                                  \
+  PBL_PROFILE_EXIT(unique_id_##func##_CALLCTX)                                                                         \
+  PBL_TRACE_EXIT(unique_id_##func##_CALLCTX)
+
+/// @brief Calls a function, passes the args and creates the appropriate unique identifier for the function call. The
+/// call ctx is located in the stack frame of the caller, which means the call does not allocate anything.
+/// @param func The function that should be called with the passed variadic arguments.
+/// @param var_to_pass The variable the return of the function should be passed to.
+/// @param unique_id The unique id the call ctx should be declared as. It follows the following scheme: unique##_##func.
+/// @param is_threaded Whether this macro is invoked in a threaded context. This variable is directly passed to the
+/// created context.
+/// @param meta_ctx The meta_ctx that should be used as a parent ctx (invocation context) of the child function
+/// @param args The arguments to pass to the local function
+/// @note The call ctx is only valid until the caller returns. If it has to outlive the caller (e.g. because an
+/// exception escapes it), 'PblPromoteCallCtx' has to be used, which the exception-handling macros do automatically
+#define PBL_CALL_FUNC_STACK(func, var_to_pass, unique_id, is_threaded, meta_ctx, args)                                 \
+  PBL_CREATE_CALL_SITE_DESCRIPTOR(func, IFN(args)(args))                                                               \
+  PblStackCallCtx_T unique_id_##func##_STACKCTX =                                                                      \
+    PBL_STACK_CALL_CTX_INIT(unique_id_##func##_STACKCTX, unique_id_##func##_DESCRIPTOR,                                \
+                            IFNE(args)(PBL_COUNT_VA_ARGS(args), 0), is_threaded, meta_ctx);                            \
+  PblFunctionCallMetaData_T *unique_id_##func##_CALLCTX = &unique_id_##func##_STACKCTX.ctx;                            \
+  PBL_TRACE_ENTER(unique_id_##func##_DESCRIPTOR, unique_id_##func##_CALLCTX)                                           \
+  PBL_PROFILE_ENTER(unique_id_##func##_DESCRIPTOR)                                                                     \
+  (var_to_pass) = func(unique_id_##func##_CALLCTX IFN(args)(, args));                                                  \
+  PBL_PROFILE_EXIT(unique_id_##func##_CALLCTX)                                                                         \
+  PBL_TRACE_EXIT(unique_id_##func##_CALLCTX)
 
 /// @brief Calls a function, passes the args and creates the appropriate unique identifier for the function call.
 /// @param func The function that should be called with the passed variadic arguments.
@@ -108,19 +277,88 @@ extern "C" {
 /// created context.
 /// @param meta_ctx The meta_ctx that should be used as a parent ctx (invocation context) of the child function
 /// @param args The arguments to pass to the local function
+/// @note If 'PBL_STACK_CALL_CTX' is defined before including this header, the call ctx is located in the stack frame of
+/// the caller (see 'PBL_CALL_FUNC_STACK'), otherwise it is allocated in the heap (see 'PBL_CALL_FUNC_HEAP')
+#ifdef PBL_STACK_CALL_CTX
 #define PBL_CALL_FUNC(func, var_to_pass, unique_id, is_threaded, meta_ctx, args)                                       \
-  PblFunctionCallMetaData_T *unique_id_##func##_CALLCTX = PblGetMetaFunctionCallCtxT(                                  \
-    PblGetStringT(#func), PblGetBoolT(false), PblGetUIntT(IFNE(args)(PBL_COUNT_VA_ARGS(args), 0)), is_threaded, NULL,  \
-    meta_ctx, NULL);                                                                                                   \
-  (var_to_pass) = func(unique_id_##func##_CALLCTX IFN(args)(, args));
+  PBL_CALL_FUNC_STACK(func, var_to_pass, unique_id, is_threaded, meta_ctx, IFN(args)(args))
+#else
+#define PBL_CALL_FUNC(func, var_to_pass, unique_id, is_threaded, meta_ctx, args)                                       \
+  PBL_CALL_FUNC_HEAP(func, var_to_pass, unique_id, is_threaded, meta_ctx, IFN(args)(args))
+#endif
 
 // ---- End of Basic Function Macros ----------------------------------------------------------------------------------
 
+// ---- Exception Classes ---------------------------------------------------------------------------------------------
+
+/// @brief The max. depth of the exception class hierarchy, where the root class 'PblBaseException' has the depth 0
+#define PBL_EXCEPTION_CLASS_MAX_DEPTH 16
+
+/// @brief Exception class, which is identified by a numeric id and may inherit from a parent class. The id, depth and
+/// display are assigned once the class is registered, which happens automatically on its first use
+struct PblExceptionClass {
+  /// @brief The name of the class, which is used as the name of its exceptions
+  const char *name;
+  /// @brief The parent class, or NULL for the root class 'PblBaseException'
+  struct PblExceptionClass *parent;
+  /// @brief The numeric id of the class, which is unique inside the program - 0 if the class is not registered yet
+  unsigned int id;
+  /// @brief The depth of the class inside the hierarchy
+  unsigned int depth;
+  /// @brief The ids of the class and its ancestors indexed by their depth (Cohen's display), which allows for checking
+  /// whether a class inherits from another class in constant time
+  unsigned int display[PBL_EXCEPTION_CLASS_MAX_DEPTH];
+};
+/// @brief Exception class, which is identified by a numeric id and may inherit from a parent class
+typedef struct PblExceptionClass PblExceptionClass_T;
+
+/// @brief Declares an exception class, which was defined using 'PBL_DEFINE_EXCEPTION_CLASS' (e.g. inside a header)
+#define PBL_DECLARE_EXCEPTION_CLASS(identifier) extern PblExceptionClass_T identifier;
+
+/// @brief Defines a new exception class
+/// @param identifier The identifier of the class variable, which is also used as the name of the class
+/// @param parent_class The parent class variable (e.g. 'PblBaseException')
+#define PBL_DEFINE_EXCEPTION_CLASS(identifier, parent_class)                                                           \
+  PblExceptionClass_T identifier = {                                                                                   \
+    .name = #identifier, .parent = &(parent_class), .id = 0, .depth = 0, .display = {0}};
+
+/// @brief The root class, which all exception classes inherit from and which exceptions without a class belong to
+extern PblExceptionClass_T PblBaseException;
+
+/// @brief The class of 'PblOutOfMemoryException'
+PBL_DECLARE_EXCEPTION_CLASS(PblMemoryError)
+
+/// @brief The class of 'PblNullAccessException'
+PBL_DECLARE_EXCEPTION_CLASS(PblNullAccessError)
+
+// ---- End of Exception Classes --------------------------------------------------------------------------------------
+
 // ---- Exception Implementation --------------------------------------------------------------------------------------
 
+/// @brief Static information about the location where an exception is raised using 'PBL_RAISE_LAZY', from which the
+/// properties of the exception are only created once they are accessed
+struct PblRaiseSite {
+  /// @brief The class of the exception, or NULL for 'PblBaseException'
+  PblExceptionClass_T *exc_class;
+  /// @brief The name of the exception, or NULL to use the name of the class
+  const char *name;
+  /// @brief The message of the exception
+  const char *msg;
+  /// @brief The filename where the exception is raised
+  const char *filename;
+  /// @brief The line where the exception is raised
+  unsigned int line;
+  /// @brief The content of the line - macro inserted
+  const char *line_content;
+};
+/// @brief Static information about the location where an exception is raised using 'PBL_RAISE_LAZY'
+typedef struct PblRaiseSite PblRaiseSite_T;
+
 /// @brief (Never use this for malloc - this only indicates the usable memory space)
-/// @returns The usable size in bytes of the PBL Long Double type
-#define PblException_T_Size (4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *))
+/// @returns The usable size in bytes of the PBL Exception type
+#define PblException_T_Size                                                                                            \
+  (4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *) + sizeof(const PblRaiseSite_T *) +             \
+   sizeof(PblExceptionClass_T *))
 /// @brief Returns the declaration default for the type 'PblException_T'
 #define PblException_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblException_T)
 /// @brief Returns the definition default for the type 'PblException_T', where the value/the children have not been set yet
@@ -129,7 +367,7 @@ extern "C" {
 #define PblException_T_DefDefault                                                                                      \
   PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblException_T, .msg = NULL, .name = NULL, .filename = NULL,          \
                                                  .line = NULL, .line_content = NULL, .parent_exc = NULL,               \
-                                                 .child_exc = NULL)
+                                                 .child_exc = NULL, .site = NULL, .exc_class = NULL)
 
 struct PblException_Base {
   /// @brief The message of the exception
@@ -148,6 +386,11 @@ struct PblException_Base {
   /// @brief The child exception if it exists
   /// (Reserved for PblException_T)
   void *child_exc;
+  /// @brief The raise site of a lazily created exception, or NULL if the properties were passed on creation. If set,
+  /// the properties above are NULL until they are accessed using 'PblGetExceptionMsg' and the related functions
+  const PblRaiseSite_T *site;
+  /// @brief The class of the exception, or NULL for 'PblBaseException'
+  PblExceptionClass_T *exc_class;
 };
 
 /// Exception implementation
@@ -155,19 +398,81 @@ struct PblException { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblExceptio
 /// Exception implementation
 typedef struct PblException PblException_T;
 
+/// @brief The max. amount of deallocated exceptions every thread keeps for reuse by the next raised exceptions
+#define PBL_EXCEPTION_POOL_SIZE 64
+
+/// @brief The type of the preallocated exceptions, which are never deallocated or recycled
+extern const PblType_T PBL_PREALLOCATED_EXCEPTION_TYPE;
+
+/// @brief Preallocated exception of the class 'PblMemoryError', which can be raised without allocating - see
+/// 'PBL_RAISE_PREALLOCATED'
+/// @note The exception is shared between all threads and is therefore never modified
+extern PblException_T PblOutOfMemoryException;
+
+/// @brief Preallocated exception of the class 'PblNullAccessError', which can be raised without allocating - see
+/// 'PBL_RAISE_PREALLOCATED'
+/// @note The exception is shared between all threads and is therefore never modified
+extern PblException_T PblNullAccessException;
+
 // ---- End of Exception Implementation -------------------------------------------------------------------------------
 
 // ---- Raise Exception Macro ----------------------------------------------------------------------------------------
 
-/// @brief This a "one-liner" constructor, which will allocate a new exception and raise it (return to the caller of the
-/// stack).
+/// @brief This a "one-liner" constructor, which will raise the passed exception and return NULL to the caller of the
+/// stack.
 /// @param exception The exception that shall be raised.
 /// @param call_return_type The return type of the function where this macro is invoked.
 /// @note This requires the existence of 'this_call_meta' of type 'PblMetaFunctionCallCtx_T'.
 #define PBL_RAISE_EXCEPTION(exception, call_return_type)                                                               \
   PblRaiseNewException(this_call_meta, exception);                                                                     \
-  PBL_DECLARE_VAR(raise_exc_ret, call_return_type)                                                                     \
-  return raise_exc_ret;
+  return NULL;
+
+/// @brief Raises a new exception, whose properties are only created once they are accessed, and returns NULL to the
+/// caller of the stack. Only the static raise site is recorded, which makes raising cheap enough for expected
+/// exceptions, e.g. inside validation loops.
+/// @param exc_name The name of the exception as a string literal.
+/// @param exc_msg The message of the exception as a string literal.
+/// @note This requires the existence of 'this_call_meta' of type 'PblMetaFunctionCallCtx_T'.
+/// @note The properties of the exception have to be accessed using 'PblGetExceptionMsg' and the related functions.
+#define PBL_RAISE_LAZY(exc_name, exc_msg)                                                                              \
+  do {                                                                                                                 \
+    static const PblRaiseSite_T pbl_raise_site = {.exc_class = NULL,                                                   \
+                                                  .name = (exc_name),                                                  \
+                                                  .msg = (exc_msg),                                                    \
+                                                  .filename = __FILE__,                                                \
+                                                  .line = __LINE__,                                                    \
+                                                  .line_content = "PBL_RAISE_LAZY(" #exc_name ", " #exc_msg ")"};      \
+    PblRaiseNewException(this_call_meta, PblGetLazyExceptionT(&pbl_raise_site));                                       \
+    return NULL;                                                                                                       \
+  } while (0)
+
+/// @brief Raises a new exception of the passed class, whose properties are only created once they are accessed, and
+/// returns NULL to the caller of the stack - see 'PBL_RAISE_LAZY'
+/// @param exception_class The exception class variable (e.g. 'PblBaseException'), whose name is used as the name.
+/// @param exc_msg The message of the exception as a string literal.
+/// @note This requires the existence of 'this_call_meta' of type 'PblMetaFunctionCallCtx_T'.
+#define PBL_RAISE_CLASS(exception_class, exc_msg)                                                                      \
+  do {                                                                                                                 \
+    static const PblRaiseSite_T pbl_raise_site = {.exc_class = &(exception_class),                                     \
+                                                  .name = NULL,                                                        \
+                                                  .msg = (exc_msg),                                                    \
+                                                  .filename = __FILE__,                                                \
+                                                  .line = __LINE__,                                                    \
+                                                  .line_content =                                                      \
+                                                    "PBL_RAISE_CLASS(" #exception_class ", " #exc_msg ")"};            \
+    PblRaiseNewException(this_call_meta, PblGetLazyExceptionT(&pbl_raise_site));                                       \
+    return NULL;                                                                                                       \
+  } while (0)
+
+/// @brief Raises one of the preallocated exceptions (e.g. 'PblOutOfMemoryException') without allocating, and returns
+/// NULL to the caller of the stack
+/// @param exception The preallocated exception variable.
+/// @note This requires the existence of 'this_call_meta' of type 'PblMetaFunctionCallCtx_T'.
+#define PBL_RAISE_PREALLOCATED(exception)                                                                              \
+  do {                                                                                                                 \
+    PblRaiseNewException(this_call_meta, &(exception));                                                                \
+    return NULL;                                                                                                       \
+  } while (0)
 
 // ---- End of Raise Exception Macro ----------------------------------------------------------------------------------
 
@@ -181,14 +486,17 @@ typedef struct PblException PblException_T;
 /// @param is_threaded Whether this macro is invoked in a threaded context. This variable is directly passed to the
 /// created context.
 /// @param args the arguments to pass to the function, leave empty if none shall be passed.
+/// @note If the call ctx is located in the stack, it is promoted to the heap when the function failed, so the
+/// traceback stays valid after the caller returned
 #define PBL_BASE_CALL_AND_CATCH_EXCEPTION(func, var_to_pass, unique_id, is_threaded, meta_ctx, args)                   \
   PBL_CALL_FUNC(func, var_to_pass, unique_id, is_threaded, meta_ctx, IFN(args)(args))                                  \
   if (unique_id_##func##_CALLCTX->actual.is_failure->actual) {                                                         \
+    PblFunctionCallMetaData_T *unique_id_##func##_FAILEDCTX = PblPromoteCallCtx(unique_id_##func##_CALLCTX);           \
     (meta_ctx)->actual.is_failure = PblGetBoolT(true);                                                                 \
-    (meta_ctx)->actual.exception = unique_id_##func##_CALLCTX->actual.exception;                                       \
-    (meta_ctx)->actual.failure_origin_ctx = unique_id_##func##_CALLCTX->actual.failure_origin_ctx                      \
-                                              ? unique_id_##func##_CALLCTX->actual.failure_origin_ctx                  \
-                                              : unique_id_##func##_CALLCTX;                                            \
+    (meta_ctx)->actual.exception = unique_id_##func##_FAILEDCTX->actual.exception;                                     \
+    (meta_ctx)->actual.failure_origin_ctx = unique_id_##func##_FAILEDCTX->actual.failure_origin_ctx                    \
+                                              ? unique_id_##func##_FAILEDCTX->actual.failure_origin_ctx                \
+                                              : unique_id_##func##_FAILEDCTX;                                          \
   }
 
 /// @brief This will call the passed function with the args (__VA_ARGS__) and return to the caller of the stack, if the
@@ -220,10 +528,19 @@ typedef struct PblException PblException_T;
   PblException_T block_identifier##_local_catched_exc;                                                                 \
   PblBool_T *block_identifier##_invoke_except = PblGetBoolT(false);                                                    \
   PblBool_T *block_identifier##_except_handled = PblGetBoolT(false);                                                   \
+  PblFunctionCallMetaData_T *block_identifier##_failed_ctx = NULL;                                                     \
   block;                                                                                                               \
   block_identifier##_except_block : { except_block };                                                                 \
   block_identifier##_finish_up : {                                                                                     \
-    if (block_identifier##_invoke_except->actual && !block_identifier##_except_handled->actual) { return NULL; }       \
+    if (block_identifier##_invoke_except->actual && !block_identifier##_except_handled->actual) {                      \
+      /* No except block matched, so the exception is passed on to the caller */                                       \
+      meta_ctx->actual.is_failure = PblGetBoolT(true);                                                                 \
+      meta_ctx->actual.exception = block_identifier##_failed_ctx->actual.exception;                                    \
+      meta_ctx->actual.failure_origin_ctx = block_identifier##_failed_ctx->actual.failure_origin_ctx != NULL           \
+                                              ? block_identifier##_failed_ctx->actual.failure_origin_ctx               \
+                                              : block_identifier##_failed_ctx;                                         \
+      return NULL;                                                                                                     \
+    }                                                                                                                  \
   }
 
 /// @brief This macro calls a function and if an exception was raised, goes directly to the parent except_block
@@ -237,6 +554,8 @@ typedef struct PblException PblException_T;
   PBL_CALL_FUNC(func, var_to_pass, unique_id, this_call_meta->actual.is_threaded, this_call_meta, IFN(args)(args))     \
   if (unique_id_##func##_CALLCTX->actual.is_failure->actual) {                                                         \
     block_identifier##_local_catched_exc = *((PblException_T *) unique_id_##func##_CALLCTX->actual.exception);         \
+    /* The ctx may be located in the stack, but has to outlive it if the exception is not handled */                   \
+    block_identifier##_failed_ctx = PblPromoteCallCtx(unique_id_##func##_CALLCTX);                                     \
     block_identifier##_invoke_except = PblGetBoolT(true);                                                              \
     goto block_identifier##_except_block;                                                                              \
   }
@@ -250,15 +569,53 @@ typedef struct PblException PblException_T;
     goto block_identifier##_finish_up;                                                                                 \
   }
 
+/// @brief Adds an exception clause to the current block, which only handles exceptions of the passed class or one of
+/// its subclasses. Exceptions that are not handled by any clause are passed on to the caller
+/// @param exc_class The exception class variable (e.g. 'PblBaseException')
+/// @param block_to_execute The block, which is executed if the exception matches
+/// @param block_identifier The identifier of the parent try-except block
+/// @note Clauses are checked in order, so clauses of subclasses should be placed before the ones of their parents
+#define PBL_EXCEPT_CLASS_BLOCK(exc_class, block_to_execute, block_identifier)                                          \
+  if (block_identifier##_invoke_except->actual && !block_identifier##_except_handled->actual &&                        \
+      PblIsExceptionInstance(&block_identifier##_local_catched_exc, &(exc_class))) {                                   \
+    block_to_execute;                                                                                                  \
+    block_identifier##_except_handled = PblGetBoolT(true);                                                             \
+    goto block_identifier##_finish_up;                                                                                 \
+  }
+
 // ---- End of Exception Catching (try-except) ------------------------------------------------------------------------
 
+// ---- Function Descriptor -------------------------------------------------------------------------------------------
+
+/// @brief Static description of a function, which is shared by all calls and never allocated - see
+/// 'PBL_CREATE_FUNC_DESCRIPTOR'
+struct PblFunctionDescriptor {
+  /// @brief The function name - identifier
+  const char *name;
+  /// @brief The amount of arguments the function takes, or the amount passed at the call site
+  unsigned int arg_amount;
+  /// @brief The file where the function was declared, or where it was called if this is a call site descriptor
+  const char *filename;
+  /// @brief The line where the function was declared, or where it was called if this is a call site descriptor
+  unsigned int line;
+  /// @brief The numeric id of the function, which is the same for all descriptors of the function - see 'PBL_FUNC_ID'
+  uint64_t id;
+  /// @brief Whether the descriptor was created for a call site, as the called function has none - see
+  /// 'PBL_CREATE_CALL_SITE_DESCRIPTOR'
+  bool is_call_site;
+};
+/// @brief Static description of a function, which is shared by all calls and never allocated
+typedef struct PblFunctionDescriptor PblFunctionDescriptor_T;
+
+// ---- End of Function Descriptor ------------------------------------------------------------------------------------
+
 // ---- Function Meta Type --------------------------------------------------------------------------------------------
 
 /// @brief (Never use this for malloc - this only indicates the usable memory space)
 /// @returns The usable size in bytes of the PBL MetaFunctionCallCtx type
 #define PblFunctionCallMetaData_T_Size                                                                                 \
   (sizeof(PblBool_T *) + sizeof(PblUInt_T *) + sizeof(PblBool_T *) + 2 * sizeof(PblFunctionCallMetaData_T *) +         \
-   sizeof(NULL))
+   sizeof(NULL) + sizeof(const PblFunctionDescriptor_T *))
 /// @brief Returns the declaration default for the type 'PblMetaFunctionCallCtx_T'
 #define PblFunctionCallMetaData_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblFunctionCallMetaData_T)
 /// @brief Returns the definition default for the type 'PblMetaFunctionCallCtx_T', where the value/the children have not been set yet
@@ -267,7 +624,8 @@ typedef struct PblException PblException_T;
 #define PblFunctionCallMetaData_T_DefDefault                                                                           \
   PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(                                                                      \
     PblFunctionCallMetaData_T, .function_identifier = NULL, .is_failure = NULL, .arg_amount = NULL,                    \
-    .is_threaded = NULL, .failure_origin_ctx = NULL, .call_origin_ctx = NULL, .exception = NULL)
+    .is_threaded = NULL, .failure_origin_ctx = NULL, .call_origin_ctx = NULL, .exception = NULL,                       \
+    .descriptor = NULL)
 
 /// @brief Base Meta Type passed to all functions
 struct PblFunctionCallMetaData_Base {
@@ -290,6 +648,8 @@ struct PblFunctionCallMetaData_Base {
   /// Only available when is_failure is true
   /// (Reserved for PblException_T)
   PblException_T *exception;
+  /// @brief The static descriptor of the called function, or NULL if the ctx was not created by 'PBL_CALL_FUNC'
+  const PblFunctionDescriptor_T *descriptor;
 };
 
 /// @brief Base Meta Type passed to all functions
@@ -299,6 +659,47 @@ typedef struct PblFunctionCallMetaData PblFunctionCallMetaData_T;
 
 // ---- End of Function Meta Type -------------------------------------------------------------------------------------
 
+// ---- Stack Call Context --------------------------------------------------------------------------------------------
+
+/// @brief The type, which marks a call ctx that is located in the stack - see 'PblStackCallCtx_T'
+extern const PblType_T PBL_STACK_CALL_CTX_TYPE;
+
+/// @brief Call ctx, which is located in the stack frame of the caller. Its properties point to the storage inside this
+/// struct and the static function descriptor, so creating it does not allocate anything
+struct PblStackCallCtx {
+  /// @brief The ctx passed to the called function, whose 'meta.type' is 'PBL_STACK_CALL_CTX_TYPE'
+  PblFunctionCallMetaData_T ctx;
+  /// @brief The storage of 'ctx.actual.is_failure'
+  PblBool_T is_failure;
+  /// @brief The storage of 'ctx.actual.arg_amount'
+  PblUInt_T arg_amount;
+};
+/// @brief Call ctx, which is located in the stack frame of the caller
+typedef struct PblStackCallCtx PblStackCallCtx_T;
+
+/// @brief Initialiser of a stack call ctx
+/// @param var The variable that is initialised
+/// @param descriptor_ptr The static descriptor of the called function
+/// @param passed_arg_amount The amount of arguments passed to the function
+/// @param threaded Whether the ctx is threaded
+/// @param origin_ctx The call origin ctx
+#define PBL_STACK_CALL_CTX_INIT(var, descriptor_ptr, passed_arg_amount, threaded, origin_ctx)                          \
+  {                                                                                                                    \
+    .ctx = {.meta = {.defined = true, .type = (PblType_T *) &PBL_STACK_CALL_CTX_TYPE},                                 \
+            .actual = {.function_identifier = NULL,                                                                    \
+                       .is_failure = &(var).is_failure,                                                                \
+                       .arg_amount = &(var).arg_amount,                                                                \
+                       .is_threaded = (threaded),                                                                      \
+                       .failure_origin_ctx = NULL,                                                                     \
+                       .call_origin_ctx = (origin_ctx),                                                                \
+                       .exception = NULL,                                                                              \
+                       .descriptor = (descriptor_ptr)}},                                                               \
+    .is_failure = {.meta = {.defined = true, .type = NULL}, .actual = false},                                          \
+    .arg_amount = {.meta = {.defined = true, .type = NULL}, .actual = (passed_arg_amount)},                            \
+  }
+
+// ---- End of Stack Call Context -------------------------------------------------------------------------------------
+
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
 /**
@@ -311,9 +712,28 @@ PblFunctionCallMetaData_T *PblGetMetaFunctionCallCtxT(PblString_T *function_iden
                                                       PblFunctionCallMetaData_T *call_origin_ctx,
                                                       PblException_T *exception);
 
+/**
+ * @brief Calculates the numeric id of the function with the passed name on runtime, which is equal to the id
+ * 'PBL_FUNC_ID' calculates on compile time
+ * @param name The name of the function
+ * @return The numeric id
+ */
+uint64_t PblGetFunctionId(const char *name);
+
+/**
+ * @brief Promotes the passed call ctx to the heap if it is located in the stack, so it stays valid after the caller
+ * returned. The call origin ctx of the next ctx in the traceback (starting at 'failure_origin_ctx') is updated to the
+ * promoted ctx.
+ * @param ctx The call ctx
+ * @return The promoted ctx, or the passed ctx if it is already located in the heap
+ * @note The function identifier of the promoted ctx is the interned name of the descriptor
+ */
+PblFunctionCallMetaData_T *PblPromoteCallCtx(PblFunctionCallMetaData_T *ctx);
+
 /**
  * @brief Deallocates the passed function call ctx and safely resets all values
  * @param ctx The function call ctx to deallocate
+ * @note Call ctxs located in the stack are not deallocated
  */
 PblVoid_T PblDeallocateMetaFunctionCallCtxT(PblFunctionCallMetaData_T *ctx);
 
@@ -324,6 +744,84 @@ PblVoid_T PblDeallocateMetaFunctionCallCtxT(PblFunctionCallMetaData_T *ctx);
 PblException_T *PblGetExceptionT(PblString_T *msg, PblString_T *name, PblString_T *filename, PblUInt_T *line,
                                  PblString_T *line_content, PblVoid_T *parent_exc, PblVoid_T *child_exc);
 
+/**
+ * @brief Gets a new Exception Type, whose properties are created from the passed raise site once they are accessed
+ * @param site The static raise site
+ * @return The newly created exception (pointer)
+ */
+PblException_T *PblGetLazyExceptionT(const PblRaiseSite_T *site);
+
+/**
+ * @brief Gets the message of the exception, which is created from the raise site on the first access
+ * @param exc The exception
+ * @return The message, or NULL if there is none
+ */
+PblString_T *PblGetExceptionMsg(PblException_T *exc);
+
+/**
+ * @brief Gets the interned name of the exception, which is created from the raise site on the first access
+ * @param exc The exception
+ * @return The name, or NULL if there is none
+ */
+PblString_T *PblGetExceptionName(PblException_T *exc);
+
+/**
+ * @brief Gets the filename where the exception was raised, which is created from the raise site on the first access
+ * @param exc The exception
+ * @return The filename, or NULL if there is none
+ */
+PblString_T *PblGetExceptionFilename(PblException_T *exc);
+
+/**
+ * @brief Gets the line where the exception was raised, which is created from the raise site on the first access
+ * @param exc The exception
+ * @return The line, or NULL if there is none
+ */
+PblUInt_T *PblGetExceptionLine(PblException_T *exc);
+
+/**
+ * @brief Gets the content of the line where the exception was raised, which is created from the raise site on the
+ * first access
+ * @param exc The exception
+ * @return The line content, or NULL if there is none
+ */
+PblString_T *PblGetExceptionLineContent(PblException_T *exc);
+
+/**
+ * @brief Registers the passed exception class and its parents, which assigns a unique numeric id to every class. This
+ * is done automatically on the first use of a class, but may be done ahead of time (e.g. at startup)
+ * @param exc_class The exception class, which must stay valid for the rest of the program (e.g. a global variable)
+ * @note This aborts if the hierarchy is deeper than 'PBL_EXCEPTION_CLASS_MAX_DEPTH'
+ */
+void PblRegisterExceptionClass(PblExceptionClass_T *exc_class);
+
+/**
+ * @brief Checks whether the class 'sub_class' is the class 'exc_class' or inherits from it, which takes constant time
+ * regardless of the depth of the hierarchy
+ * @param sub_class The class that should be checked
+ * @param exc_class The potential parent class
+ * @return True if 'sub_class' is 'exc_class' or one of its subclasses
+ */
+bool PblIsExceptionSubclass(PblExceptionClass_T *sub_class, PblExceptionClass_T *exc_class);
+
+/**
+ * @brief Checks whether the exception is an instance of the passed class or one of its subclasses
+ * @param exc The exception, where exceptions without a class are instances of 'PblBaseException'
+ * @param exc_class The exception class
+ * @return True if the exception is an instance of the class
+ */
+bool PblIsExceptionInstance(PblException_T *exc, PblExceptionClass_T *exc_class);
+
+/**
+ * @brief Formats the traceback of the exception the passed ctx failed with, which walks through the call ctxs
+ * starting at 'failure_origin_ctx' up to the passed ctx. The most recent call is listed last
+ * @param ctx The ctx that failed, e.g. the ctx of the function that caught the exception
+ * @return The formatted traceback, or NULL if the ctx did not fail
+ * @note The call ctxs are only valid until the frame of the catching function returns, so the traceback has to be
+ * formatted before
+ */
+PblString_T *PblFormatTraceback(PblFunctionCallMetaData_T *ctx);
+
 /**
  * @brief Raises a new exception by updating the local context info
  * @param this_call_meta The current context info that should be updated
@@ -332,12 +830,43 @@ PblException_T *PblGetExceptionT(PblString_T *msg, PblString_T *name, PblString_
 PblVoid_T PblRaiseNewException(PblFunctionCallMetaData_T *this_call_meta, PblException_T *exception);
 
 /**
- * @brief Deallocates the passed exception type and safely resets all values
+ * @brief Deallocates the passed exception type and safely resets all values. The exception itself is kept in the pool
+ * of the current thread if it is not full, so the next raised exception can reuse it without allocating
  * @param exc The exception to deallocate
  * @notes This function will de-allocate the children and parents exceptions as well
+ * @note Preallocated exceptions (e.g. 'PblOutOfMemoryException') are ignored
  */
 PblVoid_T PblDeallocateExceptionT(PblException_T *exc);
 
+/**
+ * @brief Records the start of a call of the passed function in the profile of the current thread - see
+ * 'PBL_PROFILE_ENTER'
+ * @param descriptor The descriptor of the called function
+ */
+void PblProfileEnter(const PblFunctionDescriptor_T *descriptor);
+
+/**
+ * @brief Records the end of the last call started on the current thread using 'PblProfileEnter' - see
+ * 'PBL_PROFILE_EXIT'
+ * @param failed Whether the call raised an exception
+ */
+void PblProfileExit(bool failed);
+
+/**
+ * @brief Records a begin event for a call of the passed function in the trace of the current thread - see
+ * 'PBL_TRACE_ENTER'
+ * @param descriptor The descriptor of the called function
+ * @param is_threaded Whether the call ctx is threaded, which is shown in the name of the thread
+ */
+void PblTraceEnter(const PblFunctionDescriptor_T *descriptor, bool is_threaded);
+
+/**
+ * @brief Records an end event for the last call started on the current thread using 'PblTraceEnter' - see
+ * 'PBL_TRACE_EXIT'
+ * @param exception The exception the call raised, or NULL if it did not fail
+ */
+void PblTraceExit(const PblException_T *exception);
+
 // ---- End of Functions Definitions ----------------------------------------------------------------------------------
 
 #ifdef __cplusplus
@@ -0,0 +1,361 @@
+/// @file pbl-memoize.h
+/// @brief Memoisation of pure Pbl functions, which caches the results of a function declared using
+/// 'PBL_CREATE_FUNC_OVERHEAD' by the values of its args in a bounded, sharded LRU cache
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-function.h"
+#include <float.h>
+#include <string.h>
+
+#ifndef PBL_MODULES_MEMOIZE_H
+#define PBL_MODULES_MEMOIZE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Memoize Types -------------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of shards of a cache, where every shard has its own lock and LRU list
+#define PBL_MEMO_MAX_SHARDS 16
+
+/// @brief The min. capacity of a single shard. Caches with a smaller capacity use fewer shards, meaning caches with a
+/// capacity below twice this value are a single exact LRU
+#define PBL_MEMO_MIN_SHARD_CAPACITY 64
+
+/// @brief Describes how a 'PblMemoKeyArg_T' is compared
+enum PblMemoKeyArgType {
+  /// @brief The arg was a NULL pointer
+  PBL_MEMO_KEY_ARG_NULL,
+  /// @brief The arg is compared using the value 'bits', which is the numeric value or the address of a pointer
+  PBL_MEMO_KEY_ARG_VALUE,
+  /// @brief The arg is compared by the content of 'str', where 'bits' is the hash of the string
+  PBL_MEMO_KEY_ARG_STRING
+};
+
+/// @brief A single arg of the key a result is cached with
+struct PblMemoKeyArg {
+  /// @brief The type of the arg
+  enum PblMemoKeyArgType type;
+  /// @brief The bits of the value, or the hash if the type is 'PBL_MEMO_KEY_ARG_STRING'
+  uint64_t bits;
+  /// @brief The bits of the value that do not fit into 'bits', which is only the case for long doubles
+  uint64_t extra_bits;
+  /// @brief The string, if the type is 'PBL_MEMO_KEY_ARG_STRING'
+  PblString_T *str;
+};
+typedef struct PblMemoKeyArg PblMemoKeyArg_T;
+
+/// @brief The cache of a memoized function
+struct PblMemoCache {
+  /// @brief The max. amount of results that are kept, where the least recently used result of a shard is evicted once
+  /// the shard is full. This is rounded up to a multiple of the amount of shards
+  size_t capacity;
+  /// @brief The internal state, which is created on the first call
+  void *state;
+};
+/// @brief The cache of a memoized function
+typedef struct PblMemoCache PblMemoCache_T;
+
+/// @brief Statistics of a memoized function
+struct PblMemoStats {
+  /// @brief The amount of calls that returned a cached result
+  uint64_t hits;
+  /// @brief The amount of calls that called the function
+  uint64_t misses;
+  /// @brief The amount of results that were evicted to make space for a new one
+  uint64_t evictions;
+  /// @brief The amount of results that are currently cached
+  uint64_t size;
+};
+/// @brief Statistics of a memoized function
+typedef struct PblMemoStats PblMemoStats_T;
+
+// ---- End of Memoize Types ------------------------------------------------------------------------------------------
+
+// ---- Key Args ------------------------------------------------------------------------------------------------------
+
+/// @brief Creates a key arg with the passed type and value
+static inline PblMemoKeyArg_T PblGetMemoKeyArg(enum PblMemoKeyArgType type, uint64_t bits, PblString_T *str) {
+  PblMemoKeyArg_T arg;
+  arg.type = type;
+  arg.bits = bits;
+  arg.extra_bits = 0;
+  arg.str = str;
+  return arg;
+}
+
+/// @brief Creates a key arg, which is 'PBL_MEMO_KEY_ARG_NULL' if the passed Pbl value is NULL and otherwise its
+/// 'actual' value
+#define PBL_MEMO_KEY_ARG_OF_NUMBER(val)                                                                                \
+  ((val) == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL)                                                    \
+                 : PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, (uint64_t) (val)->actual, NULL))
+
+/// @brief Creates a key arg for the passed double using its bits, meaning '0.0' and '-0.0' are different keys
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfDouble(double val) {
+  uint64_t bits;
+  memcpy(&bits, &val, sizeof(bits));
+  return PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, bits, NULL);
+}
+
+/// @brief Creates a key arg for the passed long double using the bits of its significant bytes, which skips the padding
+/// of the 80-bit extended precision format
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfLongDouble(long double val) {
+  uint64_t bits[2] = {0, 0};
+  memcpy(bits, &val, LDBL_MANT_DIG == 64 ? 10 : sizeof(val) < sizeof(bits) ? sizeof(val) : sizeof(bits));
+  PblMemoKeyArg_T arg = PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, bits[0], NULL);
+  arg.extra_bits = bits[1];
+  return arg;
+}
+
+/// @brief Creates a key arg for the passed C float
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfFloat(float val) { return PblGetMemoKeyArgOfDouble(val); }
+/// @brief Creates a key arg for the passed signed C integer
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfSigned(long long val) {
+  return PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, (uint64_t) val, NULL);
+}
+/// @brief Creates a key arg for the passed unsigned C integer
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfUnsigned(unsigned long long val) {
+  return PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, (uint64_t) val, NULL);
+}
+/// @brief Creates a key arg for the passed pointer, which is compared by its address
+/// @note The cached key references the pointer, meaning the memory stays alive as long as the result is cached
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfPointer(const void *val) {
+  return val == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL)
+                     : PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_VALUE, (uint64_t) (uintptr_t) val, NULL);
+}
+/// @brief Creates a key arg for the passed string, which is compared by its content
+/// @note The cached key uses a copy of the string (or the string itself if it is interned), meaning the string may be
+/// modified after the call
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfString(PblString_T *val) {
+  return val == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL)
+                     : PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_STRING, PblGetStringHash(val), val);
+}
+/// @brief Creates a key arg for the passed bool
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfBoolT(PblBool_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed char
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfCharT(PblChar_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed unsigned char
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfUCharT(PblUChar_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed short
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfShortT(PblShort_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed unsigned short
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfUShortT(PblUShort_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed int
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfIntT(PblInt_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed unsigned int
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfUIntT(PblUInt_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed long
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfLongT(PblLong_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed unsigned long
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfULongT(PblULong_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed long long
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfLongLongT(PblLongLong_T *val) {
+  return PBL_MEMO_KEY_ARG_OF_NUMBER(val);
+}
+/// @brief Creates a key arg for the passed unsigned long long
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfULongLongT(PblULongLong_T *val) {
+  return PBL_MEMO_KEY_ARG_OF_NUMBER(val);
+}
+/// @brief Creates a key arg for the passed size
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfSizeT(PblSize_T *val) { return PBL_MEMO_KEY_ARG_OF_NUMBER(val); }
+/// @brief Creates a key arg for the passed float
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfFloatT(PblFloat_T *val) {
+  return val == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL) : PblGetMemoKeyArgOfFloat(val->actual);
+}
+/// @brief Creates a key arg for the passed double
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfDoubleT(PblDouble_T *val) {
+  return val == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL) : PblGetMemoKeyArgOfDouble(val->actual);
+}
+/// @brief Creates a key arg for the passed long double
+static inline PblMemoKeyArg_T PblGetMemoKeyArgOfLongDoubleT(PblLongDouble_T *val) {
+  return val == NULL ? PblGetMemoKeyArg(PBL_MEMO_KEY_ARG_NULL, 0, NULL) : PblGetMemoKeyArgOfLongDouble(val->actual);
+}
+
+#ifdef __cplusplus
+}
+
+// Overloads are used in C++, as _Generic is not available
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblString_T *val) { return PblGetMemoKeyArgOfString(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblBool_T *val) { return PblGetMemoKeyArgOfBoolT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblChar_T *val) { return PblGetMemoKeyArgOfCharT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblUChar_T *val) { return PblGetMemoKeyArgOfUCharT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblShort_T *val) { return PblGetMemoKeyArgOfShortT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblUShort_T *val) { return PblGetMemoKeyArgOfUShortT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblInt_T *val) { return PblGetMemoKeyArgOfIntT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblUInt_T *val) { return PblGetMemoKeyArgOfUIntT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblLong_T *val) { return PblGetMemoKeyArgOfLongT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblULong_T *val) { return PblGetMemoKeyArgOfULongT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblLongLong_T *val) { return PblGetMemoKeyArgOfLongLongT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblULongLong_T *val) { return PblGetMemoKeyArgOfULongLongT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblSize_T *val) { return PblGetMemoKeyArgOfSizeT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblFloat_T *val) { return PblGetMemoKeyArgOfFloatT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblDouble_T *val) { return PblGetMemoKeyArgOfDoubleT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(PblLongDouble_T *val) { return PblGetMemoKeyArgOfLongDoubleT(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(const void *val) { return PblGetMemoKeyArgOfPointer(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(char val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(bool val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(signed char val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(short val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(int val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(long val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(long long val) { return PblGetMemoKeyArgOfSigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(unsigned char val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(unsigned short val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(unsigned int val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(unsigned long val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(unsigned long long val) { return PblGetMemoKeyArgOfUnsigned(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(float val) { return PblGetMemoKeyArgOfFloat(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(double val) { return PblGetMemoKeyArgOfDouble(val); }
+inline PblMemoKeyArg_T PblGetMemoKeyArgOf(long double val) { return PblGetMemoKeyArgOfLongDouble(val); }
+
+/// @brief Converts the passed arg into a 'PblMemoKeyArg_T' based on its type, where Pbl numbers and strings are
+/// compared by their value and other pointers by their address
+#define PBL_MEMO_KEY_ARG(val) PblGetMemoKeyArgOf(val)
+
+extern "C" {
+#else
+/// @brief Converts the passed arg into a 'PblMemoKeyArg_T' based on its type, where Pbl numbers and strings are
+/// compared by their value and other pointers by their address
+#define PBL_MEMO_KEY_ARG(val)                                                                                          \
+  _Generic((val),                                                                                                      \
+    PblString_T *: PblGetMemoKeyArgOfString,                                                                           \
+    PblBool_T *: PblGetMemoKeyArgOfBoolT,                                                                              \
+    PblChar_T *: PblGetMemoKeyArgOfCharT,                                                                              \
+    PblUChar_T *: PblGetMemoKeyArgOfUCharT,                                                                            \
+    PblShort_T *: PblGetMemoKeyArgOfShortT,                                                                            \
+    PblUShort_T *: PblGetMemoKeyArgOfUShortT,                                                                          \
+    PblInt_T *: PblGetMemoKeyArgOfIntT,                                                                                \
+    PblUInt_T *: PblGetMemoKeyArgOfUIntT,                                                                              \
+    PblLong_T *: PblGetMemoKeyArgOfLongT,                                                                              \
+    PblULong_T *: PblGetMemoKeyArgOfULongT,                                                                            \
+    PblLongLong_T *: PblGetMemoKeyArgOfLongLongT,                                                                      \
+    PblULongLong_T *: PblGetMemoKeyArgOfULongLongT,                                                                    \
+    PblSize_T *: PblGetMemoKeyArgOfSizeT,                                                                              \
+    PblFloat_T *: PblGetMemoKeyArgOfFloatT,                                                                            \
+    PblDouble_T *: PblGetMemoKeyArgOfDoubleT,                                                                          \
+    PblLongDouble_T *: PblGetMemoKeyArgOfLongDoubleT,                                                                  \
+    char: PblGetMemoKeyArgOfSigned,                                                                                    \
+    bool: PblGetMemoKeyArgOfUnsigned,                                                                                  \
+    signed char: PblGetMemoKeyArgOfSigned,                                                                             \
+    short: PblGetMemoKeyArgOfSigned,                                                                                   \
+    int: PblGetMemoKeyArgOfSigned,                                                                                     \
+    long: PblGetMemoKeyArgOfSigned,                                                                                    \
+    long long: PblGetMemoKeyArgOfSigned,                                                                               \
+    unsigned char: PblGetMemoKeyArgOfUnsigned,                                                                         \
+    unsigned short: PblGetMemoKeyArgOfUnsigned,                                                                        \
+    unsigned int: PblGetMemoKeyArgOfUnsigned,                                                                          \
+    unsigned long: PblGetMemoKeyArgOfUnsigned,                                                                         \
+    unsigned long long: PblGetMemoKeyArgOfUnsigned,                                                                    \
+    float: PblGetMemoKeyArgOfFloat,                                                                                    \
+    double: PblGetMemoKeyArgOfDouble,                                                                                  \
+    long double: PblGetMemoKeyArgOfLongDouble,                                                                         \
+    default: PblGetMemoKeyArgOfPointer)(val)
+#endif
+
+/// @brief Converts a single field of the args struct 'in' into an item of the key array
+#define PBL_MEMO_KEY_ITEM(field) PBL_MEMO_KEY_ARG(in.field),
+
+// ---- End of Key Args -----------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+/**
+ * @brief Looks up the result cached with the passed key and marks it as the most recently used one
+ * @param cache The cache of the memoized function
+ * @param key The args of the call
+ * @param len The amount of args
+ * @return The cached result, or NULL if no result is cached with the key
+ * @note Every call is counted as either a hit or a miss
+ * @note Every hit returns the same result object, which is shared by all callers and must therefore not be modified
+ */
+void *PblMemoGet(PblMemoCache_T *cache, const PblMemoKeyArg_T *key, size_t len);
+
+/**
+ * @brief Caches the passed result with the passed key, which evicts the least recently used result of the shard if it
+ * is full
+ * @param cache The cache of the memoized function
+ * @param key The args of the call, which are copied. Strings are copied as well, unless they are interned
+ * @param len The amount of args
+ * @param result The result of the call. NULL results are not cached
+ * @return The cached result, which is the result of another thread if it cached a result with the same key first
+ */
+void *PblMemoPut(PblMemoCache_T *cache, const PblMemoKeyArg_T *key, size_t len, void *result);
+
+/**
+ * @brief Gets the statistics of the passed cache
+ * @param cache The cache of the memoized function (e.g. 'PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(Foo)')
+ * @param stats Is set to the statistics of the cache
+ */
+void PblMemoGetStats(PblMemoCache_T *cache, PblMemoStats_T *stats);
+
+/**
+ * @brief Removes every cached result of the passed cache and resets its statistics
+ * @param cache The cache of the memoized function (e.g. 'PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(Foo)')
+ */
+void PblMemoClear(PblMemoCache_T *cache);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+// ---- Macros --------------------------------------------------------------------------------------------------------
+
+/// @brief Macro Function to get the standardised identifier for the memoized overhead of a PBL function
+/// @note For this identifier to be valid, the macro function 'PBL_MEMOIZE' has to be used before
+/// @return The identifier in the '<func_identifier>_Memoized' format
+#define PBL_GET_FUNC_MEMOIZED_IDENTIFIER(func_identifier) func_identifier##_Memoized
+
+/// @brief Macro Function to get the standardised identifier for the memoisation cache of a PBL function
+/// @note For this identifier to be valid, the macro function 'PBL_MEMOIZE' has to be used before
+/// @return The identifier in the '<func_identifier>_MemoCache' format
+#define PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(func_identifier) func_identifier##_MemoCache
+
+/// @brief Declares the memoized overhead and the cache of a PBL function, which are defined using 'PBL_MEMOIZE'
+/// @param ret_signature The return signature of the function, which has to be a pointer
+/// @param identifier The identifier of the function
+/// @note (This macro is only for headers)
+#define PBL_DECLARE_MEMOIZE(ret_signature, identifier)                                                                 \
+  extern PblMemoCache_T PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(identifier);                                                \
+  ret_signature PBL_GET_FUNC_MEMOIZED_IDENTIFIER(identifier)(struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) in);
+
+/**
+ * @brief Defines the memoized overhead '<identifier>_Memoized' of a function created using 'PBL_CREATE_FUNC_OVERHEAD',
+ * which returns the cached result if the function was already called with the same values for the passed fields and
+ * otherwise calls '<identifier>_Overhead' and caches its result
+ * @param ret_signature The return signature of the function, which has to be a pointer
+ * @param identifier The identifier of the function
+ * @param capacity The max. amount of results that are cached
+ * @param fields The fields of the args struct the result depends on, which are compared by their value if they are a
+ * Pbl number, a 'PblString_T' or a C number and otherwise by their address
+ * @note A cached result is returned without calling the overhead, meaning the function and the calls made inside it
+ * do not run, and no call ctx is created. The function therefore has to be pure, and NULL results are never cached
+ * @note Every call with the same key returns the same result object, meaning callers must not modify the result
+ * @note (This macro is only for source files)
+ */
+#define PBL_MEMOIZE(ret_signature, identifier, capacity, fields...)                                                    \
+  PblMemoCache_T PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(identifier) = {(capacity), NULL};                                  \
+  ret_signature PBL_GET_FUNC_MEMOIZED_IDENTIFIER(identifier)(struct PBL_GET_FUNC_ARGS_IDENTIFIER(identifier) in) {     \
+    PblMemoKeyArg_T key[] = {PBL_APPLY_MACRO(PBL_MEMO_KEY_ITEM, fields)};                                              \
+    const size_t len = sizeof(key) / sizeof(key[0]);                                                                   \
+    void *cached = PblMemoGet(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(identifier), key, len);                              \
+    if (cached != NULL) return (ret_signature) cached;                                                                 \
+    void *result = (void *) PBL_GET_FUNC_OVERHEAD_IDENTIFIER(identifier)(in);                                          \
+    return (ret_signature) PblMemoPut(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(identifier), key, len, result);              \
+  }
+
+/// @brief Calls the memoized overhead of the passed function with the passed named args
+/// @note For this to be valid, the macro function 'PBL_MEMOIZE' or 'PBL_DECLARE_MEMOIZE' has to be used before
+#define PblMemoized(func, args...)                                                                                     \
+  PBL_GET_FUNC_MEMOIZED_IDENTIFIER(func)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(func)){args})
+
+// ---- End of Macros -------------------------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_MEMOIZE_H
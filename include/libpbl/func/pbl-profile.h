@@ -0,0 +1,94 @@
+/// @file pbl-profile.h
+/// @brief Function-level profiler and tracer, which record every call made using 'PBL_CALL_FUNC' into per-thread call
+/// trees if 'PBL_PROFILE_CALLS' is defined, and into per-thread event rings if 'PBL_TRACE_CALLS' is defined
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-function.h"
+
+#ifndef PBL_MODULES_PROFILE_H
+#define PBL_MODULES_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Profile Types -------------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of distinct call paths (function and chain of callers) recorded per thread. Calls on further
+/// paths are recorded as '[truncated]'
+#define PBL_PROFILE_MAX_NODES 4096
+
+/// @brief The max. depth of nested calls recorded per thread. Deeper calls are not recorded, but still counted as part
+/// of the inclusive time of their callers
+#define PBL_PROFILE_MAX_DEPTH 256
+
+/// @brief Aggregated profile of a function over all threads
+struct PblProfileStats {
+  /// @brief The amount of finished calls
+  uint64_t calls;
+  /// @brief The amount of calls that raised an exception
+  uint64_t exceptions;
+  /// @brief The time spent inside the function including its callees in nanoseconds, where recursive calls are only
+  /// counted once
+  uint64_t inclusive_ns;
+  /// @brief The time spent inside the function excluding its callees in nanoseconds
+  uint64_t exclusive_ns;
+};
+/// @brief Aggregated profile of a function over all threads
+typedef struct PblProfileStats PblProfileStats_T;
+
+// ---- End of Profile Types ------------------------------------------------------------------------------------------
+
+// ---- Trace Types ---------------------------------------------------------------------------------------------------
+
+/// @brief The amount of events every thread keeps, where the oldest events are overwritten once the ring is full. A
+/// call records two events, and a call that raised an exception a third one
+#define PBL_TRACE_RING_SIZE 16384
+
+// ---- End of Trace Types --------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+/**
+ * @brief Gets the aggregated profile of the passed function over all threads
+ * @param function_id The id of the function (e.g. 'Foo_Descriptor.id' or 'PblGetFunctionId("Foo")')
+ * @param stats Is set to the profile of the function
+ * @return True if the function was called since the program started, else false
+ * @note Threads that are still running may update their profile while it is read, so the result is approximate
+ * @note The call tree of an exited thread is continued by the next thread, so the memory of the profile only grows with
+ * the max. amount of threads running at the same time
+ */
+bool PblProfileGetStats(uint64_t function_id, PblProfileStats_T *stats);
+
+/**
+ * @brief Writes the profile of all threads in the collapsed-stack format (one 'caller;callee exclusive_ns' line per
+ * call path), which can be turned into a flamegraph using 'flamegraph.pl'
+ * @param path The path of the file, which is created or truncated
+ * @return True if the file was written entirely
+ */
+bool PblProfileDumpCollapsed(const char *path);
+
+/**
+ * @brief Writes the recent events of all threads in the Chrome trace-event JSON format, which can be opened using
+ * 'chrome://tracing' or Perfetto. Every call is a begin and end event on the track of its thread, and exceptions are
+ * instant events named after the exception
+ * @param path The path of the file, which is created or truncated
+ * @return True if the file was written entirely
+ * @note The rings of running threads are copied before they are written, where events that may have been overwritten
+ * while copying are left out. The events of running threads are therefore only complete if the threads are idle
+ * @note The ring of an exited thread is continued by the next thread, whose events are shown on the same track
+ */
+bool PblTraceDump(const char *path);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_PROFILE_H
@@ -0,0 +1,231 @@
+/// @file pbl-async-io.h
+/// @brief Asynchronous file I/O on streams, which keeps many reads and writes in flight using io_uring if the kernel
+/// supports it, and otherwise using a pool of worker threads
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-io.h"
+#include "../types/pbl-types.h"
+#include "../func/pbl-function.h"
+
+#ifndef PBL_MODULES_ASYNC_IO_H
+#define PBL_MODULES_ASYNC_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Async I/O Types -----------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of operations in flight at the same time if no queue depth was passed
+#define PBL_ASYNC_IO_DEFAULT_QUEUE_DEPTH 256
+
+/// @brief The amount of worker threads of the thread pool backend if no amount was passed
+#define PBL_ASYNC_IO_DEFAULT_THREADS 4
+
+/// @brief The backend that performs the operations of an engine
+enum PblAsyncIOBackend {
+  /// @brief Uses io_uring if the kernel supports it, and otherwise the thread pool (Default)
+  PBL_ASYNC_IO_BACKEND_AUTO,
+  /// @brief Submits the operations to the kernel using io_uring (Linux 5.6 or newer)
+  PBL_ASYNC_IO_BACKEND_IO_URING,
+  /// @brief Performs the operations using blocking 'pread' and 'pwrite' calls on a pool of worker threads
+  PBL_ASYNC_IO_BACKEND_THREAD_POOL
+};
+
+/// @brief The kind of operation of an async I/O handle
+enum PblAsyncIOOp {
+  /// @brief Reads from the file into the buffer
+  PBL_ASYNC_IO_READ,
+  /// @brief Writes the buffer into the file
+  PBL_ASYNC_IO_WRITE
+};
+
+/// @brief The state of an async I/O handle
+enum PblAsyncIOState {
+  /// @brief The operation was queued, but not submitted yet - see 'PblAsyncIOSubmit'
+  PBL_ASYNC_IO_QUEUED,
+  /// @brief The operation was submitted and is in flight
+  PBL_ASYNC_IO_IN_FLIGHT,
+  /// @brief The operation completed, and its result and callback are available
+  PBL_ASYNC_IO_COMPLETED
+};
+
+/// @brief Engine, which submits async operations and reaps their completions
+/// @note An engine may only be used by a single thread, which is also the thread the callbacks are run on
+struct PblAsyncIOEngine;
+typedef struct PblAsyncIOEngine PblAsyncIOEngine_T;
+
+struct PblAsyncIOHandle;
+
+/// @brief Callback, which is run on the thread that polls the engine once the operation completed
+typedef void (*PblAsyncIOCallback_T)(struct PblAsyncIOHandle *handle, void *user_data);
+
+/// @brief Completion handle of an async read or write
+struct PblAsyncIOHandle {
+  /// @brief The kind of operation
+  enum PblAsyncIOOp op;
+  /// @brief The 'enum PblAsyncIOState' of the operation, which is accessed atomically - prefer 'PblAsyncIOIsComplete'
+  int state;
+  /// @brief The file descriptor the operation is performed on
+  int fd;
+  /// @brief The buffer that is read into or written from, which must stay valid until the operation completed
+  void *buffer;
+  /// @brief The size of the buffer in bytes
+  size_t len;
+  /// @brief The offset in the file where the operation starts
+  int64_t offset;
+  /// @brief The amount of transferred bytes, or the negative errno if the operation failed. Same as for 'pread' and
+  /// 'pwrite', this may be less than 'len'
+  int64_t result;
+  /// @brief The callback run once the operation completed - NULL if there is none
+  PblAsyncIOCallback_T callback;
+  /// @brief The user data passed to the callback
+  void *user_data;
+  /// @brief The engine the operation belongs to
+  PblAsyncIOEngine_T *engine;
+  /// @brief The neighbours in the lists of the engine, which keep the handle reachable while it is not completed
+  struct PblAsyncIOHandle *prev;
+  struct PblAsyncIOHandle *next;
+};
+typedef struct PblAsyncIOHandle PblAsyncIOHandle_T;
+
+// ---- End of Async I/O Types ----------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblAsyncIOCreateEngine'
+PBL_CREATE_FUNC_OVERHEAD(PblAsyncIOEngine_T *, PblAsyncIOCreateEngine,, size_t queue_depth, size_t threads,
+                         enum PblAsyncIOBackend backend)
+
+/**
+ * @brief Creates a new async I/O engine
+ * @param queue_depth The max. amount of operations in flight at the same time. Further operations stay queued until
+ * others completed. If per default 'PBL_ASYNC_IO_DEFAULT_QUEUE_DEPTH'
+ * @param threads The amount of worker threads if the thread pool is used. If per default 'PBL_ASYNC_IO_DEFAULT_THREADS'
+ * @param backend The backend that should be used. If per default 'PBL_ASYNC_IO_BACKEND_AUTO'
+ * @return The new engine, or NULL if the requested backend is not available
+ * @note The worker threads never allocate using the garbage collector, so they do not have to be registered
+ */
+#define PblAsyncIOCreateEngine(args...)                                                                                \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblAsyncIOCreateEngine)                                                             \
+  ((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblAsyncIOCreateEngine)){args})
+
+/**
+ * @brief Waits until all operations of the engine completed, and destroys the engine
+ * @param engine The engine that should be destroyed
+ */
+void PblAsyncIODestroyEngine(PblAsyncIOEngine_T *engine);
+
+/**
+ * @brief Gets the backend the engine uses
+ * @param engine The engine
+ * @return Either 'PBL_ASYNC_IO_BACKEND_IO_URING' or 'PBL_ASYNC_IO_BACKEND_THREAD_POOL'
+ */
+enum PblAsyncIOBackend PblAsyncIOGetBackend(PblAsyncIOEngine_T *engine);
+
+/**
+ * @brief Gets the name of the passed backend, e.g. "io_uring"
+ * @param backend The backend
+ * @return The static name of the backend
+ */
+const char *PblGetAsyncIOBackendName(enum PblAsyncIOBackend backend);
+
+// Creating the overhead and struct type for the Pbl-Function 'PblAsyncRead'
+PBL_CREATE_FUNC_OVERHEAD(PblAsyncIOHandle_T *, PblAsyncRead,, PblAsyncIOEngine_T *engine, PblIOStream_T *stream,
+                         void *buffer, size_t len, int64_t offset, PblAsyncIOCallback_T callback, void *user_data)
+
+/**
+ * @brief Queues an async read from the file descriptor of the stream. The read is submitted together with all other
+ * queued operations on the next call of 'PblAsyncIOSubmit', 'PblAsyncIOPoll' or 'PblAsyncIOWait'
+ * @param engine The engine (Required)
+ * @param stream The stream that is read from (Required)
+ * @param buffer The buffer the bytes are read into, which must stay valid until the read completed (Required)
+ * @param len The max. amount of bytes that should be read
+ * @param offset The offset in the file where the read starts. If per default 0
+ * @param callback The callback run once the read completed. If per default NULL
+ * @param user_data The user data passed to the callback. If per default NULL
+ * @return The completion handle of the read
+ * @note The read uses an explicit offset and bypasses the Pbl-managed buffer of the stream as well as its position
+ */
+#define PblAsyncRead(args...)                                                                                          \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblAsyncRead)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblAsyncRead)){args})
+
+// Creating the overhead and struct type for the Pbl-Function 'PblAsyncWrite'
+PBL_CREATE_FUNC_OVERHEAD(PblAsyncIOHandle_T *, PblAsyncWrite,, PblAsyncIOEngine_T *engine, PblIOStream_T *stream,
+                         const void *buffer, size_t len, int64_t offset, PblAsyncIOCallback_T callback,
+                         void *user_data)
+
+/**
+ * @brief Queues an async write onto the file descriptor of the stream. The write is submitted together with all other
+ * queued operations on the next call of 'PblAsyncIOSubmit', 'PblAsyncIOPoll' or 'PblAsyncIOWait'
+ * @param engine The engine (Required)
+ * @param stream The stream that is written to (Required)
+ * @param buffer The bytes that should be written, which must stay valid until the write completed (Required)
+ * @param len The amount of bytes that should be written
+ * @param offset The offset in the file where the write starts. If per default 0
+ * @param callback The callback run once the write completed. If per default NULL
+ * @param user_data The user data passed to the callback. If per default NULL
+ * @return The completion handle of the write
+ * @note Pending bytes in the Pbl-managed buffer of the stream are flushed beforehand, but operations in flight at the
+ * same time are not ordered
+ */
+#define PblAsyncWrite(args...)                                                                                         \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblAsyncWrite)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblAsyncWrite)){args})
+
+/**
+ * @brief Submits all queued operations as a single batch, as far as the queue depth allows it
+ * @param engine The engine
+ * @return The amount of submitted operations
+ */
+size_t PblAsyncIOSubmit(PblAsyncIOEngine_T *engine);
+
+/**
+ * @brief Submits the queued operations, and runs the callbacks of all completed operations without blocking
+ * @param engine The engine
+ * @return The amount of operations that completed
+ */
+size_t PblAsyncIOPoll(PblAsyncIOEngine_T *engine);
+
+/**
+ * @brief Submits the queued operations, and blocks until at least the passed amount of operations completed or no
+ * operation is pending anymore
+ * @param engine The engine
+ * @param min_completions The min. amount of operations that should complete
+ * @return The amount of operations that completed
+ */
+size_t PblAsyncIOWait(PblAsyncIOEngine_T *engine, size_t min_completions);
+
+/**
+ * @brief Blocks until the passed operation completed, while also running the callbacks of other completed operations
+ * @param handle The handle of the operation
+ * @return The amount of transferred bytes, or the negative errno if the operation failed
+ */
+int64_t PblAsyncIOWaitHandle(PblAsyncIOHandle_T *handle);
+
+/**
+ * @brief Checks whether the passed operation completed. Completions are only reaped by 'PblAsyncIOPoll' and
+ * 'PblAsyncIOWait'
+ * @param handle The handle of the operation
+ * @return True if the operation completed and its callback was run
+ */
+bool PblAsyncIOIsComplete(PblAsyncIOHandle_T *handle);
+
+/**
+ * @brief Gets the amount of operations that are queued or in flight
+ * @param engine The engine
+ * @return The amount of operations that did not complete yet
+ */
+size_t PblAsyncIOPending(PblAsyncIOEngine_T *engine);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_ASYNC_IO_H
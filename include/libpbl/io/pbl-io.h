@@ -49,14 +49,20 @@ typedef struct PblIOFile PblIOFile_T;
 
 /// @brief (Never use this for malloc - this only indicates the usable memory space)
 /// @returns The size of the type 'PblIOStream_T' in bytes
-#define PblStream_T_Size (sizeof(PblUInt_T *) + sizeof(PblIOFile_T *) + sizeof(PblBool_T *) + sizeof(PblString_T *))
+#define PblStream_T_Size                                                                                               \
+  (sizeof(PblUInt_T *) + sizeof(PblIOFile_T *) + sizeof(PblBool_T *) + sizeof(PblString_T *) +                         \
+   sizeof(struct PblStreamBuffer *))
 /// @brief Returns the declaration default for the type 'PblIOStream_T'
 #define PblStream_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblIOStream_T)
 /// @brief Returns the definition default for the type 'PblIOStream_T', where the value/the children have not been set yet
 /// and only the value itself 'exists' already. If the type is a struct-type, then the children will likely be NULL,
 /// initialised to 0 or another Definition Default of another type
 #define PblStream_T_DefDefault                                                                                         \
-  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = NULL, .file = NULL, .open = NULL, .mode = NULL)
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = NULL, .file = NULL, .open = NULL, .mode = NULL,  \
+                                                 .buffer = NULL)
+
+/// @brief Pbl-managed buffer of a stream that directly operates on the file descriptor - see 'PblStreamOpen'
+struct PblStreamBuffer;
 
 /// @brief Base Struct of PblString - avoid using this type
 struct PblStream_Base {
@@ -68,6 +74,9 @@ struct PblStream_Base {
   PblBool_T *open;
   /// @brief The mode the FILE* was opened
   PblString_T *mode;
+  /// @brief The Pbl-managed buffer, which is used instead of 'file' to read from and write to 'fd'. NULL if the stream
+  /// is a stdio stream
+  struct PblStreamBuffer *buffer;
 };
 
 /// @brief File Stream used to perform I/O actions on a file
@@ -76,22 +85,448 @@ struct PblIOStream { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblStream_Ba
 typedef struct PblIOStream PblIOStream_T;
 
 /// @brief Standard stream for getting input on the default program console
+/// @note This allocates a new stream and its properties on every use - prefer the shared stream 'PblStdin()'
 #define PBL_STREAM_STDIN                                                                                               \
   PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = PblGetUIntT(0), .file = PblGetIOFileT(stdin),    \
                                                  .open = PblGetBoolT(true), .mode = PblGetStringT("a"))
 
 /// @brief Standard stream for outputting to the default program console
+/// @note This allocates a new stream and its properties on every use - prefer the shared stream 'PblStdout()'
 #define PBL_STREAM_STDOUT                                                                                              \
   PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = PblGetUIntT(1), .file = PblGetIOFileT(stdout),   \
                                                  .open = PblGetBoolT(true), .mode = PblGetStringT("a"))
 
 /// @brief Standard stream for outputting error messages to the default program console
+/// @note This allocates a new stream and its properties on every use - prefer the shared stream 'PblStderr()'
 #define PBL_STREAM_STDERR                                                                                              \
   PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = PblGetUIntT(2), .file = PblGetIOFileT(stderr),   \
                                                  .open = PblGetBoolT(true), .mode = PblGetStringT("a"))
 
 // ---- End of Stream Type --------------------------------------------------------------------------------------------
 
+// ---- Buffered Streams ----------------------------------------------------------------------------------------------
+
+/// @brief The size of the Pbl-managed buffer of a stream if no size was passed
+#define PBL_STREAM_DEFAULT_BUFFER_SIZE (64 * 1024)
+
+/// @brief Describes when the Pbl-managed buffer of a stream is written to the file descriptor
+enum PblStreamFlushPolicy {
+  /// @brief The buffer is only flushed once it is full, or if it is flushed explicitly (Default)
+  PBL_STREAM_FLUSH_FULL,
+  /// @brief The buffer is flushed after every write that contains a newline
+  PBL_STREAM_FLUSH_LINE,
+  /// @brief Writes are not buffered and passed directly to the file descriptor
+  PBL_STREAM_FLUSH_NONE
+};
+
+// Creating the overhead and struct type for the Pbl-Function 'PblStreamOpen'
+PBL_CREATE_FUNC_OVERHEAD(PblIOStream_T *, PblStreamOpen,, PblString_T *path, PblString_T *mode, size_t buffer_size,
+                         enum PblStreamFlushPolicy flush, bool single_threaded)
+
+/**
+ * @brief Opens the file at the passed path as a stream, which uses a Pbl-managed buffer on the raw file descriptor
+ * instead of stdio
+ * @param path The path of the file
+ * @param mode The mode the file should be opened with - the same as for fopen ("r", "w", "a", "r+", "w+", "a+"). If
+ * per default "r"
+ * @param buffer_size The size of the buffer in bytes. If per default 'PBL_STREAM_DEFAULT_BUFFER_SIZE'
+ * @param flush The flush policy of the buffer. If per default 'PBL_STREAM_FLUSH_FULL'
+ * @param single_threaded Whether the stream is only used by a single thread, which skips all locking. If per
+ * default false
+ * @return The newly opened stream, or NULL if the file could not be opened (errno is set appropriately)
+ * @note The stream is not closed automatically - use 'PblStreamClose' to write the remaining buffered data
+ */
+#define PblStreamOpen(args...)                                                                                         \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblStreamOpen)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblStreamOpen)){args})
+
+/**
+ * @brief Creates a stream, which uses a Pbl-managed buffer on the passed raw file descriptor instead of stdio
+ * @param fd The file descriptor that should be used (e.g. 1 for stdout)
+ * @param buffer_size The size of the buffer in bytes. If 0, 'PBL_STREAM_DEFAULT_BUFFER_SIZE' is used
+ * @param flush The flush policy of the buffer
+ * @param single_threaded Whether the stream is only used by a single thread, which skips all locking
+ * @return The newly created stream
+ * @note This is a C to Para type conversion function - args are therefore in C
+ */
+PblIOStream_T *PblGetBufferedIOStreamT(int fd, size_t buffer_size, enum PblStreamFlushPolicy flush,
+                                       bool single_threaded);
+
+/**
+ * @brief Reads up to 'len' bytes from the stream into 'dst'
+ * @param stream The stream that should be read from
+ * @param dst The memory the read bytes should be written to
+ * @param len The max. amount of bytes to read
+ * @return The amount of bytes read, which is only less than 'len' if the end of the file was reached or an error
+ * occurred
+ */
+size_t PblStreamRead(PblIOStream_T *stream, void *dst, size_t len);
+
+/**
+ * @brief Writes 'len' bytes from 'src' onto the stream
+ * @param stream The stream that should be written to
+ * @param src The bytes that should be written
+ * @param len The amount of bytes to write
+ * @return The amount of bytes written, which is only less than 'len' if an error occurred
+ */
+size_t PblStreamWrite(PblIOStream_T *stream, const void *src, size_t len);
+
+/**
+ * @brief Writes all buffered data of the stream to its file descriptor
+ * @param stream The stream that should be flushed
+ * @return True if all data was written, else false
+ */
+bool PblStreamFlush(PblIOStream_T *stream);
+
+/**
+ * @brief Flushes and closes the stream
+ * @note This also destroys the lock of the stream, meaning it must not be used by other threads anymore once this is
+ * called. Afterwards, reads, writes and prints on the stream do nothing and return 0 (or false/NULL), and closing it
+ * again does nothing
+ * @param stream The stream that should be closed
+ * @return True if all data was written and the file descriptor was closed, else false
+ */
+bool PblStreamClose(PblIOStream_T *stream);
+
+// ---- End of Buffered Streams ---------------------------------------------------------------------------------------
+
+// ---- Line Reading --------------------------------------------------------------------------------------------------
+
+/// @brief The initial size of the block buffer of a 'PblLineIterator_T' if no size was passed
+#define PBL_LINE_ITERATOR_DEFAULT_BLOCK_SIZE (1024 * 1024)
+
+/// @brief Iterator over the lines of a stream, which reads the stream in large blocks and yields views into its block
+/// buffer, meaning no allocation is done per line
+struct PblLineIterator {
+  /// @brief The stream that is read from
+  PblIOStream_T *stream;
+  /// @brief The block buffer - allocated on the first call of 'PblLineIteratorNext'
+  char *data;
+  /// @brief The size of 'data' in bytes, which is doubled if a single line does not fit into it
+  size_t capacity;
+  /// @brief The index of the first byte of the next line
+  size_t pos;
+  /// @brief The index up to which the bytes after 'pos' were already searched for a newline
+  size_t scanned;
+  /// @brief The end of the read bytes
+  size_t len;
+  /// @brief Whether the end of the stream was reached
+  bool eof;
+};
+typedef struct PblLineIterator PblLineIterator_T;
+
+/**
+ * @brief Reads the next line from the stream
+ * @param stream The stream that should be read from
+ * @return The line without the newline char, or NULL if the end of the stream was reached. If the line is entirely
+ * contained in the buffer of the stream, the string is created directly from the buffer without any copies in between
+ * @note For buffered streams, the newline is searched in the buffer of the stream using memchr (vectorised by the C
+ * library), while stdio streams are read using getline
+ */
+PblString_T *PblReadLine(PblIOStream_T *stream);
+
+/**
+ * @brief Creates an iterator over the lines of the stream
+ * @param stream The stream that should be read from
+ * @param block_size The initial size of the block buffer in bytes. If 0, 'PBL_LINE_ITERATOR_DEFAULT_BLOCK_SIZE' is
+ * used
+ * @return The iterator, which should be advanced using 'PblLineIteratorNext'
+ */
+PblLineIterator_T PblGetLineIterator(PblIOStream_T *stream, size_t block_size);
+
+/**
+ * @brief Reads the next line and writes a view of it into 'line'
+ * @param iter The iterator that should be advanced
+ * @param line The view the line should be written to (without the newline char). The view is only valid until the
+ * next call of this function
+ * @return True if a line was written, false if the end of the stream was reached
+ */
+bool PblLineIteratorNext(PblLineIterator_T *iter, PblStringView_T *line);
+
+// ---- End of Line Reading -------------------------------------------------------------------------------------------
+
+// ---- Stream Transfer -----------------------------------------------------------------------------------------------
+
+/// @brief The length that can be passed to 'PblStreamCopy' to copy until the end of the source stream
+#define PBL_STREAM_COPY_ALL SIZE_MAX
+
+/// @brief The size of the user-space buffer that is used if no zero-copy transfer is possible
+#define PBL_STREAM_COPY_BUFFER_SIZE (1024 * 1024)
+
+/// @brief Describes how the bytes of a 'PblStreamCopy' call were moved
+enum PblStreamCopyPath {
+  /// @brief No bytes were moved
+  PBL_STREAM_COPY_NONE,
+  /// @brief The kernel copied the bytes directly between the files using copy_file_range (zero-copy)
+  PBL_STREAM_COPY_FILE_RANGE,
+  /// @brief The kernel copied the bytes from the file to the destination using sendfile (zero-copy)
+  PBL_STREAM_COPY_SENDFILE,
+  /// @brief The kernel moved the bytes from or into a pipe using splice (zero-copy)
+  PBL_STREAM_COPY_SPLICE,
+  /// @brief The bytes were read into a user-space buffer and written from there
+  PBL_STREAM_COPY_BUFFERED
+};
+
+/// @brief The result of a 'PblStreamCopy' call
+struct PblStreamCopyResult {
+  /// @brief The total amount of bytes written to the destination
+  size_t bytes;
+  /// @brief The path that moved the bytes that were not already buffered in the source stream
+  enum PblStreamCopyPath path;
+  /// @brief The errno value of the failed operation, or 0 if the copy succeeded
+  int error;
+};
+typedef struct PblStreamCopyResult PblStreamCopyResult_T;
+
+/**
+ * @brief Copies up to 'len' bytes from 'src' to 'dst' without passing them through user-space if possible
+ * @param src The stream that should be read from
+ * @param dst The stream that should be written to
+ * @param len The max. amount of bytes to copy, or 'PBL_STREAM_COPY_ALL' to copy until the end of 'src'
+ * @return The amount of bytes copied and the path that was taken. The amount is only less than 'len' if the end of
+ * 'src' was reached or an error occurred, in which case 'error' is set ('EBADF' if one of the streams is closed)
+ * @note If both streams have a file descriptor, copy_file_range, sendfile and splice are tried in this order before
+ * falling back to a loop using a 'PBL_STREAM_COPY_BUFFER_SIZE' buffer. Pending writes of 'dst' are flushed and bytes
+ * already read ahead into the buffer of 'src' are written first, so the order of the data is kept
+ */
+PblStreamCopyResult_T PblStreamCopy(PblIOStream_T *src, PblIOStream_T *dst, size_t len);
+
+/**
+ * @brief Gets the name of the passed copy path, e.g. for logging which path a 'PblStreamCopy' call took
+ * @param path The path
+ * @return The name as a static C string (e.g. "copy_file_range")
+ */
+const char *PblGetStreamCopyPathName(enum PblStreamCopyPath path);
+
+// ---- End of Stream Transfer ----------------------------------------------------------------------------------------
+
+// ---- Vectored Printing ---------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of parts that are gathered and written using a single writev call. If a print consists of
+/// more parts, they are written in multiple calls while the stream stays locked
+#define PBL_PRINT_MAX_PARTS 64
+
+/// @brief The max. length of a single formatted number
+#define PBL_PRINT_MAX_NUMBER_LEN 32
+
+/// @brief Describes how the value of a 'PblPrintArg_T' is printed
+enum PblPrintArgType {
+  /// @brief The bytes 'ptr' with the length 'len' are printed as they are
+  PBL_PRINT_ARG_BYTES,
+  /// @brief The signed integer 'num.i' is printed in decimal
+  PBL_PRINT_ARG_SIGNED,
+  /// @brief The unsigned integer 'num.u' is printed in decimal
+  PBL_PRINT_ARG_UNSIGNED,
+  /// @brief The float 'num.d' is printed with the shortest precision that reads back as the same float
+  PBL_PRINT_ARG_FLOAT,
+  /// @brief The double 'num.d' is printed with the shortest precision that reads back as the same double
+  PBL_PRINT_ARG_DOUBLE,
+  /// @brief The C char 'num.c' is printed as it is
+  PBL_PRINT_ARG_CHAR
+};
+
+/// @brief A single part of a 'PblPrintMany' or 'PblPrintf' call, which references the value instead of copying it
+struct PblPrintArg {
+  /// @brief The type of the value
+  enum PblPrintArgType type;
+  /// @brief The bytes of the value, if the type is 'PBL_PRINT_ARG_BYTES'
+  const char *ptr;
+  /// @brief The length of 'ptr'
+  size_t len;
+  /// @brief The numeric value, if the type is not 'PBL_PRINT_ARG_BYTES'
+  union {
+    long long i;
+    unsigned long long u;
+    double d;
+    char c;
+  } num;
+};
+typedef struct PblPrintArg PblPrintArg_T;
+
+/// @brief Creates a print arg for the content of the passed string
+PblPrintArg_T PblGetPrintArgOfString(PblString_T *val);
+/// @brief Creates a print arg for the passed view, which has to stay valid until the print is done
+PblPrintArg_T PblGetPrintArgOfView(PblStringView_T val);
+/// @brief Creates a print arg for the passed null-terminated C string
+PblPrintArg_T PblGetPrintArgOfCString(const char *val);
+/// @brief Creates a print arg for the passed char, which has to stay valid until the print is done
+PblPrintArg_T PblGetPrintArgOfCharT(PblChar_T *val);
+/// @brief Creates a print arg for the passed bool, which is printed as "true" or "false"
+PblPrintArg_T PblGetPrintArgOfBoolT(PblBool_T *val);
+/// @brief Creates a print arg for the passed short
+PblPrintArg_T PblGetPrintArgOfShortT(PblShort_T *val);
+/// @brief Creates a print arg for the passed unsigned short
+PblPrintArg_T PblGetPrintArgOfUShortT(PblUShort_T *val);
+/// @brief Creates a print arg for the passed int
+PblPrintArg_T PblGetPrintArgOfIntT(PblInt_T *val);
+/// @brief Creates a print arg for the passed unsigned int
+PblPrintArg_T PblGetPrintArgOfUIntT(PblUInt_T *val);
+/// @brief Creates a print arg for the passed long
+PblPrintArg_T PblGetPrintArgOfLongT(PblLong_T *val);
+/// @brief Creates a print arg for the passed unsigned long
+PblPrintArg_T PblGetPrintArgOfULongT(PblULong_T *val);
+/// @brief Creates a print arg for the passed long long
+PblPrintArg_T PblGetPrintArgOfLongLongT(PblLongLong_T *val);
+/// @brief Creates a print arg for the passed unsigned long long
+PblPrintArg_T PblGetPrintArgOfULongLongT(PblULongLong_T *val);
+/// @brief Creates a print arg for the passed size
+PblPrintArg_T PblGetPrintArgOfSizeT(PblSize_T *val);
+/// @brief Creates a print arg for the passed float
+PblPrintArg_T PblGetPrintArgOfFloatT(PblFloat_T *val);
+/// @brief Creates a print arg for the passed double
+PblPrintArg_T PblGetPrintArgOfDoubleT(PblDouble_T *val);
+/// @brief Creates a print arg for the passed C char
+PblPrintArg_T PblGetPrintArgOfChar(char val);
+/// @brief Creates a print arg for the passed C bool, which is printed as "true" or "false"
+PblPrintArg_T PblGetPrintArgOfBool(bool val);
+/// @brief Creates a print arg for the passed signed C integer
+PblPrintArg_T PblGetPrintArgOfSigned(long long val);
+/// @brief Creates a print arg for the passed unsigned C integer
+PblPrintArg_T PblGetPrintArgOfUnsigned(unsigned long long val);
+/// @brief Creates a print arg for the passed C float
+PblPrintArg_T PblGetPrintArgOfFloat(float val);
+/// @brief Creates a print arg for the passed C double
+PblPrintArg_T PblGetPrintArgOfDouble(double val);
+
+#ifdef __cplusplus
+}
+
+// Overloads are used in C++, as _Generic is not available
+inline PblPrintArg_T PblGetPrintArg(PblString_T *val) { return PblGetPrintArgOfString(val); }
+inline PblPrintArg_T PblGetPrintArg(PblStringView_T val) { return PblGetPrintArgOfView(val); }
+inline PblPrintArg_T PblGetPrintArg(const char *val) { return PblGetPrintArgOfCString(val); }
+inline PblPrintArg_T PblGetPrintArg(PblChar_T *val) { return PblGetPrintArgOfCharT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblBool_T *val) { return PblGetPrintArgOfBoolT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblShort_T *val) { return PblGetPrintArgOfShortT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblUShort_T *val) { return PblGetPrintArgOfUShortT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblInt_T *val) { return PblGetPrintArgOfIntT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblUInt_T *val) { return PblGetPrintArgOfUIntT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblLong_T *val) { return PblGetPrintArgOfLongT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblULong_T *val) { return PblGetPrintArgOfULongT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblLongLong_T *val) { return PblGetPrintArgOfLongLongT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblULongLong_T *val) { return PblGetPrintArgOfULongLongT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblSize_T *val) { return PblGetPrintArgOfSizeT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblFloat_T *val) { return PblGetPrintArgOfFloatT(val); }
+inline PblPrintArg_T PblGetPrintArg(PblDouble_T *val) { return PblGetPrintArgOfDoubleT(val); }
+inline PblPrintArg_T PblGetPrintArg(char val) { return PblGetPrintArgOfChar(val); }
+inline PblPrintArg_T PblGetPrintArg(bool val) { return PblGetPrintArgOfBool(val); }
+inline PblPrintArg_T PblGetPrintArg(int val) { return PblGetPrintArgOfSigned(val); }
+inline PblPrintArg_T PblGetPrintArg(long val) { return PblGetPrintArgOfSigned(val); }
+inline PblPrintArg_T PblGetPrintArg(long long val) { return PblGetPrintArgOfSigned(val); }
+inline PblPrintArg_T PblGetPrintArg(unsigned int val) { return PblGetPrintArgOfUnsigned(val); }
+inline PblPrintArg_T PblGetPrintArg(unsigned long val) { return PblGetPrintArgOfUnsigned(val); }
+inline PblPrintArg_T PblGetPrintArg(unsigned long long val) { return PblGetPrintArgOfUnsigned(val); }
+inline PblPrintArg_T PblGetPrintArg(float val) { return PblGetPrintArgOfFloat(val); }
+inline PblPrintArg_T PblGetPrintArg(double val) { return PblGetPrintArgOfDouble(val); }
+
+/// @brief Converts the passed value into a 'PblPrintArg_T' based on its type
+#define PBL_PRINT_ARG(val) PblGetPrintArg(val)
+
+extern "C" {
+#else
+/// @brief Converts the passed value into a 'PblPrintArg_T' based on its type
+#define PBL_PRINT_ARG(val)                                                                                             \
+  _Generic((val),                                                                                                      \
+    PblString_T *: PblGetPrintArgOfString,                                                                             \
+    PblStringView_T: PblGetPrintArgOfView,                                                                             \
+    char *: PblGetPrintArgOfCString,                                                                                   \
+    const char *: PblGetPrintArgOfCString,                                                                             \
+    PblChar_T *: PblGetPrintArgOfCharT,                                                                                \
+    PblBool_T *: PblGetPrintArgOfBoolT,                                                                                \
+    PblShort_T *: PblGetPrintArgOfShortT,                                                                              \
+    PblUShort_T *: PblGetPrintArgOfUShortT,                                                                            \
+    PblInt_T *: PblGetPrintArgOfIntT,                                                                                  \
+    PblUInt_T *: PblGetPrintArgOfUIntT,                                                                                \
+    PblLong_T *: PblGetPrintArgOfLongT,                                                                                \
+    PblULong_T *: PblGetPrintArgOfULongT,                                                                              \
+    PblLongLong_T *: PblGetPrintArgOfLongLongT,                                                                        \
+    PblULongLong_T *: PblGetPrintArgOfULongLongT,                                                                      \
+    PblSize_T *: PblGetPrintArgOfSizeT,                                                                                \
+    PblFloat_T *: PblGetPrintArgOfFloatT,                                                                              \
+    PblDouble_T *: PblGetPrintArgOfDoubleT,                                                                            \
+    char: PblGetPrintArgOfChar,                                                                                        \
+    bool: PblGetPrintArgOfBool,                                                                                        \
+    signed char: PblGetPrintArgOfSigned,                                                                               \
+    short: PblGetPrintArgOfSigned,                                                                                     \
+    int: PblGetPrintArgOfSigned,                                                                                       \
+    long: PblGetPrintArgOfSigned,                                                                                      \
+    long long: PblGetPrintArgOfSigned,                                                                                 \
+    unsigned char: PblGetPrintArgOfUnsigned,                                                                           \
+    unsigned short: PblGetPrintArgOfUnsigned,                                                                          \
+    unsigned int: PblGetPrintArgOfUnsigned,                                                                            \
+    unsigned long: PblGetPrintArgOfUnsigned,                                                                           \
+    unsigned long long: PblGetPrintArgOfUnsigned,                                                                      \
+    float: PblGetPrintArgOfFloat,                                                                                      \
+    double: PblGetPrintArgOfDouble)(val)
+#endif
+
+/**
+ * @brief Formats the numeric value of the print arg into 'dst' without allocating
+ * @param arg The arg that should be formatted
+ * @param dst The memory the number should be written to, which has to be at least 'PBL_PRINT_MAX_NUMBER_LEN' bytes
+ * @return The length of the formatted number, or 0 if the arg is of the type 'PBL_PRINT_ARG_BYTES'
+ */
+size_t PblFormatPrintArgNumber(const PblPrintArg_T *arg, char *dst);
+
+/// @brief Converts a single item of the args of 'PblPrintMany' or 'PblPrintf' into an item of the args array
+#define PBL_PRINT_ARG_ITEM(val) PBL_PRINT_ARG(val),
+
+/**
+ * @brief Writes all passed args as a single vectored write onto the stream
+ * @param stream The stream that should be written to
+ * @param args The args that should be written in order
+ * @param amount The amount of args
+ * @return The amount of bytes written
+ * @note Use the macro 'PblPrintMany' instead of calling this directly
+ */
+size_t PblPrintArgs(PblIOStream_T *stream, const PblPrintArg_T *args, size_t amount);
+
+/**
+ * @brief Formats the passed args into the format string and writes the result as a single vectored write onto the
+ * stream
+ * @param stream The stream that should be written to
+ * @param format The format string, where every "{}" is replaced by the next arg. "{{" and "}}" are written as "{"
+ * and "}". If there are less args than placeholders, the remaining placeholders are written as they are
+ * @param args The args that should be formatted
+ * @param amount The amount of args
+ * @return The amount of bytes written
+ * @note Use the macro 'PblPrintf' instead of calling this directly
+ */
+size_t PblPrintFormatArgs(PblIOStream_T *stream, const char *format, const PblPrintArg_T *args, size_t amount);
+
+/**
+ * @brief Prints all passed values onto the stream using a single vectored write (writev). No separator or end char is
+ * added
+ * @param stream The stream that should be written to
+ * @param args The values that should be printed - Pbl strings, views, chars, bools and numbers, as well as C strings,
+ * chars, bools and numbers are supported. Numbers are formatted on the stack without allocating
+ * @return The amount of bytes written
+ * @note Buffered streams (stdio or Pbl-managed) copy the parts into their buffer instead if they fit, since the
+ * buffer already turns them into a single write. Unbuffered stdio streams are flushed before the vectored write
+ */
+#define PblPrintMany(stream, args...)                                                                                  \
+  ({                                                                                                                   \
+    PblPrintArg_T pbl_print_args[] = {PBL_APPLY_MACRO(PBL_PRINT_ARG_ITEM, args)};                                      \
+    PblPrintArgs(stream, pbl_print_args, sizeof(pbl_print_args) / sizeof(PblPrintArg_T));                              \
+  })
+
+/**
+ * @brief Formats the passed values into the format string and prints the result onto the stream using a single
+ * vectored write (writev)
+ * @param stream The stream that should be written to
+ * @param format The format string as a C string, where every "{}" is replaced by the next value
+ * @param args The values that should be formatted - the same types as for 'PblPrintMany' are supported
+ * @return The amount of bytes written
+ */
+#define PblPrintf(stream, format, args...)                                                                             \
+  IFNE(args)                                                                                                           \
+  (({                                                                                                                  \
+     PblPrintArg_T pbl_print_args[] = {PBL_APPLY_MACRO(PBL_PRINT_ARG_ITEM, args)};                                     \
+     PblPrintFormatArgs(stream, format, pbl_print_args, sizeof(pbl_print_args) / sizeof(PblPrintArg_T));               \
+   }),                                                                                                                 \
+   PblPrintFormatArgs(stream, format, NULL, 0))
+
+// ---- End of Vectored Printing --------------------------------------------------------------------------------------
+
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
 /**
@@ -111,6 +546,27 @@ PblIOFile_T *PblGetIOFileT(FILE *val);
  */
 PblIOStream_T *PblGetIOStreamT(int fd, const char *mode);
 
+/**
+ * @brief Gets the process-wide standard input stream
+ * @return The shared stream, which is created on the first call and must not be modified or closed
+ * @note This function is thread-safe
+ */
+PblIOStream_T *PblStdin(void);
+
+/**
+ * @brief Gets the process-wide standard output stream, which is used per default by 'PblPrint'
+ * @return The shared stream, which is created on the first call and must not be modified or closed
+ * @note This function is thread-safe
+ */
+PblIOStream_T *PblStdout(void);
+
+/**
+ * @brief Gets the process-wide standard error stream
+ * @return The shared stream, which is created on the first call and must not be modified or closed
+ * @note This function is thread-safe
+ */
+PblIOStream_T *PblStderr(void);
+
 // Creating the overhead and struct type for the Pbl-Function 'PblPrint'
 PBL_CREATE_FUNC_OVERHEAD(PblString_T *, PblInput,, PblString_T *display_msg, PblChar_T* end)
 
@@ -148,6 +604,19 @@ PBL_CREATE_FUNC_OVERHEAD(__attribute__((unused)) PblVoid_T, PblPrint,, PblString
 #define PblPrint(args...) \
   PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblPrint)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblPrint)){args})
 
+// Creating the overhead and struct type for the Pbl-Function 'PblPrintTraceback'
+PBL_CREATE_FUNC_OVERHEAD(bool, PblPrintTraceback,, PblFunctionCallMetaData_T *ctx, PblIOStream_T *stream)
+
+/**
+ * @brief Prints the traceback of the exception the passed ctx failed with using a single write - see
+ * 'PblFormatTraceback'
+ * @param ctx The ctx that failed, e.g. the ctx of the function that caught the exception (Required)
+ * @param stream The stream it should be printed onto. If per default NULL, which uses the shared stream 'PblStderr()'
+ * @return True if the ctx failed and the traceback was printed
+ */
+#define PblPrintTraceback(args...)                                                                                     \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblPrintTraceback)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblPrintTraceback)){args})
+
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
 #ifdef __cplusplus
@@ -0,0 +1,142 @@
+/// @file pbl-log.h
+/// @brief Asynchronous logging, where every thread writes its records into its own lock-free ring buffer, which a
+/// background thread drains in large batches onto the target stream
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-io.h"
+#include "../types/pbl-string.h"
+#include "../types/pbl-types.h"
+#include "../func/pbl-function.h"
+
+#ifndef PBL_MODULES_LOG_H
+#define PBL_MODULES_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Logger Configuration ------------------------------------------------------------------------------------------
+
+/// @brief The size of the ring buffer of every thread in bytes if no size was passed
+#define PBL_LOG_DEFAULT_RING_SIZE (64 * 1024)
+
+/// @brief The size of the batch buffer of the background thread in bytes if no size was passed
+#define PBL_LOG_DEFAULT_BATCH_SIZE (256 * 1024)
+
+/// @brief The max. time in milliseconds a record stays in a ring buffer before it is written, if no interval was passed
+#define PBL_LOG_DEFAULT_FLUSH_INTERVAL_MS 10
+
+/// @brief Describes what happens to a record if the ring buffer of the thread is full
+enum PblLogOverflowPolicy {
+  /// @brief The record is dropped and counted in 'records_dropped', which never blocks the logging thread (Default)
+  PBL_LOG_OVERFLOW_DROP,
+  /// @brief The logging thread wakes the background thread and waits until there is enough space (backpressure)
+  PBL_LOG_OVERFLOW_BLOCK
+};
+
+/// @brief The counters of the logger, which are summed up over all threads
+struct PblLogStats {
+  /// @brief The amount of records that were accepted into a ring buffer
+  uint64_t records_logged;
+  /// @brief The amount of records that were dropped, as the ring buffer was full, the record was larger than the ring
+  /// buffer or the logger was not running
+  uint64_t records_dropped;
+  /// @brief The amount of bytes written onto the stream
+  uint64_t bytes_written;
+  /// @brief The amount of batches written onto the stream
+  uint64_t batches_written;
+};
+typedef struct PblLogStats PblLogStats_T;
+
+// ---- End of Logger Configuration -----------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblLogStart'
+PBL_CREATE_FUNC_OVERHEAD(bool, PblLogStart,, PblIOStream_T *stream, size_t ring_size, size_t batch_size,
+                         unsigned int flush_interval_ms, enum PblLogOverflowPolicy overflow)
+
+/**
+ * @brief Starts the background thread of the logger
+ * @param stream The stream the records are written to. If per default 'PblStderr()'
+ * @param ring_size The size of the ring buffer of every thread in bytes, which is rounded up to a power of two. Only
+ * applies to threads that log for the first time. If per default 'PBL_LOG_DEFAULT_RING_SIZE'
+ * @param batch_size The size of the batch, which the background thread collects before writing it. If per default
+ * 'PBL_LOG_DEFAULT_BATCH_SIZE'
+ * @param flush_interval_ms The max. time a record stays in a ring buffer before it is written. If per default
+ * 'PBL_LOG_DEFAULT_FLUSH_INTERVAL_MS'
+ * @param overflow The policy for records that do not fit into the ring buffer. If per default 'PBL_LOG_OVERFLOW_DROP'
+ * @return True if the logger was started, false if it is already running or the thread could not be created
+ * @note The background thread never allocates using the garbage collector, so it does not have to be registered
+ */
+#define PblLogStart(args...)                                                                                           \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblLogStart)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblLogStart)){args})
+
+/**
+ * @brief Writes all pending records and stops the background thread of the logger
+ * @note New records are rejected first, and records that other threads are logging at the same time are either
+ * rejected or written, meaning no accepted record stays in a ring buffer
+ * @return True if the logger was stopped, false if it was not running
+ */
+bool PblLogStop(void);
+
+/**
+ * @brief Waits until all records that were logged before this call are written onto the stream
+ * @return True if the records were written, false if the logger is not running
+ */
+bool PblLogFlush(void);
+
+/**
+ * @brief Gets the counters of the logger
+ * @return The counters summed up over all threads
+ */
+PblLogStats_T PblLogGetStats(void);
+
+/**
+ * @brief Logs the passed bytes as a single record, which is written as one line
+ * @param ptr The bytes of the record (without a newline, which is added automatically)
+ * @param len The length of the record
+ * @return True if the record was accepted, false if it was dropped
+ * @note This never locks or allocates, unless it is the first record of the thread, which allocates its ring buffer
+ */
+bool PblLogBytes(const char *ptr, size_t len);
+
+/**
+ * @brief Logs the passed string as a single record, which is written as one line
+ * @param record The record (without a newline, which is added automatically)
+ * @return True if the record was accepted, false if it was dropped
+ */
+bool PblLog(PblString_T *record);
+
+/**
+ * @brief Formats the passed args directly into the ring buffer of the thread as a single record
+ * @param args The args of the record
+ * @param amount The amount of args
+ * @return True if the record was accepted, false if it was dropped
+ * @note Use the macro 'PblLogMany' instead of calling this directly
+ */
+bool PblLogArgs(const PblPrintArg_T *args, size_t amount);
+
+/**
+ * @brief Formats the passed values directly into the ring buffer of the thread as a single record
+ * @param args The values of the record - the same types as for 'PblPrintMany' are supported
+ * @return True if the record was accepted, false if it was dropped
+ */
+#define PblLogMany(args...)                                                                                            \
+  ({                                                                                                                   \
+    PblPrintArg_T pbl_log_args[] = {PBL_APPLY_MACRO(PBL_PRINT_ARG_ITEM, args)};                                        \
+    PblLogArgs(pbl_log_args, sizeof(pbl_log_args) / sizeof(PblPrintArg_T));                                           \
+  })
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_LOG_H
@@ -0,0 +1,147 @@
+/// @file pbl-mmap.h
+/// @brief Read-only memory-mapped files, which expose the content of a file without copying it into the heap
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "../types/pbl-string.h"
+#include "../types/pbl-types.h"
+#include "../func/pbl-function.h"
+
+#ifndef PBL_MODULES_MMAP_H
+#define PBL_MODULES_MMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Mapped File Type ----------------------------------------------------------------------------------------------
+
+/// @brief No special access pattern is expected
+#define PBL_MAP_ADVICE_NORMAL 0
+/// @brief The mapping is read sequentially, which lets the kernel read ahead aggressively and drop read pages early
+#define PBL_MAP_ADVICE_SEQUENTIAL (1 << 0)
+/// @brief The mapping will be accessed soon, which lets the kernel start reading it in the background
+#define PBL_MAP_ADVICE_WILLNEED (1 << 1)
+/// @brief The mapping should be backed by transparent huge pages where possible (Linux only - silently ignored if not
+/// supported by the kernel or the file system)
+#define PBL_MAP_ADVICE_HUGEPAGE (1 << 2)
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblMappedFile_T' in bytes
+#define PblMappedFile_T_Size (sizeof(int) + sizeof(size_t) + sizeof(const char *) + sizeof(unsigned int))
+/// @brief Returns the declaration default for the type 'PblMappedFile_T'
+#define PblMappedFile_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblMappedFile_T)
+/// @brief Returns the definition default for the type 'PblMappedFile_T', where the file has not been opened yet
+#define PblMappedFile_T_DefDefault                                                                                     \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblMappedFile_T, .fd = -1, .size = 0, .data = NULL,                   \
+                                                 .advice = PBL_MAP_ADVICE_NORMAL)
+
+/// @brief Base Struct of PblMappedFile - avoid using this type
+struct PblMappedFile_Base {
+  /// @brief The file descriptor of the mapped file, which is kept open for mapping chunks. -1 if the file was unmapped
+  int fd;
+  /// @brief The size of the file in bytes at the time it was mapped
+  size_t size;
+  /// @brief The mapping of the entire file - NULL if the file is empty or only mapped in chunks
+  const char *data;
+  /// @brief The 'PBL_MAP_ADVICE_*' flags that are applied to every mapping of the file
+  unsigned int advice;
+};
+
+/// @brief Read-only memory-mapped file
+struct PblMappedFile { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblMappedFile_Base) };
+/// @brief Read-only memory-mapped file
+typedef struct PblMappedFile PblMappedFile_T;
+
+/// @brief Iterator over a mapped file, which only maps one chunk of the file at a time, so files larger than the
+/// available address space can be processed as well
+struct PblMappedChunkIter {
+  /// @brief The file that is iterated over
+  PblMappedFile_T *file;
+  /// @brief The max. size of a chunk in bytes - always a multiple of the page size
+  size_t chunk_size;
+  /// @brief Whether chunks should end after the last newline they contain, so no line is split between two chunks
+  bool split_at_newline;
+  /// @brief The offset in the file where the next chunk starts
+  size_t offset;
+  /// @brief The currently mapped window, which is unmapped when the iterator is advanced
+  void *window;
+  /// @brief The size of 'window' in bytes
+  size_t window_len;
+};
+typedef struct PblMappedChunkIter PblMappedChunkIter_T;
+
+// ---- End of Mapped File Type ---------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblMapFile'
+PBL_CREATE_FUNC_OVERHEAD(PblMappedFile_T *, PblMapFile,, PblString_T *path, unsigned int advice, bool chunked)
+
+/**
+ * @brief Maps the file at the passed path read-only into memory
+ * @param path The path of the file
+ * @param advice The 'PBL_MAP_ADVICE_*' flags describing how the mapping will be accessed. If per default
+ * 'PBL_MAP_ADVICE_NORMAL'
+ * @param chunked If true, the file is only opened and not mapped as a whole, meaning it may only be accessed using
+ * 'PblGetMappedChunkIter'. This is required for files larger than the available address space. If per default false
+ * @return The mapped file, or NULL if the file could not be opened or mapped (errno is set appropriately)
+ * @note The mapping is not released automatically - use 'PblUnmapFile' to release it
+ */
+#define PblMapFile(args...)                                                                                            \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblMapFile)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblMapFile)){args})
+
+/**
+ * @brief Gets a view of the entire content of the mapped file
+ * @param file The mapped file
+ * @return The view, which is valid until the file is unmapped. Empty for chunked files
+ */
+PblStringView_T PblGetMappedFileView(PblMappedFile_T *file);
+
+/**
+ * @brief Releases the mapping and closes the file
+ * @param file The mapped file
+ * @return True if the file was unmapped and closed successfully, else false
+ * @note All views of the file are invalid afterwards
+ */
+bool PblUnmapFile(PblMappedFile_T *file);
+
+/**
+ * @brief Creates an iterator, which maps the file chunk by chunk
+ * @param file The mapped file, which may have been mapped using 'chunked'
+ * @param chunk_size The max. size of a chunk in bytes, which is rounded up to a multiple of the page size
+ * @param split_at_newline Whether chunks should end after the last newline they contain. A chunk only ends without
+ * newline if a single line is longer than the chunk size
+ * @return The iterator, which should be advanced using 'PblMappedChunkIterNext' and closed using
+ * 'PblMappedChunkIterClose'
+ */
+PblMappedChunkIter_T PblGetMappedChunkIter(PblMappedFile_T *file, size_t chunk_size, bool split_at_newline);
+
+/**
+ * @brief Unmaps the previous chunk and maps the next one
+ * @param iter The iterator that should be advanced
+ * @param chunk The view the chunk should be written to, which is only valid until the next call of this function
+ * @return True if a chunk was written, false if the end of the file was reached or the mapping failed
+ */
+bool PblMappedChunkIterNext(PblMappedChunkIter_T *iter, PblStringView_T *chunk);
+
+/**
+ * @brief Unmaps the current chunk of the iterator, which is required if the iteration is stopped before
+ * 'PblMappedChunkIterNext' returned false
+ * @param iter The iterator that should be closed
+ * @note The view of the current chunk is invalid afterwards. Closing an iterator twice or after it reached the end of
+ * the file has no effect
+ */
+void PblMappedChunkIterClose(PblMappedChunkIter_T *iter);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_MMAP_H
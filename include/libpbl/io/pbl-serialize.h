@@ -0,0 +1,221 @@
+/// @file pbl-serialize.h
+/// @brief Compact binary serialisation of Pbl values, which is driven by type descriptors and uses varints for all
+/// integers and length prefixes
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-io.h"
+#include "../mem/pbl-arena.h"
+#include "../types/pbl-any.h"
+#include "../types/pbl-string.h"
+#include "../types/pbl-types.h"
+#include "../func/pbl-function.h"
+
+#ifndef PBL_MODULES_SERIALIZE_H
+#define PBL_MODULES_SERIALIZE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Serial Types --------------------------------------------------------------------------------------------------
+
+/// @brief The max. nesting depth of a decoded value, which protects against malicious input nesting 'PblAny_T' values
+#define PBL_SERIAL_MAX_DEPTH 64
+
+/// @brief The max. amount of types that can be registered for decoding 'PblAny_T' values
+#define PBL_SERIAL_MAX_REGISTERED_TYPES 256
+
+/// @brief Describes how a value is encoded
+/// @note The wire format of every kind:
+/// - Signed integers: zigzag-encoded varint
+/// - Unsigned integers and sizes: varint
+/// - Bools: a single byte, which is either 0 or 1
+/// - Floats and doubles: 4 and 8 bytes in little-endian
+/// - Strings and string views: varint length followed by the bytes
+/// - Any: varint length and bytes of the type name, followed by the value (a name length of 0 means no value)
+/// - Structs: a varint field number (index + 1) followed by the value for every field that is not NULL, which is
+///   terminated by a field number of 0
+enum PblSerialKind {
+  PBL_SERIAL_BOOL,
+  PBL_SERIAL_CHAR,
+  PBL_SERIAL_UCHAR,
+  PBL_SERIAL_SHORT,
+  PBL_SERIAL_USHORT,
+  PBL_SERIAL_INT,
+  PBL_SERIAL_UINT,
+  PBL_SERIAL_LONG,
+  PBL_SERIAL_ULONG,
+  PBL_SERIAL_LONG_LONG,
+  PBL_SERIAL_ULONG_LONG,
+  PBL_SERIAL_SIZE,
+  PBL_SERIAL_FLOAT,
+  PBL_SERIAL_DOUBLE,
+  /// @brief 'PblString_T'
+  PBL_SERIAL_STRING,
+  /// @brief 'PblStringView_T', which is decoded without copying if the input is a byte buffer
+  PBL_SERIAL_STRING_VIEW,
+  /// @brief 'PblAny_T', whose value type has to be registered using 'PblSerialRegisterType'
+  PBL_SERIAL_ANY,
+  /// @brief A Pbl struct type, whose properties are pointers to other Pbl values
+  PBL_SERIAL_STRUCT
+};
+
+struct PblSerialType;
+
+/// @brief Describes a property of a Pbl struct type, which is a pointer to another Pbl value
+struct PblSerialField {
+  /// @brief The name of the property
+  const char *name;
+  /// @brief The offset of the pointer inside the struct
+  size_t offset;
+  /// @brief The type of the value the pointer points to
+  const struct PblSerialType *type;
+};
+typedef struct PblSerialField PblSerialField_T;
+
+/// @brief Type descriptor, which extends 'PblType_T' by the layout that is required to encode and decode the type
+struct PblSerialType {
+  /// @brief The Pbl type, whose name identifies the type inside encoded 'PblAny_T' values. As this is the first
+  /// property, a pointer to the descriptor may be used as 'PblType_T *' (e.g. for 'PblGetAnyT')
+  PblType_T type;
+  /// @brief How the value is encoded
+  enum PblSerialKind kind;
+  /// @brief The properties of a struct type, which are encoded in this order - NULL for other kinds
+  const PblSerialField_T *fields;
+  /// @brief The amount of properties
+  size_t fields_len;
+};
+typedef struct PblSerialType PblSerialType_T;
+
+/// @brief The result of decoding a value
+enum PblSerialError {
+  /// @brief The value was decoded
+  PBL_SERIAL_OK,
+  /// @brief The input ended before the value was complete
+  PBL_SERIAL_ERR_TRUNCATED,
+  /// @brief The input is malformed, e.g. an overlong varint, a value out of range or an unknown field number
+  PBL_SERIAL_ERR_INVALID,
+  /// @brief An encoded 'PblAny_T' value has a type that was not registered
+  PBL_SERIAL_ERR_UNKNOWN_TYPE
+};
+
+/// @brief Descriptors of the built-in types, which are registered by default
+extern const PblSerialType_T PBL_SERIAL_TYPE_BOOL;
+extern const PblSerialType_T PBL_SERIAL_TYPE_CHAR;
+extern const PblSerialType_T PBL_SERIAL_TYPE_UCHAR;
+extern const PblSerialType_T PBL_SERIAL_TYPE_SHORT;
+extern const PblSerialType_T PBL_SERIAL_TYPE_USHORT;
+extern const PblSerialType_T PBL_SERIAL_TYPE_INT;
+extern const PblSerialType_T PBL_SERIAL_TYPE_UINT;
+extern const PblSerialType_T PBL_SERIAL_TYPE_LONG;
+extern const PblSerialType_T PBL_SERIAL_TYPE_ULONG;
+extern const PblSerialType_T PBL_SERIAL_TYPE_LONG_LONG;
+extern const PblSerialType_T PBL_SERIAL_TYPE_ULONG_LONG;
+extern const PblSerialType_T PBL_SERIAL_TYPE_SIZE;
+extern const PblSerialType_T PBL_SERIAL_TYPE_FLOAT;
+extern const PblSerialType_T PBL_SERIAL_TYPE_DOUBLE;
+extern const PblSerialType_T PBL_SERIAL_TYPE_STRING;
+extern const PblSerialType_T PBL_SERIAL_TYPE_STRING_VIEW;
+extern const PblSerialType_T PBL_SERIAL_TYPE_ANY;
+
+/// @brief Describes the property 'field' of the Pbl struct type 'struct_type' for 'PBL_SERIAL_STRUCT_TYPE'
+/// @param struct_type The Pbl struct type (e.g. 'Point_T')
+/// @param field The name of the property inside '.actual'
+/// @param field_type The 'PblSerialType_T' of the value the property points to
+#define PBL_SERIAL_FIELD(struct_type, field, field_type)                                                               \
+  { .name = #field, .offset = offsetof(struct_type, actual.field), .type = &(field_type) }
+
+/// @brief Initialiser of the descriptor of a Pbl struct type
+/// @param struct_type The Pbl struct type (e.g. 'Point_T')
+/// @param type_name The unique name of the type, which identifies it inside 'PblAny_T' values
+/// @param field_array A static array of 'PblSerialField_T', which was created using 'PBL_SERIAL_FIELD'
+#define PBL_SERIAL_STRUCT_TYPE(struct_type, type_name, field_array)                                                    \
+  {                                                                                                                    \
+    .type = {.actual_size = sizeof(struct_type), .usable_size = sizeof(struct_type) - sizeof(PblVarMetaData_T),        \
+             .type_template = NULL, .name = (type_name), .user_defined = true, .definable = true},                     \
+    .kind = PBL_SERIAL_STRUCT, .fields = (field_array), .fields_len = sizeof(field_array) / sizeof(PblSerialField_T)   \
+  }
+
+// ---- End of Serial Types -------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+/**
+ * @brief Registers the passed type, so 'PblAny_T' values of this type can be decoded. The built-in types are
+ * registered by default
+ * @param type The descriptor, which must stay valid for the rest of the program (e.g. a static variable)
+ * @return True if the type was registered or was already registered, false if the name is used by another type or
+ * 'PBL_SERIAL_MAX_REGISTERED_TYPES' was reached
+ */
+bool PblSerialRegisterType(const PblSerialType_T *type);
+
+/**
+ * @brief Encodes the passed value and writes it onto the stream
+ * @param stream The stream that should be written to
+ * @param type The type of the value
+ * @param value The Pbl value (e.g. a 'PblInt_T *')
+ * @return True if the value was written entirely
+ * @note The value is encoded into a stack buffer first, so the stream receives few large writes
+ */
+bool PblSerialize(PblIOStream_T *stream, const PblSerialType_T *type, const void *value);
+
+/**
+ * @brief Encodes the passed value into a new byte buffer
+ * @param type The type of the value
+ * @param value The Pbl value (e.g. a 'PblInt_T *')
+ * @param len Is set to the length of the encoded value
+ * @return The encoded bytes
+ */
+char *PblSerializeToBytes(const PblSerialType_T *type, const void *value, size_t *len);
+
+// Creating the overhead and struct type for the Pbl-Function 'PblDeserialize'
+PBL_CREATE_FUNC_OVERHEAD(void *, PblDeserialize,, PblIOStream_T *stream, const PblSerialType_T *type,
+                         PblArena_T *arena, enum PblSerialError *error)
+
+/**
+ * @brief Decodes a single value from the stream, which only reads the bytes of the value, so several values can be
+ * decoded one after another
+ * @param stream The stream that should be read from (Required)
+ * @param type The type of the value (Required)
+ * @param arena The arena the decoded values are allocated in. If per default NULL, which uses the garbage collector
+ * @param error Is set to the result of decoding if it is not NULL. If per default NULL
+ * @return The decoded Pbl value, or NULL if the input is invalid
+ * @note Values decoded into an arena must not be written to or deallocated (e.g. strings or 'PblAny_T' values), as
+ * their memory can only be released together with the arena
+ */
+#define PblDeserialize(args...)                                                                                        \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblDeserialize)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblDeserialize)){args})
+
+// Creating the overhead and struct type for the Pbl-Function 'PblDeserializeBytes'
+PBL_CREATE_FUNC_OVERHEAD(void *, PblDeserializeBytes,, const void *data, size_t len, const PblSerialType_T *type,
+                         PblArena_T *arena, size_t *consumed, enum PblSerialError *error)
+
+/**
+ * @brief Decodes a single value from the passed bytes. String views point directly into the bytes instead of copying
+ * them, so the bytes must stay valid as long as the views are used
+ * @param data The encoded bytes (Required)
+ * @param len The amount of encoded bytes
+ * @param type The type of the value (Required)
+ * @param arena The arena the decoded values are allocated in. If per default NULL, which uses the garbage collector
+ * @param consumed Is set to the amount of bytes the value was encoded in if it is not NULL. If per default NULL
+ * @param error Is set to the result of decoding if it is not NULL. If per default NULL
+ * @return The decoded Pbl value, or NULL if the input is invalid
+ * @note Values decoded into an arena must not be written to or deallocated (e.g. strings or 'PblAny_T' values), as
+ * their memory can only be released together with the arena
+ */
+#define PblDeserializeBytes(args...)                                                                                   \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblDeserializeBytes)                                                                \
+  ((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblDeserializeBytes)){args})
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_SERIALIZE_H
@@ -0,0 +1,110 @@
+/// @file pbl-arena.h
+/// @brief Arena allocator, which hands out memory from large blocks using a bump pointer and releases all of it at once
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+#pragma once
+
+// General Required Header Inclusion
+#include "./pbl-mem.h"
+#include "../types/pbl-types.h"
+#include "../func/pbl-function.h"
+
+#ifndef PBL_MODULES_ARENA_H
+#define PBL_MODULES_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Arena Type ----------------------------------------------------------------------------------------------------
+
+/// @brief The size of a block of an arena in bytes if no size was passed
+#define PBL_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/// @brief The alignment of every allocation of an arena
+#define PBL_ARENA_ALIGNMENT 16
+
+/// @brief Block of an arena - see 'PblArenaAlloc'
+struct PblArenaBlock;
+
+/// @brief (Never use this for malloc - this only indicates the usable memory space)
+/// @returns The size of the type 'PblArena_T' in bytes
+#define PblArena_T_Size (sizeof(struct PblArenaBlock *) + sizeof(size_t) * 2)
+/// @brief Returns the declaration default for the type 'PblArena_T'
+#define PblArena_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblArena_T)
+/// @brief Returns the definition default for the type 'PblArena_T', which does not own any block yet
+#define PblArena_T_DefDefault                                                                                          \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblArena_T, .blocks = NULL,                                           \
+                                                 .block_size = PBL_ARENA_DEFAULT_BLOCK_SIZE, .allocated = 0)
+
+/// @brief Base Struct of PblArena - avoid using this type
+struct PblArena_Base {
+  /// @brief The blocks of the arena, where the first block is the one that is currently allocated from
+  struct PblArenaBlock *blocks;
+  /// @brief The size of a regular block in bytes. Larger allocations get a block of their own
+  size_t block_size;
+  /// @brief The amount of bytes handed out since the arena was created or reset
+  size_t allocated;
+};
+
+/// @brief Arena allocator, whose allocations all share the lifetime of the arena
+/// @note The blocks are scanned by the garbage collector, so allocations may contain references to other memory
+struct PblArena { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblArena_Base) };
+/// @brief Arena allocator, whose allocations all share the lifetime of the arena
+typedef struct PblArena PblArena_T;
+
+// ---- End of Arena Type ---------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+// Creating the overhead and struct type for the Pbl-Function 'PblArenaCreate'
+PBL_CREATE_FUNC_OVERHEAD(PblArena_T *, PblArenaCreate,, size_t block_size)
+
+/**
+ * @brief Creates a new arena, which allocates its first block on the first allocation
+ * @param block_size The size of a regular block in bytes. If per default 'PBL_ARENA_DEFAULT_BLOCK_SIZE'
+ * @return The new arena
+ */
+#define PblArenaCreate(args...)                                                                                        \
+  PBL_GET_FUNC_OVERHEAD_IDENTIFIER(PblArenaCreate)((struct PBL_GET_FUNC_ARGS_IDENTIFIER(PblArenaCreate)){args})
+
+/**
+ * @brief Allocates zeroed memory from the arena
+ * @param arena The arena
+ * @param size The size of the allocation in bytes
+ * @return The allocated memory, which is aligned to 'PBL_ARENA_ALIGNMENT'
+ * @note The memory can not be freed or resized on its own, as it is only released together with the arena
+ */
+void *PblArenaAlloc(PblArena_T *arena, size_t size);
+
+/**
+ * @brief Copies the passed bytes into the arena
+ * @param arena The arena
+ * @param src The bytes that should be copied
+ * @param len The amount of bytes
+ * @return The copy, which is followed by a null char
+ */
+char *PblArenaCopyBytes(PblArena_T *arena, const void *src, size_t len);
+
+/**
+ * @brief Releases all allocations of the arena at once, while keeping the first block for reuse
+ * @param arena The arena
+ * @note All memory previously returned by the arena is invalid afterwards
+ */
+void PblArenaReset(PblArena_T *arena);
+
+/**
+ * @brief Releases all blocks and the arena itself
+ * @param arena The arena
+ */
+void PblArenaDestroy(PblArena_T *arena);
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//PBL_MODULES_ARENA_H
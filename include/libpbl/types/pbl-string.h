@@ -11,8 +11,10 @@
 // Including the base <string.h> which this header intends to implement
 #ifdef __cplusplus
 # include <cstring>
+# include <cstdint>
 #else
 # include <string.h>
+# include <stdint.h>
 #endif
 
 // General Required Header Inclusion
@@ -28,13 +30,26 @@ extern "C" {
 // ---- Declaration ---------------------------------------------------------------------------------------------------
 
 /// @brief Size of the type 'PblString_T' in bytes
-#define PblString_T_Size (sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *))
+#define PblString_T_Size                                                                                               \
+  (sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *) + sizeof(char *) +                 \
+   sizeof(uint64_t) + sizeof(bool) + sizeof(bool) + sizeof(uint8_t))
 /// @brief Returns the declaration default for the type 'PblString_T'
 #define PblString_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblString_T)
 /// @brief Returns the definition default for the type 'PblString_T', where the children have not been set yet and
 /// only the value itself 'exists' already.
 #define PblString_T_DefDefault                                                                                         \
-  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblString_T, .allocated_len = NULL, .len = NULL, .str = NULL)
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblString_T, .allocated_len = NULL, .len = NULL, .str = NULL,         \
+                                                 .c_str = NULL, .hash = 0, .hash_cached = false, .interned = false,    \
+                                                 .utf8_state = PBL_STRING_UTF8_UNKNOWN)
+
+/// @brief The content of the string was not classified yet
+#define PBL_STRING_UTF8_UNKNOWN 0
+/// @brief The content of the string only consists of ASCII chars (and is therefore valid UTF-8 as well)
+#define PBL_STRING_UTF8_ASCII 1
+/// @brief The content of the string is valid UTF-8, which contains at least one non-ASCII codepoint
+#define PBL_STRING_UTF8_VALID 2
+/// @brief The content of the string is not valid UTF-8
+#define PBL_STRING_UTF8_INVALID 3
 
 /// @brief Base Struct of PblString - avoid using this type
 struct PblString_Base {
@@ -46,12 +61,50 @@ struct PblString_Base {
   /// array of PblChar_T pointers, but an actual block of PblChar_T types being stuck together in memory, meaning array
   /// arithmetics are valid!
   PblChar_T *str;
+  /// @brief Contiguous null-terminated byte copy of 'str', which is kept in sync by the write functions. Since every
+  /// PblChar_T carries its own meta-data, 'str' can not be compared or scanned as a single block of memory, which is
+  /// why all bulk operations (comparison, hashing etc.) work on this copy instead.
+  /// @note Writing directly to 'str' will not update this copy - use the write functions instead, or call
+  /// 'PblStringContentChanged' afterwards!
+  char *c_str;
+  /// @brief The cached 64-bit hash of the content - only valid if 'hash_cached' is true
+  uint64_t hash;
+  /// @brief Whether 'hash' was already calculated for the current content. This is reset on every write
+  bool hash_cached;
+  /// @brief Whether this string is the canonical instance inside the global intern table. Interned strings are
+  /// immutable and may be compared by their address
+  bool interned;
+  /// @brief The cached encoding classification of the content ('PBL_STRING_UTF8_*'), which allows ASCII-only strings to
+  /// skip validation and decoding. This is reset to 'PBL_STRING_UTF8_UNKNOWN' on every write
+  uint8_t utf8_state;
 };
 
 /// @brief PBL String implementation - uses dynamic memory allocation -> located in heap
 struct PblString { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblString_Base)  };
 typedef struct PblString PblString_T;
 
+/// @brief Size of the type 'PblStringView_T' in bytes
+#define PblStringView_T_Size (sizeof(const char *) + sizeof(size_t))
+/// @brief Returns the declaration default for the type 'PblStringView_T'
+#define PblStringView_T_DeclDefault PBL_TYPE_DECLARATION_DEFAULT_CONSTRUCTOR(PblStringView_T)
+/// @brief Returns the definition default for the type 'PblStringView_T', which is an empty view
+#define PblStringView_T_DefDefault                                                                                     \
+  PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblStringView_T, .ptr = NULL, .len = 0)
+
+/// @brief Base Struct of PblStringView - avoid using this type
+struct PblStringView_Base {
+  /// @brief Pointer to the first byte of the viewed content. The content is NOT null-terminated
+  const char *ptr;
+  /// @brief The amount of bytes that are viewed
+  size_t len;
+};
+
+/// @brief PBL String View implementation - a non-owning slice of the bytes of another string, which is passed around
+/// by value and never allocates anything
+/// @note A view is only valid as long as the viewed string is alive and not written to
+struct PblStringView { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct PblStringView_Base)  };
+typedef struct PblStringView PblStringView_T;
+
 // ---- End of Declaration --------------------------------------------------------------------------------------------
 
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
@@ -78,8 +131,62 @@ PblString_T *PblGetStringT(const char *content);
 /// @param str_1 The first string
 /// @param str_2 The second string
 /// @return True if both strings are equal and the content does not differ, else false
+/// @note This allocates the returned PblBool_T - prefer 'PblStringEquals' in hot paths
 PblBool_T *PblCompareStringT(PblString_T *str_1, PblString_T *str_2);
 
+/// @brief Compares the two passed strings and returns whether they are equal, without allocating anything
+/// @note If both strings have a cached hash, differing hashes return early without comparing the content
+/// @param str_1 The first string
+/// @param str_2 The second string
+/// @return True if both strings are equal and the content does not differ, else false
+bool PblStringEquals(PblString_T *str_1, PblString_T *str_2);
+
+/// @brief Three-way comparison of the two passed strings based on their byte content (lexicographical order)
+/// @param str_1 The first string
+/// @param str_2 The second string
+/// @return A negative value if str_1 is ordered before str_2, 0 if both are equal and a positive value if str_1 is
+/// ordered after str_2. A string that is a prefix of another string is ordered before it.
+int PblStringCompareOrder(PblString_T *str_1, PblString_T *str_2);
+
+/// @brief Calculates a 64-bit hash of the passed block of memory (MurmurHash64A)
+/// @param data The pointer to the memory that should be hashed
+/// @param len The amount of bytes to hash
+/// @return The hash of the memory
+uint64_t PblHashBytes(const void *data, size_t len);
+
+/// @brief Gets the 64-bit hash of the string content. The hash is calculated on the first call and then cached inside
+/// the string until its content is written to again
+/// @param str The string that should be hashed
+/// @return The hash of the string content
+uint64_t PblGetStringHash(PblString_T *str);
+
+/// @brief Gets the canonical interned instance of the passed string content from the global intern table. If the
+/// content was not interned yet, an immutable copy is created and added to the table.
+/// @note Two interned strings are equal if, and only if, they have the same address. Reads of the table are lock-free
+/// and the function is thread-safe.
+/// @param str The string whose content should be interned (not modified, and may be an interned string itself)
+/// @return The canonical immutable string, which must not be written to
+PblString_T *PblInternString(PblString_T *str);
+
+/// @brief Gets the canonical interned instance of the passed C string from the global intern table. If the content
+/// was not interned yet, an immutable copy is created and added to the table.
+/// @note Two interned strings are equal if, and only if, they have the same address. Reads of the table are lock-free
+/// and the function is thread-safe.
+/// @param content The char array (pointer)
+/// @return The canonical immutable string, which must not be written to
+PblString_T *PblInternCString(const char *content);
+
+/// @brief Gets the contiguous null-terminated byte content of the string without copying it
+/// @param str The string that should be used
+/// @return The 'c_str' of the string, which must not be modified or de-allocated
+const char *PblGetStringBytes(PblString_T *str);
+
+/// @brief Notifies the string that its content was changed by writing directly to 'str'. This re-writes the byte copy
+/// 'c_str' and resets the cached hash and encoding, which would otherwise be stale
+/// @note The write and resize functions already do this, meaning it is only needed after direct writes to 'str'
+/// @param str The string that was changed
+PblVoid_T PblStringContentChanged(PblString_T *str);
+
 /// @brief Gets the required minimum array size for the string
 /// @param len The length of the string that should be allocated
 /// @return The length as PblUInt_T
@@ -136,11 +243,215 @@ PblChar_T *PblAllocateStringContentT(PblUInt_T *len);
 
 /// @brief Deallocates the entire memory for the string and resets it's struct properties
 /// @note Writes to the string with '\0' before freeing the memory
+/// @note Interned strings are owned by the intern table and will be ignored
 /// @param lvalue The value that should be de-allocated
 PblVoid_T PblDeallocateStringT(PblString_T *lvalue);
 
 // ---- End of Functions Definitions ----------------------------------------------------------------------------------
 
+// ---- Search Functions ----------------------------------------------------------------------------------------------
+
+/// @brief Returned by the search functions if nothing was found
+#define PBL_STRING_NOT_FOUND ((size_t) -1)
+
+/// @brief Needles longer than this are searched using the Two-Way algorithm, which guarantees linear time, instead of
+/// the SIMD first/last-byte filter
+#define PBL_STRING_TWO_WAY_THRESHOLD 64
+
+/// @brief Finds the first occurrence of the needle inside the haystack
+/// @note The search is backed by SIMD (SSE2/AVX2 - selected on runtime) first/last-byte filtering and the Two-Way
+/// algorithm for long needles
+/// @param haystack The string that should be searched
+/// @param needle The string that should be searched for
+/// @return The byte index of the first occurrence or 'PBL_STRING_NOT_FOUND'. An empty needle is found at index 0
+size_t PblStringFind(PblString_T *haystack, PblString_T *needle);
+
+/// @brief Finds the last occurrence of the needle inside the haystack
+/// @note The search is backed by the same algorithms as 'PblStringFind', which search backwards from the end
+/// @param haystack The string that should be searched
+/// @param needle The string that should be searched for
+/// @return The byte index of the last occurrence or 'PBL_STRING_NOT_FOUND'. An empty needle is found at the index
+/// equal to the length of the haystack
+size_t PblStringFindLast(PblString_T *haystack, PblString_T *needle);
+
+/// @brief Checks whether the haystack contains the needle
+/// @param haystack The string that should be searched
+/// @param needle The string that should be searched for
+/// @return True if the needle was found, else false
+bool PblStringContains(PblString_T *haystack, PblString_T *needle);
+
+/// @brief Counts the non-overlapping occurrences of the needle inside the haystack
+/// @param haystack The string that should be searched
+/// @param needle The string that should be searched for
+/// @return The amount of occurrences. An empty needle is counted once per position (length of the haystack + 1)
+size_t PblStringCount(PblString_T *haystack, PblString_T *needle);
+
+/// @brief Finds the first byte in the haystack that is contained in the passed char set
+/// @param haystack The string that should be searched
+/// @param char_set The string containing the bytes that should be searched for
+/// @return The byte index of the first match or 'PBL_STRING_NOT_FOUND'
+size_t PblStringFindAnyOf(PblString_T *haystack, PblString_T *char_set);
+
+// ---- End of Search Functions ---------------------------------------------------------------------------------------
+
+// ---- String Views and Splitting ------------------------------------------------------------------------------------
+
+/// @brief The different ways a 'PblStringSplitIter_T' can separate the tokens
+enum PblStringSplitMode {
+  /// @brief Splits at every occurrence of a separator string. Empty tokens are kept
+  PBL_STRING_SPLIT_SEPARATOR,
+  /// @brief Splits at runs of whitespace (' ', '\\t', '\\n', '\\v', '\\f', '\\r'). Empty tokens are skipped
+  PBL_STRING_SPLIT_WHITESPACE,
+  /// @brief Splits at every byte that is contained in a char set. Empty tokens are kept
+  PBL_STRING_SPLIT_ANY_OF
+};
+
+/// @brief Lazy iterator over the tokens of a string, which yields views into the source and never allocates
+/// @note The iterator is only valid as long as the source and the separator are alive and not written to
+struct PblStringSplitIter {
+  /// @brief The way the tokens are separated
+  enum PblStringSplitMode mode;
+  /// @brief The content that is split
+  PblStringView_T source;
+  /// @brief The separator or char set - unused for 'PBL_STRING_SPLIT_WHITESPACE'
+  PblStringView_T separator;
+  /// @brief The byte index inside the source where the next token starts
+  size_t pos;
+  /// @brief Whether all tokens have been yielded
+  bool done;
+};
+typedef struct PblStringSplitIter PblStringSplitIter_T;
+
+/// @brief Gets a view of the entire content of the passed string
+/// @param str The string that should be viewed
+/// @return The view, which is valid until the string is written to
+PblStringView_T PblGetStringViewT(PblString_T *str);
+
+/// @brief Gets a view of the passed bytes
+/// @param ptr The pointer to the first byte
+/// @param len The amount of bytes to view
+/// @return The view
+PblStringView_T PblGetStringViewOfBytes(const char *ptr, size_t len);
+
+/// @brief Gets a view of the passed null-terminated C string
+/// @param content The char array (pointer)
+/// @return The view, which does not include the null char
+PblStringView_T PblGetStringViewOfCString(const char *content);
+
+/// @brief Compares the content of the two passed views
+/// @param view_1 The first view
+/// @param view_2 The second view
+/// @return True if both views have the same length and content, else false
+bool PblStringViewEquals(PblStringView_T view_1, PblStringView_T view_2);
+
+/// @brief Copies the content of the passed view into a new string
+/// @param view The view that should be copied
+/// @return The newly allocated string
+PblString_T *PblGetStringTFromView(PblStringView_T view);
+
+/// @brief Creates an iterator that splits the source at every occurrence of the separator
+/// @note Behaves like Python's 'str.split(sep)' - "a,,b" yields "a", "" and "b", and an empty source yields a single
+/// empty token. An empty separator yields the entire source as the only token.
+/// @param source The content that should be split
+/// @param separator The separator that should be split at
+/// @return The iterator, which should be advanced using 'PblStringSplitNext'
+PblStringSplitIter_T PblStringSplit(PblStringView_T source, PblStringView_T separator);
+
+/// @brief Creates an iterator that splits the source at runs of whitespace
+/// @note Behaves like Python's 'str.split()' - leading and trailing whitespace is ignored and no empty tokens are
+/// yielded
+/// @param source The content that should be split
+/// @return The iterator, which should be advanced using 'PblStringSplitNext'
+PblStringSplitIter_T PblStringSplitWhitespace(PblStringView_T source);
+
+/// @brief Creates an iterator that splits the source at every byte that is contained in the char set
+/// @note Unlike strtok, empty tokens between two adjacent separators are kept, which is required for CSV-like data
+/// @param source The content that should be split
+/// @param char_set The bytes that should be split at
+/// @return The iterator, which should be advanced using 'PblStringSplitNext'
+PblStringSplitIter_T PblStringSplitAnyOf(PblStringView_T source, PblStringView_T char_set);
+
+/// @brief Advances the iterator and writes the next token into 'token'
+/// @param iter The iterator that should be advanced
+/// @param token The view the next token should be written to - unchanged if there are no tokens left
+/// @return True if a token was written, false if the iterator is exhausted
+bool PblStringSplitNext(PblStringSplitIter_T *iter, PblStringView_T *token);
+
+/// @brief Joins the passed strings into a new string, while inserting the separator between them
+/// @note The total length is calculated beforehand, meaning the content is allocated exactly once
+/// @param parts The array of strings that should be joined
+/// @param amount The amount of strings inside 'parts'
+/// @param separator The separator that should be inserted between two strings
+/// @return The newly allocated string
+PblString_T *PblStringJoin(PblString_T **parts, size_t amount, PblString_T *separator);
+
+/// @brief Joins the passed views into a new string, while inserting the separator between them
+/// @note The total length is calculated beforehand, meaning the content is allocated exactly once
+/// @param parts The array of views that should be joined
+/// @param amount The amount of views inside 'parts'
+/// @param separator The separator that should be inserted between two views
+/// @return The newly allocated string
+PblString_T *PblStringJoinViews(PblStringView_T *parts, size_t amount, PblStringView_T separator);
+
+// ---- End of String Views and Splitting -----------------------------------------------------------------------------
+
+// ---- Unicode Functions ---------------------------------------------------------------------------------------------
+
+/// @brief Returned by 'PblCodepointIterNext' for every byte that is not part of a valid UTF-8 sequence
+#define PBL_UNICODE_REPLACEMENT_CHAR 0xFFFD
+
+/// @brief Lazy iterator over the UTF-8 encoded codepoints of a string, which decodes one codepoint per step
+/// @note The iterator is only valid as long as the source is alive and not written to
+struct PblCodepointIter {
+  /// @brief The content that is decoded
+  PblStringView_T source;
+  /// @brief The byte index inside the source where the next codepoint starts
+  size_t pos;
+};
+typedef struct PblCodepointIter PblCodepointIter_T;
+
+/// @brief Validates whether the passed bytes are well-formed UTF-8 (no overlong encodings, surrogates or codepoints
+/// above U+10FFFF)
+/// @note The validation is vectorised (SSSE3/AVX2 - selected on runtime) using the lookup algorithm by Keiser and
+/// Lemire, and skips blocks that only contain ASCII
+/// @param bytes The pointer to the first byte
+/// @param len The amount of bytes to validate
+/// @return True if the bytes are valid UTF-8, else false
+bool PblValidateUtf8(const char *bytes, size_t len);
+
+/// @brief Validates whether the content of the string is well-formed UTF-8
+/// @note The result is cached inside the string until it is written to again
+/// @param str The string that should be validated
+/// @return True if the content is valid UTF-8, else false
+bool PblStringIsValidUtf8(PblString_T *str);
+
+/// @brief Checks whether the content of the string only consists of ASCII chars
+/// @note The result is cached inside the string until it is written to again
+/// @param str The string that should be checked
+/// @return True if the content is ASCII-only, else false
+bool PblStringIsAscii(PblString_T *str);
+
+/// @brief Gets the amount of codepoints in the string, which is equal to the byte length for ASCII-only strings
+/// @note Invalid content is counted the same way 'PblCodepointIterNext' decodes it, meaning every byte that is not part
+/// of a valid sequence is counted as one codepoint
+/// @param str The string whose codepoints should be counted
+/// @return The amount of codepoints
+size_t PblStringCodepointLen(PblString_T *str);
+
+/// @brief Creates an iterator over the UTF-8 encoded codepoints of the source
+/// @param source The content that should be decoded
+/// @return The iterator, which should be advanced using 'PblCodepointIterNext'
+PblCodepointIter_T PblStringCodepoints(PblStringView_T source);
+
+/// @brief Decodes the next codepoint and advances the iterator
+/// @note Bytes that are not part of a valid UTF-8 sequence are decoded one by one as 'PBL_UNICODE_REPLACEMENT_CHAR'
+/// @param iter The iterator that should be advanced
+/// @param codepoint The pointer the decoded codepoint should be written to
+/// @return True if a codepoint was written, false if the iterator is exhausted
+bool PblCodepointIterNext(PblCodepointIter_T *iter, uint32_t *codepoint);
+
+// ---- End of Unicode Functions --------------------------------------------------------------------------------------
+
 #ifdef __cplusplus
 }
 #endif
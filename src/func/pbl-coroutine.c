@@ -0,0 +1,676 @@
+/// @file pbl-coroutine.c
+/// @brief Stackful coroutines, which run async Pbl functions on pooled, guard-paged stacks and are scheduled by a
+/// single-threaded event loop that also drives an async I/O engine
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/func/pbl-coroutine.h>
+
+// The push hook of the garbage collector, which marks the stacks of suspended coroutines
+#include "gc_mark.h"
+
+// Stacks, signals and threads
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// The context switch is hand-written for x86-64 and AArch64, and uses ucontext on other architectures
+#if !defined(__x86_64__) && !defined(__aarch64__)
+#define PBL_COROUTINE_USE_UCONTEXT
+#include <ucontext.h>
+#endif
+
+// ---- Context Switch ------------------------------------------------------------------------------------------------
+
+/// @brief A stack, whose used part is marked by the garbage collector while it is not running on its thread
+struct PblStackSection {
+  /// @brief The stack pointer saved by the last switch away from the stack
+  void *sp;
+  /// @brief The bottom (highest address) of the stack
+  void *bottom;
+  /// @brief Whether the stack is suspended, which means it is not the current stack of a thread
+  int suspended;
+  /// @brief The neighbours in the list of all sections
+  struct PblStackSection *prev;
+  struct PblStackSection *next;
+#ifdef PBL_COROUTINE_USE_UCONTEXT
+  /// @brief The registers saved by the last switch away from the stack
+  ucontext_t context;
+#endif
+};
+
+/// @brief Switches to another stack, where the callee-saved registers are pushed onto the current stack, the stack
+/// pointer is stored in 'save_sp' and the registers of the other stack are popped from 'new_sp'
+__attribute__((visibility("hidden"))) extern void PblCoroutineSwitchContext(void **save_sp, void *new_sp);
+
+/// @brief The first function that runs on the stack of a new coroutine, which passes the frame on to
+/// 'PblCoroutineMain'
+__attribute__((visibility("hidden"))) extern void PblCoroutineTrampoline(void);
+
+#if defined(__x86_64__)
+// The callee-saved registers, MXCSR and the x87 control word are saved according to the System V ABI
+__asm__(".text\n"
+        ".p2align 4\n"
+        ".globl PblCoroutineSwitchContext\n"
+        ".hidden PblCoroutineSwitchContext\n"
+        ".type PblCoroutineSwitchContext, @function\n"
+        "PblCoroutineSwitchContext:\n"
+        "  pushq %rbp\n"
+        "  pushq %rbx\n"
+        "  pushq %r12\n"
+        "  pushq %r13\n"
+        "  pushq %r14\n"
+        "  pushq %r15\n"
+        "  subq $16, %rsp\n"
+        "  stmxcsr (%rsp)\n"
+        "  fnstcw 4(%rsp)\n"
+        "  movl (%rsp), %eax\n"
+        "  movzwl 4(%rsp), %edx\n"
+        "  movq %rsp, (%rdi)\n"
+        "  movq %rsi, %rsp\n"
+        // Loading the control registers is slow, and they are almost never changed, so they are only loaded if they
+        // differ from the ones of the previous stack
+        "  cmpl (%rsp), %eax\n"
+        "  jne 1f\n"
+        "  cmpw 4(%rsp), %dx\n"
+        "  je 2f\n"
+        "1:\n"
+        "  ldmxcsr (%rsp)\n"
+        "  fldcw 4(%rsp)\n"
+        "2:\n"
+        "  addq $16, %rsp\n"
+        "  popq %r15\n"
+        "  popq %r14\n"
+        "  popq %r13\n"
+        "  popq %r12\n"
+        "  popq %rbx\n"
+        "  popq %rbp\n"
+        "  ret\n"
+        ".size PblCoroutineSwitchContext, .-PblCoroutineSwitchContext\n"
+        ".p2align 4\n"
+        ".globl PblCoroutineTrampoline\n"
+        ".hidden PblCoroutineTrampoline\n"
+        ".type PblCoroutineTrampoline, @function\n"
+        "PblCoroutineTrampoline:\n"
+        "  movq %r12, %rdi\n"
+        "  call PblCoroutineMain\n"
+        "  ud2\n"
+        ".size PblCoroutineTrampoline, .-PblCoroutineTrampoline\n");
+
+/// @brief The size of the registers saved by 'PblCoroutineSwitchContext' including the return address and the padding
+/// that aligns the stack of the trampoline
+#define PBL_COROUTINE_INITIAL_FRAME_SIZE 88
+#elif defined(__aarch64__)
+// The callee-saved registers x19-x30 and d8-d15 are saved according to the AAPCS64
+__asm__(".text\n"
+        ".p2align 4\n"
+        ".globl PblCoroutineSwitchContext\n"
+        ".hidden PblCoroutineSwitchContext\n"
+        ".type PblCoroutineSwitchContext, %function\n"
+        "PblCoroutineSwitchContext:\n"
+        "  sub sp, sp, #160\n"
+        "  stp x19, x20, [sp, #0]\n"
+        "  stp x21, x22, [sp, #16]\n"
+        "  stp x23, x24, [sp, #32]\n"
+        "  stp x25, x26, [sp, #48]\n"
+        "  stp x27, x28, [sp, #64]\n"
+        "  stp x29, x30, [sp, #80]\n"
+        "  stp d8, d9, [sp, #96]\n"
+        "  stp d10, d11, [sp, #112]\n"
+        "  stp d12, d13, [sp, #128]\n"
+        "  stp d14, d15, [sp, #144]\n"
+        "  mov x2, sp\n"
+        "  str x2, [x0]\n"
+        "  mov sp, x1\n"
+        "  ldp x19, x20, [sp, #0]\n"
+        "  ldp x21, x22, [sp, #16]\n"
+        "  ldp x23, x24, [sp, #32]\n"
+        "  ldp x25, x26, [sp, #48]\n"
+        "  ldp x27, x28, [sp, #64]\n"
+        "  ldp x29, x30, [sp, #80]\n"
+        "  ldp d8, d9, [sp, #96]\n"
+        "  ldp d10, d11, [sp, #112]\n"
+        "  ldp d12, d13, [sp, #128]\n"
+        "  ldp d14, d15, [sp, #144]\n"
+        "  add sp, sp, #160\n"
+        "  ret\n"
+        ".size PblCoroutineSwitchContext, .-PblCoroutineSwitchContext\n"
+        ".p2align 4\n"
+        ".globl PblCoroutineTrampoline\n"
+        ".hidden PblCoroutineTrampoline\n"
+        ".type PblCoroutineTrampoline, %function\n"
+        "PblCoroutineTrampoline:\n"
+        "  mov x0, x19\n"
+        "  bl PblCoroutineMain\n"
+        "  brk #0\n"
+        ".size PblCoroutineTrampoline, .-PblCoroutineTrampoline\n");
+
+/// @brief The size of the registers saved by 'PblCoroutineSwitchContext'
+#define PBL_COROUTINE_INITIAL_FRAME_SIZE 160
+#endif
+
+// ---- End of Context Switch -----------------------------------------------------------------------------------------
+
+// ---- Scheduler State -----------------------------------------------------------------------------------------------
+
+struct PblCoroutineFrame {
+  /// @brief The coroutine, which is kept alive by the frame until it is done
+  PblCoroutine_T *coroutine;
+  PblCoroutineEntry_T entry;
+  void *arg;
+  /// @brief The mapping of the stack including the guard page at its lowest address
+  void *stack;
+  /// @brief The stack of the coroutine, which is marked by the garbage collector while the coroutine is suspended
+  struct PblStackSection section;
+  /// @brief Whether the entry returned, after which the stack is released by the scheduler
+  bool finished;
+  /// @brief The next coroutine in the ready queue
+  struct PblCoroutineFrame *next_ready;
+  /// @brief The coroutines awaiting this coroutine, which are linked using 'next_waiter'
+  struct PblCoroutineFrame *waiters;
+  struct PblCoroutineFrame *next_waiter;
+  /// @brief The I/O operation the coroutine waits for, whose buffer may be on the stack - NULL if there is none
+  PblAsyncIOHandle_T *io_handle;
+  /// @brief The neighbours in the list of all unfinished coroutines of the scheduler
+  struct PblCoroutineFrame *prev_frame;
+  struct PblCoroutineFrame *next_frame;
+};
+
+struct PblSchedulerState {
+  PblAsyncIOEngine_T *engine;
+  /// @brief The usable size of a stack, which is a multiple of the page size
+  size_t stack_size;
+  size_t page_size;
+  /// @brief The stacks of finished coroutines, which are reused by new coroutines. Every pooled stack stores the next
+  /// one at its highest address
+  void *stack_pool;
+  size_t stack_pool_len;
+  /// @brief The queue of coroutines that are ready to run, which are linked using 'next_ready'
+  struct PblCoroutineFrame *ready_head;
+  struct PblCoroutineFrame *ready_tail;
+  /// @brief All unfinished coroutines, which are released if the scheduler is destroyed before they finished
+  struct PblCoroutineFrame *frames;
+  /// @brief The thread stack of the scheduler, which is marked by the garbage collector while a coroutine runs
+  struct PblStackSection section;
+  /// @brief The garbage collector handle of the thread running the scheduler
+  void *gc_thread_handle;
+  /// @brief Whether the loop of the scheduler runs
+  bool running;
+  /// @brief The signal used by the garbage collector to stop threads, which is blocked during a switch, so the thread
+  /// is never stopped while its stack pointer and registered stack bottom do not match
+  int suspend_signal;
+  sigset_t suspend_signal_set;
+};
+
+/// @brief The coroutine running on the current thread
+static _Thread_local struct PblCoroutineFrame *PBL_CURRENT_COROUTINE = NULL;
+
+/// @brief All stack sections of all schedulers, which are only modified while holding the allocation lock of the
+/// garbage collector, so the list is consistent while the collector runs
+static struct PblStackSection *PBL_STACK_SECTIONS = NULL;
+static pthread_once_t PBL_STACK_SECTIONS_ONCE = PTHREAD_ONCE_INIT;
+
+/// @brief The push hook that was installed before the one of the coroutines, which is still called
+static GC_push_other_roots_proc PBL_PREVIOUS_PUSH_OTHER_ROOTS = NULL;
+
+/// @brief Marks the used part of all suspended stacks, which is called by the garbage collector with the world stopped
+static void PblCoroutinePushStacks(void) {
+  if (PBL_PREVIOUS_PUSH_OTHER_ROOTS != NULL) PBL_PREVIOUS_PUSH_OTHER_ROOTS();
+  for (struct PblStackSection *section = PBL_STACK_SECTIONS; section != NULL; section = section->next) {
+    if (section->suspended) GC_push_all(section->sp, section->bottom);
+  }
+}
+
+static void PblCoroutineInstallPushHook(void) {
+  PBL_PREVIOUS_PUSH_OTHER_ROOTS = GC_get_push_other_roots();
+  GC_set_push_other_roots(PblCoroutinePushStacks);
+}
+
+static inline void PblCoroutineBlockGC(struct PblSchedulerState *state) {
+  if (state->suspend_signal > 0) pthread_sigmask(SIG_BLOCK, &state->suspend_signal_set, NULL);
+}
+
+static inline void PblCoroutineUnblockGC(struct PblSchedulerState *state) {
+  if (state->suspend_signal > 0) pthread_sigmask(SIG_UNBLOCK, &state->suspend_signal_set, NULL);
+}
+
+/// @brief Adds the section to the list, which requires the allocation lock
+static void *PblCoroutineAddSectionLocked(void *data) {
+  struct PblStackSection *section = data;
+  section->prev = NULL;
+  section->next = PBL_STACK_SECTIONS;
+  if (PBL_STACK_SECTIONS != NULL) PBL_STACK_SECTIONS->prev = section;
+  PBL_STACK_SECTIONS = section;
+  return NULL;
+}
+
+/// @brief Removes the section from the list, which requires the allocation lock
+static void *PblCoroutineRemoveSectionLocked(void *data) {
+  struct PblStackSection *section = data;
+  if (section->prev != NULL)
+    section->prev->next = section->next;
+  else
+    PBL_STACK_SECTIONS = section->next;
+  if (section->next != NULL) section->next->prev = section->prev;
+  section->prev = section->next = NULL;
+  return NULL;
+}
+
+static void PblCoroutineAddSection(struct PblStackSection *section) {
+  GC_call_with_alloc_lock(PblCoroutineAddSectionLocked, section);
+}
+
+static void PblCoroutineRemoveSection(struct PblStackSection *section) {
+  GC_call_with_alloc_lock(PblCoroutineRemoveSectionLocked, section);
+}
+
+/// @brief Arguments of 'PblCoroutinePrepareSwitch'
+struct PblCoroutineSwitchData {
+  struct PblSchedulerState *state;
+  struct PblStackSection *from;
+  struct PblStackSection *to;
+};
+
+/// @brief Marks the stack that is switched to as running and sets it as the stack bottom of the thread. This runs while
+/// holding the allocation lock, so the world can not be stopped in between. The suspend signal is blocked before the
+/// lock is released, so the thread is only stopped once the switch is done and its stack pointer matches the bottom
+/// again. The signal is therefore never blocked while waiting for the lock, which the collector holds while it waits
+/// for every thread to acknowledge the signal
+static void *PblCoroutinePrepareSwitch(void *data) {
+  struct PblCoroutineSwitchData *prepared = data;
+  prepared->from->suspended = 1;
+  prepared->to->suspended = 0;
+  struct GC_stack_base stack_base = {.mem_base = prepared->to->bottom};
+  GC_set_stackbottom(prepared->state->gc_thread_handle, &stack_base);
+  PblCoroutineBlockGC(prepared->state);
+  return NULL;
+}
+
+/// @brief Switches from one stack to the other and tells the garbage collector about it
+static void PblCoroutineSwitch(struct PblSchedulerState *state, struct PblStackSection *from,
+                               struct PblStackSection *to) {
+  struct PblCoroutineSwitchData prepared = {.state = state, .from = from, .to = to};
+  GC_call_with_alloc_lock(PblCoroutinePrepareSwitch, &prepared);
+
+  // Nothing between here and the switch waits for another thread, as the suspend signal is blocked
+#ifdef PBL_COROUTINE_USE_UCONTEXT
+  // The registers are saved in the section, so only the stack above the current frame has to be marked
+  from->sp = (char *) &prepared - 256;
+  swapcontext(&from->context, &to->context);
+#else
+  PblCoroutineSwitchContext(&from->sp, to->sp);
+#endif
+
+  // Resumed by a later switch back to this stack
+  PblCoroutineUnblockGC(state);
+}
+
+// ---- End of Scheduler State ----------------------------------------------------------------------------------------
+
+// ---- Stacks --------------------------------------------------------------------------------------------------------
+
+/// @brief Returns the slot at the highest address of the stack, which links the pooled stacks
+static inline void **PblCoroutineStackPoolLink(struct PblSchedulerState *state, void *stack) {
+  return (void **) ((char *) stack + state->page_size + state->stack_size) - 1;
+}
+
+/// @brief Gets a stack from the pool, or maps a new one with a guard page at its lowest address
+static void *PblCoroutineAcquireStack(struct PblSchedulerState *state) {
+  if (state->stack_pool != NULL) {
+    void *stack = state->stack_pool;
+    state->stack_pool = *PblCoroutineStackPoolLink(state, stack);
+    state->stack_pool_len--;
+    return stack;
+  }
+
+  size_t size = state->stack_size + state->page_size;
+  void *stack = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1,
+                     0);
+  if (stack == MAP_FAILED) PblAbortWithCriticalError(1, "Para: Failed to map the stack of a coroutine");
+
+  // Overflowing the stack faults on the guard page instead of overwriting other memory
+  if (mprotect(stack, state->page_size, PROT_NONE) != 0)
+    PblAbortWithCriticalError(1, "Para: Failed to protect the guard page of a coroutine stack (vm.max_map_count "
+                                 "limits the amount of coroutines)");
+  return stack;
+}
+
+/// @brief Returns the stack to the pool, or unmaps it if the pool is full
+static void PblCoroutineReleaseStack(struct PblSchedulerState *state, void *stack) {
+  if (state->stack_pool_len < PBL_COROUTINE_STACK_POOL_SIZE) {
+    *PblCoroutineStackPoolLink(state, stack) = state->stack_pool;
+    state->stack_pool = stack;
+    state->stack_pool_len++;
+    return;
+  }
+  munmap(stack, state->stack_size + state->page_size);
+}
+
+// ---- End of Stacks -------------------------------------------------------------------------------------------------
+
+// ---- Scheduling ----------------------------------------------------------------------------------------------------
+
+static void PblSchedulerPushReady(struct PblSchedulerState *state, struct PblCoroutineFrame *frame) {
+  frame->coroutine->actual.state = PBL_COROUTINE_READY;
+  frame->next_ready = NULL;
+  if (state->ready_tail != NULL)
+    state->ready_tail->next_ready = frame;
+  else
+    state->ready_head = frame;
+  state->ready_tail = frame;
+}
+
+static struct PblCoroutineFrame *PblSchedulerPopReady(struct PblSchedulerState *state) {
+  struct PblCoroutineFrame *frame = state->ready_head;
+  if (frame != NULL) {
+    state->ready_head = frame->next_ready;
+    if (state->ready_head == NULL) state->ready_tail = NULL;
+    frame->next_ready = NULL;
+  }
+  return frame;
+}
+
+/// @brief Runs the entry of the coroutine on its own stack, and switches back to the scheduler once it returned
+__attribute__((visibility("hidden"), used, noreturn)) void PblCoroutineMain(struct PblCoroutineFrame *frame) {
+  PblCoroutine_T *coroutine = frame->coroutine;
+  struct PblSchedulerState *state = coroutine->actual.scheduler;
+
+  // The switch into a new coroutine does not return through 'PblCoroutineSwitch'
+  PblCoroutineUnblockGC(state);
+
+  coroutine->actual.result = frame->entry(frame->arg);
+  frame->finished = true;
+
+  // Waking up the coroutines awaiting this one
+  for (struct PblCoroutineFrame *waiter = frame->waiters; waiter != NULL;) {
+    struct PblCoroutineFrame *next = waiter->next_waiter;
+    waiter->next_waiter = NULL;
+    PblSchedulerPushReady(state, waiter);
+    waiter = next;
+  }
+  frame->waiters = NULL;
+
+  PblCoroutineSwitch(state, &frame->section, &state->section);
+  __builtin_unreachable();
+}
+
+#ifdef PBL_COROUTINE_USE_UCONTEXT
+/// @brief The frame of the coroutine that is started by the current thread
+static _Thread_local struct PblCoroutineFrame *PBL_STARTING_COROUTINE = NULL;
+
+static void PblCoroutineUContextMain(void) { PblCoroutineMain(PBL_STARTING_COROUTINE); }
+#endif
+
+/// @brief Removes the frame from the scheduler and frees it, where the stack is pooled if the coroutine finished and
+/// otherwise unmapped, as it may still contain the frames of the coroutine
+static void PblSchedulerReleaseFrame(struct PblSchedulerState *state, struct PblCoroutineFrame *frame) {
+  if (frame->prev_frame != NULL)
+    frame->prev_frame->next_frame = frame->next_frame;
+  else
+    state->frames = frame->next_frame;
+  if (frame->next_frame != NULL) frame->next_frame->prev_frame = frame->prev_frame;
+
+  PblCoroutineRemoveSection(&frame->section);
+  if (frame->finished)
+    PblCoroutineReleaseStack(state, frame->stack);
+  else
+    munmap(frame->stack, state->stack_size + state->page_size);
+  frame->coroutine->actual.frame = NULL;
+  PblFree(frame);
+}
+
+/// @brief Resumes the coroutine until it suspends or finishes, and releases its stack once it finished
+static void PblSchedulerResume(struct PblSchedulerState *state, struct PblCoroutineFrame *frame) {
+  frame->coroutine->actual.state = PBL_COROUTINE_RUNNING;
+  PBL_CURRENT_COROUTINE = frame;
+#ifdef PBL_COROUTINE_USE_UCONTEXT
+  PBL_STARTING_COROUTINE = frame;
+#endif
+  PblCoroutineSwitch(state, &state->section, &frame->section);
+  PBL_CURRENT_COROUTINE = NULL;
+
+  if (frame->finished) {
+    frame->coroutine->actual.state = PBL_COROUTINE_DONE;
+    PblSchedulerReleaseFrame(state, frame);
+  }
+}
+
+/// @brief Suspends the current coroutine, which has to be made ready again by another coroutine or an I/O callback
+static void PblCoroutineSuspend(struct PblCoroutineFrame *frame) {
+  struct PblSchedulerState *state = frame->coroutine->actual.scheduler;
+  if (frame->coroutine->actual.state == PBL_COROUTINE_RUNNING)
+    frame->coroutine->actual.state = PBL_COROUTINE_SUSPENDED;
+  PblCoroutineSwitch(state, &frame->section, &state->section);
+}
+
+/// @brief Runs the ready coroutines and polls the engine until the passed coroutine is done, or if NULL is passed until
+/// all coroutines are done or wait for each other
+static void PblSchedulerLoop(struct PblSchedulerState *state, PblCoroutine_T *until) {
+  if (PBL_CURRENT_COROUTINE != NULL)
+    PblAbortWithCriticalError(1, "Para: A scheduler may not be run inside a coroutine");
+  if (state->running) PblAbortWithCriticalError(1, "Para: The scheduler is already running");
+
+  // The thread stack is marked separately while a coroutine runs, since the collector then scans the coroutine stack
+  struct GC_stack_base stack_base;
+  state->gc_thread_handle = GC_get_my_stackbottom(&stack_base);
+  state->section.bottom = stack_base.mem_base;
+  state->running = true;
+
+  size_t resumed = 0;
+  while (until == NULL || until->actual.state != PBL_COROUTINE_DONE) {
+    struct PblCoroutineFrame *frame = PblSchedulerPopReady(state);
+    if (frame != NULL) {
+      PblSchedulerResume(state, frame);
+      if (state->engine != NULL && ++resumed % PBL_COROUTINE_IO_POLL_INTERVAL == 0) PblAsyncIOPoll(state->engine);
+      continue;
+    }
+
+    // Nothing is ready, so the loop waits for the I/O the suspended coroutines wait for
+    if (state->engine == NULL || PblAsyncIOPending(state->engine) == 0) break;
+    PblAsyncIOWait(state->engine, 1);
+  }
+  state->running = false;
+}
+
+/// @brief Makes the coroutine waiting for the completed operation ready again
+static void PblCoroutineIOCallback(__attribute__((unused)) PblAsyncIOHandle_T *handle, void *user_data) {
+  struct PblCoroutineFrame *frame = user_data;
+  frame->io_handle = NULL;
+  PblSchedulerPushReady(frame->coroutine->actual.scheduler, frame);
+}
+
+/// @brief Gets the frame of the current coroutine, whose scheduler has to have an engine
+static struct PblCoroutineFrame *PblCoroutineGetIOFrame(void) {
+  struct PblCoroutineFrame *frame = PBL_CURRENT_COROUTINE;
+  if (frame == NULL) PblAbortWithCriticalError(1, "Para: Async I/O may only be awaited inside a coroutine");
+  if (frame->coroutine->actual.scheduler->engine == NULL)
+    PblAbortWithCriticalError(1, "Para: The scheduler of the coroutine has no async I/O engine");
+  return frame;
+}
+
+// ---- End of Scheduling ---------------------------------------------------------------------------------------------
+
+// ---- Functions Implementation --------------------------------------------------------------------------------------
+
+PblScheduler_T *PblSchedulerCreate_Base(PblAsyncIOEngine_T *engine, size_t stack_size) {
+  pthread_once(&PBL_STACK_SECTIONS_ONCE, PblCoroutineInstallPushHook);
+
+  struct PblSchedulerState *state = PblMallocUncollectable(sizeof(struct PblSchedulerState));
+  state->engine = engine;
+  state->page_size = (size_t) sysconf(_SC_PAGESIZE);
+  state->stack_size = (stack_size + state->page_size - 1) / state->page_size * state->page_size;
+  state->stack_pool = NULL;
+  state->stack_pool_len = 0;
+  state->ready_head = NULL;
+  state->ready_tail = NULL;
+  state->frames = NULL;
+  state->gc_thread_handle = NULL;
+  state->running = false;
+  state->suspend_signal = GC_get_suspend_signal();
+  sigemptyset(&state->suspend_signal_set);
+  if (state->suspend_signal > 0) sigaddset(&state->suspend_signal_set, state->suspend_signal);
+  state->section.sp = NULL;
+  state->section.bottom = NULL;
+  state->section.suspended = 0;
+  PblCoroutineAddSection(&state->section);
+
+  PBL_DEFINE_VAR(scheduler, PblScheduler_T);
+  scheduler->actual.state = state;
+  scheduler->actual.engine = engine;
+  scheduler->actual.stack_size = state->stack_size;
+  return scheduler;
+}
+
+__attribute__((unused)) PblScheduler_T *PblSchedulerCreate_Overhead(struct PblSchedulerCreate_Args in) {
+  return PblSchedulerCreate_Base(in.engine, in.stack_size != 0 ? in.stack_size : PBL_COROUTINE_DEFAULT_STACK_SIZE);
+}
+
+void PblSchedulerRun(PblScheduler_T *scheduler) {
+  // Validate the pointer for safety measures
+  scheduler = PblValPtr((void *) scheduler);
+  PblSchedulerLoop(PblValPtr((void *) scheduler->actual.state), NULL);
+}
+
+void PblSchedulerDestroy(PblScheduler_T *scheduler) {
+  // Validate the pointer for safety measures
+  scheduler = PblValPtr((void *) scheduler);
+  struct PblSchedulerState *state = scheduler->actual.state;
+  if (state == NULL) return;
+  if (state->running) PblAbortWithCriticalError(1, "Para: A running scheduler may not be destroyed");
+
+  // The operations of suspended coroutines may still write into their stacks, so they have to complete first
+  for (struct PblCoroutineFrame *frame = state->frames; frame != NULL; frame = frame->next_frame) {
+    if (frame->io_handle != NULL) PblAsyncIOWaitHandle(frame->io_handle);
+  }
+
+  // Coroutines that did not finish are cancelled, where their stacks are unmapped without unwinding them
+  while (state->frames != NULL) {
+    struct PblCoroutineFrame *frame = state->frames;
+    frame->coroutine->actual.state = PBL_COROUTINE_CANCELLED;
+    frame->coroutine->actual.scheduler = NULL;
+    PblSchedulerReleaseFrame(state, frame);
+  }
+
+  PblCoroutineRemoveSection(&state->section);
+  while (state->stack_pool != NULL) {
+    void *stack = state->stack_pool;
+    state->stack_pool = *PblCoroutineStackPoolLink(state, stack);
+    munmap(stack, state->stack_size + state->page_size);
+  }
+  PblFree(state);
+  scheduler->actual.state = NULL;
+}
+
+PblCoroutine_T *PblCoroutineSpawn(PblScheduler_T *scheduler, const PblFunctionDescriptor_T *descriptor,
+                                  PblCoroutineEntry_T entry, void *arg) {
+  // Validate the pointer for safety measures
+  scheduler = PblValPtr((void *) scheduler);
+  struct PblSchedulerState *state = PblValPtr((void *) scheduler->actual.state);
+
+  PBL_DEFINE_VAR(coroutine, PblCoroutine_T);
+  coroutine->actual.descriptor = descriptor;
+  coroutine->actual.scheduler = state;
+
+  struct PblCoroutineFrame *frame = PblMallocUncollectable(sizeof(struct PblCoroutineFrame));
+  frame->coroutine = coroutine;
+  frame->entry = entry;
+  frame->arg = arg;
+  frame->stack = PblCoroutineAcquireStack(state);
+  frame->finished = false;
+  frame->next_ready = NULL;
+  frame->waiters = NULL;
+  frame->next_waiter = NULL;
+  frame->io_handle = NULL;
+  frame->prev_frame = NULL;
+  frame->next_frame = state->frames;
+  if (state->frames != NULL) state->frames->prev_frame = frame;
+  state->frames = frame;
+  coroutine->actual.frame = frame;
+
+  // The stack starts at its highest address, which is aligned to 16 bytes as it is the end of a page
+  void *bottom = (char *) frame->stack + state->page_size + state->stack_size;
+  frame->section.bottom = bottom;
+  frame->section.suspended = 1;
+#ifdef PBL_COROUTINE_USE_UCONTEXT
+  getcontext(&frame->section.context);
+  frame->section.context.uc_stack.ss_sp = (char *) frame->stack + state->page_size;
+  frame->section.context.uc_stack.ss_size = state->stack_size;
+  frame->section.context.uc_link = NULL;
+  makecontext(&frame->section.context, PblCoroutineUContextMain, 0);
+  frame->section.sp = bottom;
+#else
+  // Initial registers, which are popped by the first switch to the coroutine and return into the trampoline
+  uint64_t *initial = (uint64_t *) ((char *) bottom - PBL_COROUTINE_INITIAL_FRAME_SIZE);
+  memset(initial, 0, PBL_COROUTINE_INITIAL_FRAME_SIZE);
+#if defined(__x86_64__)
+  initial[0] = 0x1F80 | ((uint64_t) 0x037F << 32);// Default MXCSR and x87 control word
+  initial[5] = (uint64_t) (uintptr_t) frame;                 // r12
+  initial[8] = (uint64_t) (uintptr_t) PblCoroutineTrampoline;// Return address
+#elif defined(__aarch64__)
+  initial[0] = (uint64_t) (uintptr_t) frame;                  // x19
+  initial[11] = (uint64_t) (uintptr_t) PblCoroutineTrampoline;// x30
+#endif
+  frame->section.sp = initial;
+#endif
+
+  PblCoroutineAddSection(&frame->section);
+  PblSchedulerPushReady(state, frame);
+  return coroutine;
+}
+
+PblCoroutine_T *PblCoroutineCurrent(void) {
+  return PBL_CURRENT_COROUTINE != NULL ? PBL_CURRENT_COROUTINE->coroutine : NULL;
+}
+
+void *PblAwait(PblCoroutine_T *coroutine) {
+  // Validate the pointer for safety measures
+  coroutine = PblValPtr((void *) coroutine);
+  if (coroutine->actual.state == PBL_COROUTINE_CANCELLED) return NULL;
+
+  struct PblCoroutineFrame *current = PBL_CURRENT_COROUTINE;
+  if (current == NULL) {
+    PblSchedulerLoop(coroutine->actual.scheduler, coroutine);
+  } else if (coroutine->actual.state != PBL_COROUTINE_DONE) {
+    if (coroutine->actual.scheduler != current->coroutine->actual.scheduler)
+      PblAbortWithCriticalError(1, "Para: Coroutines may only await coroutines of the same scheduler");
+    if (coroutine->actual.frame == current) PblAbortWithCriticalError(1, "Para: A coroutine may not await itself");
+
+    current->next_waiter = coroutine->actual.frame->waiters;
+    coroutine->actual.frame->waiters = current;
+    PblCoroutineSuspend(current);
+  }
+  return coroutine->actual.state == PBL_COROUTINE_DONE ? coroutine->actual.result : NULL;
+}
+
+void PblYield(void) {
+  struct PblCoroutineFrame *current = PBL_CURRENT_COROUTINE;
+  if (current == NULL) return;
+  PblSchedulerPushReady(current->coroutine->actual.scheduler, current);
+  PblCoroutineSuspend(current);
+}
+
+int64_t PblAwaitRead(PblIOStream_T *stream, void *buffer, size_t len, int64_t offset) {
+  struct PblCoroutineFrame *frame = PblCoroutineGetIOFrame();
+  PblAsyncIOHandle_T *handle =
+    PblAsyncRead(.engine = frame->coroutine->actual.scheduler->engine, .stream = stream, .buffer = buffer, .len = len,
+                 .offset = offset, .callback = PblCoroutineIOCallback, .user_data = frame);
+  frame->io_handle = handle;
+  PblCoroutineSuspend(frame);
+  return handle->result;
+}
+
+int64_t PblAwaitWrite(PblIOStream_T *stream, const void *buffer, size_t len, int64_t offset) {
+  struct PblCoroutineFrame *frame = PblCoroutineGetIOFrame();
+  PblAsyncIOHandle_T *handle =
+    PblAsyncWrite(.engine = frame->coroutine->actual.scheduler->engine, .stream = stream, .buffer = buffer, .len = len,
+                  .offset = offset, .callback = PblCoroutineIOCallback, .user_data = frame);
+  frame->io_handle = handle;
+  PblCoroutineSuspend(frame);
+  return handle->result;
+}
+
+// ---- End of Functions Implementation -------------------------------------------------------------------------------
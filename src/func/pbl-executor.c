@@ -0,0 +1,457 @@
+/// @file pbl-executor.c
+/// @brief Work-stealing thread pool, where every worker owns a Chase-Lev deque of tasks and steals from the deques of
+/// the other workers once its own deque is empty
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/func/pbl-executor.h>
+
+// Threads and atomics for the workers and deques
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+// ---- Tasks and Deques ----------------------------------------------------------------------------------------------
+
+/// @brief The size of a cache line, which separates the indices of the owner and the thieves of a deque
+#define PBL_EXECUTOR_CACHE_LINE_SIZE 64
+
+/// @brief The initial capacity of the shared queue of an executor
+#define PBL_EXECUTOR_QUEUE_INITIAL_SIZE 64
+
+/// @brief The max. time an idle thread sleeps before looking for tasks again. Spawning a task and finishing one wake the
+/// sleeping threads, so this only bounds the delay of a missed wake-up
+#define PBL_EXECUTOR_IDLE_TIMEOUT_NS 100000000L
+
+/// @brief A spawned function, which is waiting to be run
+struct PblExecutorTask {
+  PblFuture_T *future;
+  const PblFunctionDescriptor_T *descriptor;
+  PblSpawnEntry_T entry;
+  PblSpawnArgs_T args;
+};
+
+/// @brief Chase-Lev deque, where the owning worker pushes and takes tasks at the bottom, while other threads steal
+/// tasks from the top
+struct PblExecutorDeque {
+  _Alignas(PBL_EXECUTOR_CACHE_LINE_SIZE) _Atomic(int64_t) top;
+  _Alignas(PBL_EXECUTOR_CACHE_LINE_SIZE) _Atomic(int64_t) bottom;
+  _Alignas(PBL_EXECUTOR_CACHE_LINE_SIZE) _Atomic(struct PblExecutorTask *) tasks[PBL_EXECUTOR_DEQUE_SIZE];
+};
+
+/// @brief Worker thread of an executor
+struct PblExecutorWorker {
+  struct PblExecutorState *state;
+  pthread_t thread;
+  struct PblExecutorDeque deque;
+};
+
+struct PblExecutorState {
+  /// @brief The workers, which are allocated uncollectable, so the tasks inside their deques are kept alive
+  struct PblExecutorWorker *workers;
+  size_t workers_len;
+  /// @brief Lock of the shared queue and the condition variables
+  pthread_mutex_t lock;
+  /// @brief Signaled when a task was spawned, which wakes a sleeping worker
+  pthread_cond_t work_available;
+  /// @brief Broadcast when a task finished while a thread waits for a future
+  pthread_cond_t task_finished;
+  /// @brief Ring buffer of the tasks spawned outside of workers or while the deque of the worker was full
+  struct PblExecutorTask **queue;
+  size_t queue_head;
+  size_t queue_capacity;
+  _Atomic(size_t) queue_len;
+  /// @brief The amount of workers waiting for 'work_available'
+  _Atomic(size_t) sleeping_workers;
+  /// @brief The amount of threads waiting for 'task_finished'
+  _Atomic(size_t) waiting_threads;
+  /// @brief The amount of tasks that were spawned, but did not finish yet
+  _Atomic(size_t) pending_tasks;
+  _Atomic(bool) stopping;
+};
+
+/// @brief The worker running on the current thread, which is NULL on other threads
+static _Thread_local struct PblExecutorWorker *PBL_EXECUTOR_CURRENT_WORKER = NULL;
+
+/// @brief State of the random number generator picking the first victim of a steal
+static _Thread_local uint64_t PBL_EXECUTOR_STEAL_SEED = 0;
+
+/// @brief Pushes the task onto the bottom of the deque - only called by the owning worker
+/// @return False if the deque is full
+static bool PblDequePush(struct PblExecutorDeque *deque, struct PblExecutorTask *task) {
+  int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+  int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+  if (bottom - top >= PBL_EXECUTOR_DEQUE_SIZE) return false;
+
+  atomic_store_explicit(&deque->tasks[bottom % PBL_EXECUTOR_DEQUE_SIZE], task, memory_order_release);
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+  return true;
+}
+
+/// @brief Takes the most recently pushed task from the bottom of the deque - only called by the owning worker
+static struct PblExecutorTask *PblDequeTake(struct PblExecutorDeque *deque) {
+  int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+  atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return NULL;
+  }
+
+  struct PblExecutorTask *task = atomic_load_explicit(&deque->tasks[bottom % PBL_EXECUTOR_DEQUE_SIZE],
+                                                      memory_order_relaxed);
+  if (top == bottom) {
+    // The last task, which a thief may try to steal at the same time
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed))
+      task = NULL;
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    if (task == NULL) return NULL;
+  }
+
+  // Clearing the slot, as the uncollectable deque would otherwise keep the task alive until the slot is reused
+  atomic_store_explicit(&deque->tasks[bottom % PBL_EXECUTOR_DEQUE_SIZE], NULL, memory_order_relaxed);
+  return task;
+}
+
+/// @brief Steals the oldest task from the top of the deque - called by any thread
+/// @return The task, or NULL if the deque is empty or another thread took the task first
+static struct PblExecutorTask *PblDequeSteal(struct PblExecutorDeque *deque) {
+  int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+  if (top >= bottom) return NULL;
+
+  struct PblExecutorTask *task = atomic_load_explicit(&deque->tasks[top % PBL_EXECUTOR_DEQUE_SIZE],
+                                                      memory_order_acquire);
+  if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed))
+    return NULL;
+
+  // Clearing the slot unless the owner already pushed a new task into it, as the deque may be full again
+  struct PblExecutorTask *claimed = task;
+  atomic_compare_exchange_strong_explicit(&deque->tasks[top % PBL_EXECUTOR_DEQUE_SIZE], &claimed, NULL,
+                                          memory_order_relaxed, memory_order_relaxed);
+  return task;
+}
+
+/// @brief Returns whether the deque seems to contain tasks
+static bool PblDequeHasTasks(struct PblExecutorDeque *deque) {
+  return atomic_load_explicit(&deque->top, memory_order_acquire) <
+         atomic_load_explicit(&deque->bottom, memory_order_acquire);
+}
+
+/// @brief Appends the task to the shared queue of the executor
+static void PblExecutorQueuePush(struct PblExecutorState *state, struct PblExecutorTask *task) {
+  pthread_mutex_lock(&state->lock);
+  size_t len = atomic_load_explicit(&state->queue_len, memory_order_relaxed);
+  if (len == state->queue_capacity) {
+    // Growing the ring buffer, which moves the tasks to the start of the new buffer
+    size_t capacity = state->queue_capacity * 2;
+    struct PblExecutorTask **queue = PblMallocUncollectable(capacity * sizeof(struct PblExecutorTask *));
+    for (size_t i = 0; i < len; i++) queue[i] = state->queue[(state->queue_head + i) % state->queue_capacity];
+    PblFree(state->queue);
+    state->queue = queue;
+    state->queue_head = 0;
+    state->queue_capacity = capacity;
+  }
+  state->queue[(state->queue_head + len) % state->queue_capacity] = task;
+  atomic_store_explicit(&state->queue_len, len + 1, memory_order_seq_cst);
+  pthread_mutex_unlock(&state->lock);
+}
+
+/// @brief Takes the oldest task from the shared queue of the executor
+static struct PblExecutorTask *PblExecutorQueuePop(struct PblExecutorState *state) {
+  if (atomic_load_explicit(&state->queue_len, memory_order_acquire) == 0) return NULL;
+
+  struct PblExecutorTask *task = NULL;
+  pthread_mutex_lock(&state->lock);
+  size_t len = atomic_load_explicit(&state->queue_len, memory_order_relaxed);
+  if (len > 0) {
+    task = state->queue[state->queue_head];
+    state->queue[state->queue_head] = NULL;
+    state->queue_head = (state->queue_head + 1) % state->queue_capacity;
+    atomic_store_explicit(&state->queue_len, len - 1, memory_order_relaxed);
+  }
+  pthread_mutex_unlock(&state->lock);
+  return task;
+}
+
+// ---- End of Tasks and Deques ---------------------------------------------------------------------------------------
+
+// ---- Workers -------------------------------------------------------------------------------------------------------
+
+/// @brief Returns whether the executor seems to have tasks that are waiting to be run
+static bool PblExecutorHasTasks(struct PblExecutorState *state) {
+  if (atomic_load_explicit(&state->queue_len, memory_order_seq_cst) > 0) return true;
+  for (size_t i = 0; i < state->workers_len; i++) {
+    if (PblDequeHasTasks(&state->workers[i].deque)) return true;
+  }
+  return false;
+}
+
+/// @brief Finds a task for the current thread, which first takes from the deque of the current worker, then from the
+/// shared queue, and finally tries to steal from the deques of the workers starting at a random one
+static struct PblExecutorTask *PblExecutorFindTask(struct PblExecutorState *state) {
+  struct PblExecutorWorker *worker = PBL_EXECUTOR_CURRENT_WORKER;
+  if (worker != NULL && worker->state != state) worker = NULL;
+
+  struct PblExecutorTask *task = worker != NULL ? PblDequeTake(&worker->deque) : NULL;
+  if (task != NULL) return task;
+  task = PblExecutorQueuePop(state);
+  if (task != NULL) return task;
+
+  // xorshift, which only has to spread the thieves over the workers
+  uint64_t seed = PBL_EXECUTOR_STEAL_SEED != 0 ? PBL_EXECUTOR_STEAL_SEED : (uint64_t) (uintptr_t) &seed | 1;
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  PBL_EXECUTOR_STEAL_SEED = seed;
+
+  size_t start = (size_t) (seed % state->workers_len);
+  for (size_t i = 0; i < state->workers_len; i++) {
+    struct PblExecutorWorker *victim = &state->workers[(start + i) % state->workers_len];
+    if (victim == worker) continue;
+    task = PblDequeSteal(&victim->deque);
+    if (task != NULL) return task;
+  }
+  return NULL;
+}
+
+/// @brief Runs the task on the current thread and completes its future
+static void PblExecutorRunTask(struct PblExecutorState *state, struct PblExecutorTask *task) {
+  const PblFunctionDescriptor_T *descriptor = task->descriptor;
+  PblFunctionCallMetaData_T *ctx =
+    PblGetMetaFunctionCallCtxT(PblInternCString(descriptor->name), PblGetBoolT(false),
+                               PblGetUIntT(descriptor->arg_amount), PblGetBoolT(true), NULL, NULL, NULL);
+  ctx->actual.descriptor = descriptor;
+
+  void *result = task->entry(ctx, task->args.values);
+  PblFuture_T *future = task->future;
+  future->actual.ctx = ctx;
+  future->actual.result = ctx->actual.is_failure->actual ? NULL : result;
+  __atomic_store_n(&future->actual.done, 1, __ATOMIC_RELEASE);
+
+  size_t pending = atomic_fetch_sub_explicit(&state->pending_tasks, 1, memory_order_seq_cst) - 1;
+  bool stopped = pending == 0 && atomic_load_explicit(&state->stopping, memory_order_seq_cst);
+  if (atomic_load_explicit(&state->waiting_threads, memory_order_seq_cst) > 0 || stopped) {
+    pthread_mutex_lock(&state->lock);
+    pthread_cond_broadcast(&state->task_finished);
+    if (stopped) pthread_cond_broadcast(&state->work_available);
+    pthread_mutex_unlock(&state->lock);
+  }
+}
+
+/// @brief Wakes a sleeping worker after a task was spawned, or the threads waiting for futures if no worker sleeps, as
+/// they run tasks while waiting as well
+static void PblExecutorNotify(struct PblExecutorState *state) {
+  atomic_thread_fence(memory_order_seq_cst);
+  if (atomic_load_explicit(&state->sleeping_workers, memory_order_seq_cst) > 0) {
+    pthread_mutex_lock(&state->lock);
+    pthread_cond_signal(&state->work_available);
+    pthread_mutex_unlock(&state->lock);
+  } else if (atomic_load_explicit(&state->waiting_threads, memory_order_seq_cst) > 0) {
+    pthread_mutex_lock(&state->lock);
+    pthread_cond_broadcast(&state->task_finished);
+    pthread_mutex_unlock(&state->lock);
+  }
+}
+
+/// @brief Waits on the condition variable until it is signaled or 'PBL_EXECUTOR_IDLE_TIMEOUT_NS' passed
+static void PblExecutorTimedWait(pthread_cond_t *cond, pthread_mutex_t *lock) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += PBL_EXECUTOR_IDLE_TIMEOUT_NS;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  pthread_cond_timedwait(cond, lock, &deadline);
+}
+
+/// @brief Returns whether the workers should exit, which is the case once the executor is stopping and all tasks
+/// finished
+static bool PblExecutorShouldExit(struct PblExecutorState *state) {
+  return atomic_load_explicit(&state->stopping, memory_order_seq_cst) &&
+         atomic_load_explicit(&state->pending_tasks, memory_order_seq_cst) == 0;
+}
+
+static void *PblExecutorWorkerMain(void *arg) {
+  struct PblExecutorWorker *worker = arg;
+  struct PblExecutorState *state = worker->state;
+
+  // The worker allocates and holds references to collectable memory, so its stack has to be scanned
+  struct GC_stack_base stack_base;
+  bool registered = GC_get_stack_base(&stack_base) == GC_SUCCESS && GC_register_my_thread(&stack_base) == GC_SUCCESS;
+  PBL_EXECUTOR_CURRENT_WORKER = worker;
+
+  while (true) {
+    struct PblExecutorTask *task = PblExecutorFindTask(state);
+    if (task != NULL) {
+      PblExecutorRunTask(state, task);
+      continue;
+    }
+    if (PblExecutorShouldExit(state)) break;
+
+    pthread_mutex_lock(&state->lock);
+    atomic_fetch_add_explicit(&state->sleeping_workers, 1, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!PblExecutorHasTasks(state) && !PblExecutorShouldExit(state))
+      PblExecutorTimedWait(&state->work_available, &state->lock);
+    atomic_fetch_sub_explicit(&state->sleeping_workers, 1, memory_order_seq_cst);
+    pthread_mutex_unlock(&state->lock);
+  }
+
+  PBL_EXECUTOR_CURRENT_WORKER = NULL;
+  if (registered) GC_unregister_my_thread();
+  return NULL;
+}
+
+// ---- End of Workers ------------------------------------------------------------------------------------------------
+
+// ---- Functions Implementation --------------------------------------------------------------------------------------
+
+PblExecutor_T *PblExecutorCreate_Base(size_t threads) {
+  // Allows the workers to register themselves with the garbage collector
+  GC_allow_register_threads();
+
+  struct PblExecutorState *state = PblMallocUncollectable(sizeof(struct PblExecutorState));
+  state->workers = PblMallocUncollectable(threads * sizeof(struct PblExecutorWorker));
+  state->workers_len = threads;
+  pthread_mutex_init(&state->lock, NULL);
+  pthread_cond_init(&state->work_available, NULL);
+  pthread_cond_init(&state->task_finished, NULL);
+  state->queue = PblMallocUncollectable(PBL_EXECUTOR_QUEUE_INITIAL_SIZE * sizeof(struct PblExecutorTask *));
+  state->queue_head = 0;
+  state->queue_capacity = PBL_EXECUTOR_QUEUE_INITIAL_SIZE;
+  atomic_init(&state->queue_len, 0);
+  atomic_init(&state->sleeping_workers, 0);
+  atomic_init(&state->waiting_threads, 0);
+  atomic_init(&state->pending_tasks, 0);
+  atomic_init(&state->stopping, false);
+
+  for (size_t i = 0; i < threads; i++) {
+    struct PblExecutorWorker *worker = &state->workers[i];
+    worker->state = state;
+    atomic_init(&worker->deque.top, 0);
+    atomic_init(&worker->deque.bottom, 0);
+  }
+  for (size_t i = 0; i < threads; i++) {
+    if (pthread_create(&state->workers[i].thread, NULL, PblExecutorWorkerMain, &state->workers[i]) != 0)
+      PblAbortWithCriticalError(1, "Para: Failed to start the worker threads of an executor");
+  }
+
+  PBL_DEFINE_VAR(executor, PblExecutor_T);
+  executor->actual.state = state;
+  executor->actual.threads = threads;
+  return executor;
+}
+
+__attribute__((unused)) PblExecutor_T *PblExecutorCreate_Overhead(struct PblExecutorCreate_Args in) {
+  size_t threads = in.threads;
+  if (threads == 0) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = processors > 0 ? (size_t) processors : 1;
+  }
+  return PblExecutorCreate_Base(threads);
+}
+
+void PblExecutorShutdown(PblExecutor_T *executor) {
+  // Validate the pointer for safety measures
+  executor = PblValPtr((void *) executor);
+  struct PblExecutorState *state = executor->actual.state;
+  if (state == NULL) return;
+
+  pthread_mutex_lock(&state->lock);
+  atomic_store_explicit(&state->stopping, true, memory_order_seq_cst);
+  pthread_cond_broadcast(&state->work_available);
+  pthread_mutex_unlock(&state->lock);
+
+  for (size_t i = 0; i < state->workers_len; i++) pthread_join(state->workers[i].thread, NULL);
+
+  pthread_cond_destroy(&state->task_finished);
+  pthread_cond_destroy(&state->work_available);
+  pthread_mutex_destroy(&state->lock);
+  PblFree(state->queue);
+  PblFree(state->workers);
+  PblFree(state);
+  executor->actual.state = NULL;
+}
+
+PblFuture_T *PblSpawnTask(PblExecutor_T *executor, const PblFunctionDescriptor_T *descriptor, PblSpawnEntry_T entry,
+                          PblSpawnArgs_T args) {
+  // Validate the pointer for safety measures
+  executor = PblValPtr((void *) executor);
+  descriptor = PblValPtr((void *) descriptor);
+  struct PblExecutorState *state = PblValPtr((void *) executor->actual.state);
+
+  if (args.amount > PBL_SPAWN_MAX_ARGS || args.amount != descriptor->arg_amount)
+    PblAbortWithCriticalError(1, "Para: Invalid amount of arguments passed to a spawned function");
+
+  PBL_DEFINE_VAR(future, PblFuture_T);
+  future->actual.state = state;
+
+  struct PblExecutorTask *task = PblMalloc(sizeof(struct PblExecutorTask));
+  task->future = future;
+  task->descriptor = descriptor;
+  task->entry = entry;
+  task->args = args;
+
+  atomic_fetch_add_explicit(&state->pending_tasks, 1, memory_order_seq_cst);
+  struct PblExecutorWorker *worker = PBL_EXECUTOR_CURRENT_WORKER;
+  if (worker == NULL || worker->state != state || !PblDequePush(&worker->deque, task))
+    PblExecutorQueuePush(state, task);
+  PblExecutorNotify(state);
+  return future;
+}
+
+bool PblFutureIsDone(PblFuture_T *future) {
+  // Validate the pointer for safety measures
+  future = PblValPtr((void *) future);
+  return __atomic_load_n(&future->actual.done, __ATOMIC_ACQUIRE) != 0;
+}
+
+void *PblFutureAwait(PblFuture_T *future, PblFunctionCallMetaData_T *ctx) {
+  // Validate the pointer for safety measures
+  future = PblValPtr((void *) future);
+  struct PblExecutorState *state = future->actual.state;
+
+  // Running other tasks while waiting, which also prevents workers from blocking on tasks queued behind them
+  while (!PblFutureIsDone(future)) {
+    struct PblExecutorTask *task = PblExecutorFindTask(state);
+    if (task != NULL) {
+      PblExecutorRunTask(state, task);
+      continue;
+    }
+
+    pthread_mutex_lock(&state->lock);
+    atomic_fetch_add_explicit(&state->waiting_threads, 1, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!PblFutureIsDone(future) && !PblExecutorHasTasks(state))
+      PblExecutorTimedWait(&state->task_finished, &state->lock);
+    atomic_fetch_sub_explicit(&state->waiting_threads, 1, memory_order_seq_cst);
+    pthread_mutex_unlock(&state->lock);
+  }
+
+  PblFunctionCallMetaData_T *task_ctx = future->actual.ctx;
+  if (!task_ctx->actual.is_failure->actual) return future->actual.result;
+
+  if (ctx != NULL) {
+    // Passing the exception on to the waiting function, whose traceback continues into the spawned function
+    ctx->actual.is_failure = PblGetBoolT(true);
+    ctx->actual.exception = task_ctx->actual.exception;
+    ctx->actual.failure_origin_ctx =
+      task_ctx->actual.failure_origin_ctx != NULL ? task_ctx->actual.failure_origin_ctx : task_ctx;
+    task_ctx->actual.call_origin_ctx = ctx;
+  }
+  return NULL;
+}
+
+// ---- End of Functions Implementation -------------------------------------------------------------------------------
@@ -6,6 +6,146 @@
 /// @copyright Copyright (c) 2021
 
 #include <libpbl/func/pbl-function.h>
+#include <pthread.h>
+#include <stdarg.h>
+
+// ---- Stack Call Context --------------------------------------------------------------------------------------------
+
+const PblType_T PBL_STACK_CALL_CTX_TYPE = {.actual_size = sizeof(PblStackCallCtx_T),
+                                           .usable_size = sizeof(PblStackCallCtx_T) - sizeof(PblVarMetaData_T),
+                                           .type_template = NULL,
+                                           .name = "PblStackCallCtx_T",
+                                           .user_defined = false,
+                                           .definable = false};
+
+/// @brief Returns whether the passed call ctx is located in the stack
+#define PBL_IS_STACK_CALL_CTX(ctx) ((ctx)->meta.type == (PblType_T *) &PBL_STACK_CALL_CTX_TYPE)
+
+// ---- End of Stack Call Context -------------------------------------------------------------------------------------
+
+// ---- Exception Classes ---------------------------------------------------------------------------------------------
+
+PblExceptionClass_T PblBaseException = {
+  .name = "PblBaseException", .parent = NULL, .id = 0, .depth = 0, .display = {0}};
+
+/// @brief Lock, which serialises the registration of exception classes
+static pthread_mutex_t PBL_EXCEPTION_CLASS_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/// @brief The id of the last registered exception class
+static unsigned int PBL_EXCEPTION_CLASS_LAST_ID = 0;
+
+/// @brief Registers the class and its parents - requires 'PBL_EXCEPTION_CLASS_LOCK' to be held
+static void PblRegisterExceptionClassLocked(PblExceptionClass_T *exc_class) {
+  if (exc_class->id != 0) return;
+
+  unsigned int depth = 0;
+  if (exc_class->parent != NULL) {
+    PblRegisterExceptionClassLocked(exc_class->parent);
+    depth = exc_class->parent->depth + 1;
+    if (depth >= PBL_EXCEPTION_CLASS_MAX_DEPTH)
+      PblAbortWithCriticalError(1, "Para: Exceeded the max. depth of the exception class hierarchy");
+    memcpy(exc_class->display, exc_class->parent->display, sizeof(unsigned int) * depth);
+  }
+
+  unsigned int id = ++PBL_EXCEPTION_CLASS_LAST_ID;
+  exc_class->depth = depth;
+  exc_class->display[depth] = id;
+
+  // Publishing the id last, so a thread that sees the id also sees the depth and display
+  __atomic_store_n(&exc_class->id, id, __ATOMIC_RELEASE);
+}
+
+PBL_DEFINE_EXCEPTION_CLASS(PblMemoryError, PblBaseException)
+PBL_DEFINE_EXCEPTION_CLASS(PblNullAccessError, PblBaseException)
+
+// ---- End of Exception Classes --------------------------------------------------------------------------------------
+
+// ---- Exception Pool ------------------------------------------------------------------------------------------------
+
+const PblType_T PBL_PREALLOCATED_EXCEPTION_TYPE = {.actual_size = sizeof(PblException_T),
+                                                   .usable_size = sizeof(PblException_T) - sizeof(PblVarMetaData_T),
+                                                   .type_template = NULL,
+                                                   .name = "PblPreallocatedException",
+                                                   .user_defined = false,
+                                                   .definable = false};
+
+/// @brief Returns whether the passed exception is one of the preallocated exceptions
+#define PBL_IS_PREALLOCATED_EXCEPTION(exc) ((exc)->meta.type == (PblType_T *) &PBL_PREALLOCATED_EXCEPTION_TYPE)
+
+static const PblRaiseSite_T PBL_OUT_OF_MEMORY_SITE = {.exc_class = &PblMemoryError,
+                                                      .name = NULL,
+                                                      .msg = "Out of memory",
+                                                      .filename = NULL,
+                                                      .line = 0,
+                                                      .line_content = NULL};
+
+static const PblRaiseSite_T PBL_NULL_ACCESS_SITE = {.exc_class = &PblNullAccessError,
+                                                    .name = NULL,
+                                                    .msg = "Attempted to access NULL",
+                                                    .filename = NULL,
+                                                    .line = 0,
+                                                    .line_content = NULL};
+
+PblException_T PblOutOfMemoryException = {
+  .meta = {.defined = true, .type = (PblType_T *) &PBL_PREALLOCATED_EXCEPTION_TYPE},
+  .actual = {.site = &PBL_OUT_OF_MEMORY_SITE, .exc_class = &PblMemoryError}};
+
+PblException_T PblNullAccessException = {
+  .meta = {.defined = true, .type = (PblType_T *) &PBL_PREALLOCATED_EXCEPTION_TYPE},
+  .actual = {.site = &PBL_NULL_ACCESS_SITE, .exc_class = &PblNullAccessError}};
+
+/// @brief Deallocated exceptions of a thread, which are reused by the next raised exceptions
+struct PblExceptionPool {
+  size_t len;
+  PblException_T *items[PBL_EXCEPTION_POOL_SIZE];
+};
+
+/// @brief The exception pool of the current thread, which is NULL until the thread deallocates its first exception
+static _Thread_local struct PblExceptionPool *PBL_EXCEPTION_THREAD_POOL = NULL;
+
+/// @brief The key, whose destructor frees the exception pool of an exiting thread
+static pthread_key_t PBL_EXCEPTION_POOL_KEY;
+static pthread_once_t PBL_EXCEPTION_POOL_KEY_ONCE = PTHREAD_ONCE_INIT;
+
+/// @brief Frees the pool of the exiting thread, which leaves the pooled exceptions to the garbage collector
+static void PblFreeExceptionPool(void *pool) {
+  PBL_EXCEPTION_THREAD_POOL = NULL;
+  PblFree(pool);
+}
+
+static void PblCreateExceptionPoolKey(void) { pthread_key_create(&PBL_EXCEPTION_POOL_KEY, PblFreeExceptionPool); }
+
+/// @brief Gets an exception from the pool of the current thread, or allocates a new one if the pool is empty
+static PblException_T *PblAcquireException(void) {
+  struct PblExceptionPool *pool = PBL_EXCEPTION_THREAD_POOL;
+  if (pool != NULL && pool->len > 0) {
+    PblException_T *exc = pool->items[--pool->len];
+    pool->items[pool->len] = NULL;
+    return exc;
+  }
+  return PblMalloc(sizeof(PblException_T));
+}
+
+/// @brief Keeps the exception in the pool of the current thread, or frees it if the pool is full
+static void PblReleaseException(PblException_T *exc) {
+  struct PblExceptionPool *pool = PBL_EXCEPTION_THREAD_POOL;
+  if (pool == NULL) {
+    pthread_once(&PBL_EXCEPTION_POOL_KEY_ONCE, PblCreateExceptionPoolKey);
+
+    // The pool is scanned by the garbage collector, so the pooled exceptions are kept alive
+    pool = PblMallocUncollectable(sizeof(struct PblExceptionPool));
+    pool->len = 0;
+    PBL_EXCEPTION_THREAD_POOL = pool;
+    pthread_setspecific(PBL_EXCEPTION_POOL_KEY, pool);
+  }
+
+  if (pool->len < PBL_EXCEPTION_POOL_SIZE)
+    pool->items[pool->len++] = exc;
+  else
+    PblFree(exc);
+}
+
+// ---- End of Exception Pool -----------------------------------------------------------------------------------------
 
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
@@ -27,10 +167,52 @@ PblFunctionCallMetaData_T *PblGetMetaFunctionCallCtxT(PblString_T *function_iden
   return ptr;
 }
 
+uint64_t PblGetFunctionId(const char *name) {
+  size_t len = strlen(name);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < PBL_FUNC_ID_MAX_HASHED_CHARS; i++) {
+    hash ^= i < len ? (unsigned char) name[i] : 0;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash ^ (uint64_t) len;
+}
+
+PblFunctionCallMetaData_T *PblPromoteCallCtx(PblFunctionCallMetaData_T *ctx) {
+  // Validate the pointer for safety measures
+  ctx = PblValPtr((void *) ctx);
+  if (!PBL_IS_STACK_CALL_CTX(ctx)) return ctx;
+
+  const PblFunctionDescriptor_T *descriptor = ctx->actual.descriptor;
+  PblFunctionCallMetaData_T *promoted = PblGetMetaFunctionCallCtxT(
+    PblInternCString(descriptor->name), PblGetBoolT(ctx->actual.is_failure->actual),
+    PblGetUIntT(ctx->actual.arg_amount->actual), ctx->actual.is_threaded, NULL, ctx->actual.call_origin_ctx,
+    ctx->actual.exception);
+  promoted->actual.descriptor = descriptor;
+
+  PblFunctionCallMetaData_T *origin = ctx->actual.failure_origin_ctx;
+  if (origin == ctx) {
+    promoted->actual.failure_origin_ctx = promoted;
+  } else if (origin != NULL) {
+    // The ctxs below this one were already promoted when the exception escaped them, so only the ctx whose call origin
+    // is this one has to be updated
+    for (PblFunctionCallMetaData_T *child = origin; child != NULL; child = child->actual.call_origin_ctx) {
+      if (child->actual.call_origin_ctx == ctx) {
+        child->actual.call_origin_ctx = promoted;
+        break;
+      }
+    }
+    promoted->actual.failure_origin_ctx = origin;
+  }
+  return promoted;
+}
+
 __attribute__((unused)) PblVoid_T PblDeallocateMetaFunctionCallCtxT(PblFunctionCallMetaData_T *ctx) {
   // Validate the pointer for safety measures
   ctx = PblValPtr((void *) ctx);
 
+  // The memory of stack ctxs is owned by the stack frame of the caller
+  if (PBL_IS_STACK_CALL_CTX(ctx)) return PblVoid_T_DeclDefault;
+
   if (ctx->meta.defined) {
     if (ctx->actual.exception != NULL) PblDeallocateExceptionT(ctx->actual.exception);
     if (ctx->actual.function_identifier != NULL) PblDeallocateStringT(ctx->actual.function_identifier);
@@ -45,7 +227,7 @@ __attribute__((unused)) PblVoid_T PblDeallocateMetaFunctionCallCtxT(PblFunctionC
 
 PblException_T *PblGetExceptionT(PblString_T *msg, PblString_T *name, PblString_T *filename, PblUInt_T *line,
                                  PblString_T *line_content, PblVoid_T *parent_exc, PblVoid_T *child_exc) {
-  PBL_DEFINE_VAR(ptr, PblException_T);
+  PblException_T *ptr = PblAcquireException();
 
   // Using the Definition Default
   *ptr = PblException_T_DefDefault;
@@ -60,12 +242,197 @@ PblException_T *PblGetExceptionT(PblString_T *msg, PblString_T *name, PblString_
   return ptr;
 }
 
+PblException_T *PblGetLazyExceptionT(const PblRaiseSite_T *site) {
+  // Validate the pointer for safety measures
+  site = PblValPtr((void *) site);
+
+  PblException_T *ptr = PblAcquireException();
+  *ptr = PblException_T_DefDefault;
+  ptr->actual.site = site;
+  ptr->actual.exc_class = site->exc_class;
+  return ptr;
+}
+
+void PblRegisterExceptionClass(PblExceptionClass_T *exc_class) {
+  // Validate the pointer for safety measures
+  exc_class = PblValPtr((void *) exc_class);
+
+  pthread_mutex_lock(&PBL_EXCEPTION_CLASS_LOCK);
+  PblRegisterExceptionClassLocked(exc_class);
+  pthread_mutex_unlock(&PBL_EXCEPTION_CLASS_LOCK);
+}
+
+bool PblIsExceptionSubclass(PblExceptionClass_T *sub_class, PblExceptionClass_T *exc_class) {
+  // Validate the pointer for safety measures
+  sub_class = PblValPtr((void *) sub_class);
+  exc_class = PblValPtr((void *) exc_class);
+
+  if (__atomic_load_n(&sub_class->id, __ATOMIC_ACQUIRE) == 0) PblRegisterExceptionClass(sub_class);
+  if (__atomic_load_n(&exc_class->id, __ATOMIC_ACQUIRE) == 0) PblRegisterExceptionClass(exc_class);
+
+  // A class inherits from another class if the other class is found at its own depth in the display of the class
+  return sub_class->depth >= exc_class->depth && sub_class->display[exc_class->depth] == exc_class->id;
+}
+
+bool PblIsExceptionInstance(PblException_T *exc, PblExceptionClass_T *exc_class) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  return PblIsExceptionSubclass(exc->actual.exc_class != NULL ? exc->actual.exc_class : &PblBaseException, exc_class);
+}
+
+/// @brief Caches the lazily created property of the exception, unless the exception is preallocated. Preallocated
+/// exceptions are shared between all threads, which is why they are never written to and the property is created on
+/// every access (interned strings for the message and name)
+#define PBL_CACHE_EXCEPTION_PROPERTY(exc, property, val)                                                               \
+  (PBL_IS_PREALLOCATED_EXCEPTION(exc) ? (val) : ((exc)->actual.property = (val)))
+
+PblString_T *PblGetExceptionMsg(PblException_T *exc) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  if (exc->actual.msg == NULL && exc->actual.site != NULL && exc->actual.site->msg != NULL)
+    return PBL_IS_PREALLOCATED_EXCEPTION(exc) ? PblInternCString(exc->actual.site->msg)
+                                              : (exc->actual.msg = PblGetStringT(exc->actual.site->msg));
+  return exc->actual.msg;
+}
+
+PblString_T *PblGetExceptionName(PblException_T *exc) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  if (exc->actual.name == NULL && exc->actual.site != NULL && exc->actual.site->name != NULL)
+    return PBL_CACHE_EXCEPTION_PROPERTY(exc, name, PblInternCString(exc->actual.site->name));
+  if (exc->actual.name == NULL && exc->actual.exc_class != NULL)
+    return PBL_CACHE_EXCEPTION_PROPERTY(exc, name, PblInternCString(exc->actual.exc_class->name));
+  return exc->actual.name;
+}
+
+PblString_T *PblGetExceptionFilename(PblException_T *exc) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  if (exc->actual.filename == NULL && exc->actual.site != NULL && exc->actual.site->filename != NULL)
+    return PBL_CACHE_EXCEPTION_PROPERTY(exc, filename, PblGetStringT(exc->actual.site->filename));
+  return exc->actual.filename;
+}
+
+PblUInt_T *PblGetExceptionLine(PblException_T *exc) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  if (exc->actual.line == NULL && exc->actual.site != NULL)
+    return PBL_CACHE_EXCEPTION_PROPERTY(exc, line, PblGetUIntT(exc->actual.site->line));
+  return exc->actual.line;
+}
+
+PblString_T *PblGetExceptionLineContent(PblException_T *exc) {
+  // Validate the pointer for safety measures
+  exc = PblValPtr((void *) exc);
+  if (exc->actual.line_content == NULL && exc->actual.site != NULL && exc->actual.site->line_content != NULL)
+    return PBL_CACHE_EXCEPTION_PROPERTY(exc, line_content, PblGetStringT(exc->actual.site->line_content));
+  return exc->actual.line_content;
+}
+
+/// @brief Growing buffer the traceback is formatted into
+struct PblTracebackBuffer {
+  char *content;
+  size_t len;
+  size_t capacity;
+};
+
+/// @brief Appends the formatted string to the traceback buffer
+__attribute__((format(printf, 2, 3))) static void PblAppendToTraceback(struct PblTracebackBuffer *buffer,
+                                                                        const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  if (len <= 0) return;
+
+  if (buffer->len + (size_t) len + 1 > buffer->capacity) {
+    size_t capacity = buffer->capacity * 2;
+    while (capacity < buffer->len + (size_t) len + 1) capacity *= 2;
+    buffer->content = PblRealloc(buffer->content, capacity);
+    buffer->capacity = capacity;
+  }
+  va_start(args, format);
+  vsnprintf(buffer->content + buffer->len, (size_t) len + 1, format, args);
+  va_end(args);
+  buffer->len += (size_t) len;
+}
+
+/// @brief Appends the call of the passed ctx to the traceback buffer
+static void PblAppendCallToTraceback(struct PblTracebackBuffer *buffer, PblFunctionCallMetaData_T *ctx) {
+  const PblFunctionDescriptor_T *descriptor = ctx->actual.descriptor;
+  if (descriptor != NULL) {
+    PblAppendToTraceback(buffer, "  in %s (%s at %s:%u)\n", descriptor->name,
+                         descriptor->is_call_site ? "called" : "declared", descriptor->filename, descriptor->line);
+  } else if (ctx->actual.function_identifier != NULL) {
+    PblAppendToTraceback(buffer, "  in %s\n", PblGetStringBytes(ctx->actual.function_identifier));
+  } else {
+    PblAppendToTraceback(buffer, "  in <unknown>\n");
+  }
+}
+
+PblString_T *PblFormatTraceback(PblFunctionCallMetaData_T *ctx) {
+  // Validate the pointer for safety measures
+  ctx = PblValPtr((void *) ctx);
+  if (ctx->actual.is_failure == NULL || !ctx->actual.is_failure->actual || ctx->actual.exception == NULL) return NULL;
+
+  // Collecting the ctxs from the origin of the failure up to the passed ctx, as the traceback lists them in reverse
+  size_t depth = 0;
+  PblFunctionCallMetaData_T *origin = ctx->actual.failure_origin_ctx != NULL ? ctx->actual.failure_origin_ctx : ctx;
+  for (PblFunctionCallMetaData_T *call = origin; call != NULL; call = call->actual.call_origin_ctx) {
+    depth++;
+    if (call == ctx) break;
+  }
+  PblFunctionCallMetaData_T **calls = PblMalloc(sizeof(PblFunctionCallMetaData_T *) * depth);
+  size_t index = 0;
+  for (PblFunctionCallMetaData_T *call = origin; index < depth; call = call->actual.call_origin_ctx) {
+    calls[index++] = call;
+  }
+
+  struct PblTracebackBuffer buffer = {.content = PblMallocAtomic(256), .len = 0, .capacity = 256};
+  PblAppendToTraceback(&buffer, "Traceback (most recent call last):\n");
+  for (size_t i = depth; i > 0; i--) {
+    PblFunctionCallMetaData_T *call = calls[i - 1];
+    // The catching ctx itself is only listed if it belongs to a called function
+    if (call == ctx && call != origin && call->actual.descriptor == NULL && call->actual.function_identifier == NULL)
+      continue;
+    PblAppendCallToTraceback(&buffer, call);
+  }
+
+  PblException_T *exc = ctx->actual.exception;
+  PblString_T *filename = PblGetExceptionFilename(exc);
+  PblUInt_T *line = PblGetExceptionLine(exc);
+  PblString_T *line_content = PblGetExceptionLineContent(exc);
+  if (filename != NULL && line != NULL) {
+    PblAppendToTraceback(&buffer, "    raised at %s:%u", PblGetStringBytes(filename), line->actual);
+    if (line_content != NULL) PblAppendToTraceback(&buffer, ": %s", PblGetStringBytes(line_content));
+    PblAppendToTraceback(&buffer, "\n");
+  }
+
+  PblString_T *name = PblGetExceptionName(exc);
+  PblString_T *msg = PblGetExceptionMsg(exc);
+  PblAppendToTraceback(&buffer, "%s: %s\n", name != NULL ? PblGetStringBytes(name) : "Exception",
+                       msg != NULL ? PblGetStringBytes(msg) : "");
+
+  PblString_T *traceback = PblGetStringT(buffer.content);
+  PblFree(buffer.content);
+  PblFree(calls);
+  return traceback;
+}
+
 PblVoid_T PblRaiseNewException(PblFunctionCallMetaData_T *this_call_meta, PblException_T *exception) {
   // Validate the pointer for safety measures
   this_call_meta = PblValPtr((void *) this_call_meta);
   exception = PblValPtr((void *) exception);
 
-  this_call_meta->actual.is_failure = PblGetBoolT(true);
+  // Stack ctxs own the storage of their failure flag, so it can be updated without allocating. The flag of other ctxs
+  // may be shared with other ctxs, so it is replaced by a newly allocated flag instead of being written to
+  if (PBL_IS_STACK_CALL_CTX(this_call_meta)) {
+    PblStackCallCtx_T *stack_ctx = (PblStackCallCtx_T *) this_call_meta;
+    stack_ctx->is_failure.actual = true;
+    this_call_meta->actual.is_failure = &stack_ctx->is_failure;
+  } else {
+    this_call_meta->actual.is_failure = PblGetBoolT(true);
+  }
   this_call_meta->actual.failure_origin_ctx = this_call_meta;
   this_call_meta->actual.exception = exception;
   return PblVoid_T_DeclDefault;
@@ -77,8 +444,8 @@ PblVoid_T PblDeallocateExceptionT(PblException_T *exc) {
   // Validate the pointer for safety measures
   exc = PblValPtr((void *) exc);
 
-  // only if the exception is still defined
-  if (exc->meta.defined) {
+  // only if the exception is still defined and not preallocated
+  if (exc->meta.defined && !PBL_IS_PREALLOCATED_EXCEPTION(exc)) {
     // deallocate if the values are defined -> if not, skip de-allocation
 
     if (exc->actual.msg != NULL && exc->actual.msg->meta.defined) PblDeallocateStringT(exc->actual.msg);
@@ -88,7 +455,7 @@ PblVoid_T PblDeallocateExceptionT(PblException_T *exc) {
       PblDeallocateStringT(exc->actual.line_content);
 
     *exc = PblException_T_DeclDefault;
-    PblFree(exc);
+    PblReleaseException(exc);
     exc = NULL;
   }
   return PblVoid_T_DeclDefault;
@@ -0,0 +1,293 @@
+/// @file pbl-memoize.c
+/// @brief Memoisation of pure Pbl functions, where the cache is split into shards that each have their own lock, hash
+/// table and LRU list
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/func/pbl-memoize.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// Locks of the shards
+#include <pthread.h>
+
+// ---- Cache State ---------------------------------------------------------------------------------------------------
+
+/// @brief A cached result, which is both in the chain of its bucket and in the LRU list of its shard
+struct PblMemoEntry {
+  /// @brief The hash of the key
+  uint64_t hash;
+  /// @brief The cached result
+  void *result;
+  /// @brief The next entry in the chain of the bucket
+  struct PblMemoEntry *bucket_next;
+  /// @brief The more recently used entry, or NULL if this is the most recently used one
+  struct PblMemoEntry *lru_prev;
+  /// @brief The less recently used entry, or NULL if this is the least recently used one
+  struct PblMemoEntry *lru_next;
+  /// @brief The amount of args of the key
+  size_t len;
+  /// @brief The copied args of the key
+  PblMemoKeyArg_T key[];
+};
+
+/// @brief A part of the cache, which is selected using the upper bits of the hash
+struct PblMemoShard {
+  /// @brief The lock protecting the entries and statistics of the shard
+  pthread_mutex_t lock;
+  /// @brief The chains of the hash table, which has as many buckets as the shard has capacity (rounded up to a power
+  /// of two)
+  struct PblMemoEntry **buckets;
+  /// @brief The amount of buckets minus one
+  size_t bucket_mask;
+  /// @brief The amount of cached results
+  size_t size;
+  /// @brief The most recently used entry
+  struct PblMemoEntry *lru_head;
+  /// @brief The least recently used entry, which is evicted first
+  struct PblMemoEntry *lru_tail;
+  /// @brief The statistics of the shard
+  uint64_t hits, misses, evictions;
+  /// @brief Keeps the shards on separate cache lines, as they are locked by different threads
+  char padding[64];
+};
+
+/// @brief The internal state of a cache
+struct PblMemoState {
+  /// @brief The max. amount of results per shard
+  size_t shard_capacity;
+  /// @brief The amount of shards minus one
+  size_t shard_mask;
+  /// @brief The shards of the cache
+  struct PblMemoShard shards[];
+};
+
+/// @brief Creates the state of the passed cache, which is split into as many shards as the capacity allows
+static struct PblMemoState *PblMemoCreateState(size_t capacity) {
+  size_t shard_count = 1;
+  while (shard_count < PBL_MEMO_MAX_SHARDS && capacity / (shard_count * 2) >= PBL_MEMO_MIN_SHARD_CAPACITY)
+    shard_count *= 2;
+  size_t shard_capacity = (capacity + shard_count - 1) / shard_count;
+  if (shard_capacity == 0) shard_capacity = 1;
+  size_t bucket_count = 1;
+  while (bucket_count < shard_capacity) bucket_count *= 2;
+
+  struct PblMemoState *state = PblMalloc(sizeof(struct PblMemoState) + shard_count * sizeof(struct PblMemoShard));
+  state->shard_capacity = shard_capacity;
+  state->shard_mask = shard_count - 1;
+  for (size_t i = 0; i < shard_count; i++) {
+    struct PblMemoShard *shard = &state->shards[i];
+    pthread_mutex_init(&shard->lock, NULL);
+    shard->buckets = PblMalloc(bucket_count * sizeof(struct PblMemoEntry *));
+    shard->bucket_mask = bucket_count - 1;
+  }
+  return state;
+}
+
+/// @brief Gets the state of the passed cache, which is created if this is the first call
+static struct PblMemoState *PblMemoGetState(PblMemoCache_T *cache) {
+  struct PblMemoState *state = __atomic_load_n((struct PblMemoState **) &cache->state, __ATOMIC_ACQUIRE);
+  if (state != NULL) return state;
+
+  // Threads calling the function for the first time at the same time race, where only the first state is kept
+  struct PblMemoState *created = PblMemoCreateState(cache->capacity);
+  if (__atomic_compare_exchange_n((struct PblMemoState **) &cache->state, &state, created, false, __ATOMIC_ACQ_REL,
+                                  __ATOMIC_ACQUIRE))
+    return created;
+  return state;
+}
+
+// ---- End of Cache State --------------------------------------------------------------------------------------------
+
+// ---- Keys ----------------------------------------------------------------------------------------------------------
+
+/// @brief Mixes the bits of the passed value, so that every bit of the input affects every bit of the output
+static inline uint64_t PblMemoMix(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+/// @brief Hashes the passed key, where the rotation makes the position of every arg part of the hash. Only the result
+/// is mixed entirely, as the args are combined with a single multiplication each
+static uint64_t PblMemoHashKey(const PblMemoKeyArg_T *key, size_t len) {
+  uint64_t hash = len;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash << 23) | (hash >> 41);
+    hash = (hash ^ key[i].bits ^ key[i].extra_bits ^ ((uint64_t) key[i].type << 62)) * 0x9e3779b97f4a7c15ULL;
+  }
+  return PblMemoMix(hash);
+}
+
+/// @brief Returns whether the passed keys are equal, where strings are compared by their content
+static bool PblMemoKeyEquals(const PblMemoKeyArg_T *key_1, const PblMemoKeyArg_T *key_2, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (key_1[i].type != key_2[i].type || key_1[i].bits != key_2[i].bits || key_1[i].extra_bits != key_2[i].extra_bits)
+      return false;
+    if (key_1[i].type == PBL_MEMO_KEY_ARG_STRING && key_1[i].str != key_2[i].str &&
+        !PblStringEquals(key_1[i].str, key_2[i].str))
+      return false;
+  }
+  return true;
+}
+
+// ---- End of Keys ---------------------------------------------------------------------------------------------------
+
+// ---- Shards --------------------------------------------------------------------------------------------------------
+
+/// @brief Gets the shard the passed hash belongs to
+static inline struct PblMemoShard *PblMemoGetShard(struct PblMemoState *state, uint64_t hash) {
+  return &state->shards[(hash >> 48) & state->shard_mask];
+}
+
+/// @brief Finds the entry with the passed key in the shard, or returns NULL if there is none
+/// @note The lock of the shard has to be held
+static struct PblMemoEntry *PblMemoFind(struct PblMemoShard *shard, uint64_t hash, const PblMemoKeyArg_T *key,
+                                        size_t len) {
+  for (struct PblMemoEntry *entry = shard->buckets[hash & shard->bucket_mask]; entry != NULL;
+       entry = entry->bucket_next) {
+    if (entry->hash == hash && entry->len == len && PblMemoKeyEquals(entry->key, key, len)) return entry;
+  }
+  return NULL;
+}
+
+/// @brief Removes the entry from the LRU list of the shard
+/// @note The lock of the shard has to be held
+static void PblMemoUnlinkLRU(struct PblMemoShard *shard, struct PblMemoEntry *entry) {
+  if (entry->lru_prev != NULL) entry->lru_prev->lru_next = entry->lru_next;
+  else shard->lru_head = entry->lru_next;
+  if (entry->lru_next != NULL) entry->lru_next->lru_prev = entry->lru_prev;
+  else shard->lru_tail = entry->lru_prev;
+  entry->lru_prev = entry->lru_next = NULL;
+}
+
+/// @brief Adds the entry as the most recently used one to the LRU list of the shard
+/// @note The lock of the shard has to be held
+static void PblMemoPushLRU(struct PblMemoShard *shard, struct PblMemoEntry *entry) {
+  entry->lru_next = shard->lru_head;
+  if (shard->lru_head != NULL) shard->lru_head->lru_prev = entry;
+  else shard->lru_tail = entry;
+  shard->lru_head = entry;
+}
+
+/// @brief Removes the least recently used entry of the shard
+/// @note The lock of the shard has to be held
+static void PblMemoEvict(struct PblMemoShard *shard) {
+  struct PblMemoEntry *entry = shard->lru_tail;
+  PblMemoUnlinkLRU(shard, entry);
+  struct PblMemoEntry **link = &shard->buckets[entry->hash & shard->bucket_mask];
+  while (*link != entry) link = &(*link)->bucket_next;
+  *link = entry->bucket_next;
+  shard->size--;
+  shard->evictions++;
+  PblFree(entry);
+}
+
+// ---- End of Shards -------------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+void *PblMemoGet(PblMemoCache_T *cache, const PblMemoKeyArg_T *key, size_t len) {
+  struct PblMemoState *state = PblMemoGetState(cache);
+  uint64_t hash = PblMemoHashKey(key, len);
+  struct PblMemoShard *shard = PblMemoGetShard(state, hash);
+
+  pthread_mutex_lock(&shard->lock);
+  struct PblMemoEntry *entry = PblMemoFind(shard, hash, key, len);
+  void *result = NULL;
+  if (entry != NULL) {
+    if (shard->lru_head != entry) {
+      PblMemoUnlinkLRU(shard, entry);
+      PblMemoPushLRU(shard, entry);
+    }
+    result = entry->result;
+    shard->hits++;
+  } else {
+    shard->misses++;
+  }
+  pthread_mutex_unlock(&shard->lock);
+  return result;
+}
+
+void *PblMemoPut(PblMemoCache_T *cache, const PblMemoKeyArg_T *key, size_t len, void *result) {
+  if (result == NULL) return NULL;
+  struct PblMemoState *state = PblMemoGetState(cache);
+  uint64_t hash = PblMemoHashKey(key, len);
+  struct PblMemoShard *shard = PblMemoGetShard(state, hash);
+
+  // The entry is prepared before locking, as it is only dropped if another thread was faster
+  struct PblMemoEntry *created = PblMalloc(sizeof(struct PblMemoEntry) + len * sizeof(PblMemoKeyArg_T));
+  created->hash = hash;
+  created->result = result;
+  created->len = len;
+  memcpy(created->key, key, len * sizeof(PblMemoKeyArg_T));
+
+  // Copying the strings, as the caller may write to them later, which would change the content of the cached key
+  for (size_t i = 0; i < len; i++) {
+    PblMemoKeyArg_T *arg = &created->key[i];
+    if (arg->type == PBL_MEMO_KEY_ARG_STRING && !arg->str->actual.interned)
+      arg->str = PblGetStringTFromView(PblGetStringViewT(arg->str));
+  }
+
+  pthread_mutex_lock(&shard->lock);
+  struct PblMemoEntry *existing = PblMemoFind(shard, hash, key, len);
+  if (existing != NULL) {
+    result = existing->result;
+    pthread_mutex_unlock(&shard->lock);
+    PblFree(created);
+    return result;
+  }
+  if (shard->size >= state->shard_capacity) PblMemoEvict(shard);
+
+  struct PblMemoEntry **bucket = &shard->buckets[hash & shard->bucket_mask];
+  created->bucket_next = *bucket;
+  *bucket = created;
+  PblMemoPushLRU(shard, created);
+  shard->size++;
+  pthread_mutex_unlock(&shard->lock);
+  return result;
+}
+
+void PblMemoGetStats(PblMemoCache_T *cache, PblMemoStats_T *stats) {
+  // Validate the pointer for safety measures
+  stats = PblValPtr((void *) stats);
+  *stats = (PblMemoStats_T){0};
+
+  struct PblMemoState *state = __atomic_load_n((struct PblMemoState **) &cache->state, __ATOMIC_ACQUIRE);
+  if (state == NULL) return;
+  for (size_t i = 0; i <= state->shard_mask; i++) {
+    struct PblMemoShard *shard = &state->shards[i];
+    pthread_mutex_lock(&shard->lock);
+    stats->hits += shard->hits;
+    stats->misses += shard->misses;
+    stats->evictions += shard->evictions;
+    stats->size += shard->size;
+    pthread_mutex_unlock(&shard->lock);
+  }
+}
+
+void PblMemoClear(PblMemoCache_T *cache) {
+  struct PblMemoState *state = __atomic_load_n((struct PblMemoState **) &cache->state, __ATOMIC_ACQUIRE);
+  if (state == NULL) return;
+  for (size_t i = 0; i <= state->shard_mask; i++) {
+    struct PblMemoShard *shard = &state->shards[i];
+    pthread_mutex_lock(&shard->lock);
+    for (struct PblMemoEntry *entry = shard->lru_head; entry != NULL;) {
+      struct PblMemoEntry *next = entry->lru_next;
+      PblFree(entry);
+      entry = next;
+    }
+    memset(shard->buckets, 0, (shard->bucket_mask + 1) * sizeof(struct PblMemoEntry *));
+    shard->lru_head = shard->lru_tail = NULL;
+    shard->size = shard->hits = shard->misses = shard->evictions = 0;
+    pthread_mutex_unlock(&shard->lock);
+  }
+}
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
@@ -0,0 +1,583 @@
+/// @file pbl-profile.c
+/// @brief Function-level profiler and tracer, where every thread records its calls into its own call tree and event
+/// ring, which are only walked when the profile or trace is read or exported
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/func/pbl-profile.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// Threads, atomics and clocks for the per-thread call trees
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define PBL_PROFILE_USE_TSC
+#endif
+
+// ---- Clock ---------------------------------------------------------------------------------------------------------
+
+/// @brief Reads the monotonic raw clock in nanoseconds
+static uint64_t PblProfileNowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/// @brief Reads the clock used for timing calls, which is the time stamp counter on x86 and otherwise the monotonic
+/// raw clock. Ticks are only converted to nanoseconds when the profile is read
+static inline uint64_t PblProfileNowTicks(void) {
+#ifdef PBL_PROFILE_USE_TSC
+  return __rdtsc();
+#else
+  return PblProfileNowNs();
+#endif
+}
+
+/// @brief The ticks and nanoseconds at the time the library was loaded, which calibrate the conversion between both
+static uint64_t PBL_PROFILE_START_TICKS = 0;
+static uint64_t PBL_PROFILE_START_NS = 0;
+/// @brief The exact amount of nanoseconds per tick reported by the CPU, or 0 if it has to be measured
+static double PBL_PROFILE_NS_PER_TICK = 0.0;
+
+__attribute__((unused))
+__attribute__((constructor))
+__attribute__((deprecated("Compiler-Only Function - User Call Invalid!")))
+static void PBL_CONSTRUCTOR_PROFILE_CLOCK_INIT(void) {
+  PBL_PROFILE_START_NS = PblProfileNowNs();
+  PBL_PROFILE_START_TICKS = PblProfileNowTicks();
+
+#ifdef PBL_PROFILE_USE_TSC
+  // CPUID leaf 0x15 reports the frequency of the time stamp counter as the ratio to the crystal clock, which is only
+  // filled in by some CPUs
+  unsigned int denominator, numerator, crystal_hz, unused;
+  if (__get_cpuid_max(0, NULL) >= 0x15) {
+    __cpuid(0x15, denominator, numerator, crystal_hz, unused);
+    if (denominator != 0 && numerator != 0 && crystal_hz != 0)
+      PBL_PROFILE_NS_PER_TICK = 1e9 * denominator / ((double) crystal_hz * numerator);
+  }
+  (void) unused;
+#endif
+}
+
+/// @brief Gets the amount of nanoseconds per tick. If the CPU does not report the frequency of its time stamp counter,
+/// it is measured over the time since the library was loaded, which never blocks the calling thread
+static double PblProfileNsPerTick(void) {
+#ifdef PBL_PROFILE_USE_TSC
+  if (PBL_PROFILE_NS_PER_TICK != 0.0) return PBL_PROFILE_NS_PER_TICK;
+
+  // Reading the ticks between two reads of the clock, which limits the error if the thread is preempted in between
+  uint64_t before_ns = PblProfileNowNs();
+  uint64_t ticks = PblProfileNowTicks() - PBL_PROFILE_START_TICKS;
+  uint64_t elapsed_ns = (before_ns + PblProfileNowNs()) / 2 - PBL_PROFILE_START_NS;
+  return ticks == 0 ? 1.0 : (double) elapsed_ns / (double) ticks;
+#else
+  return 1.0;
+#endif
+}
+
+// ---- End of Clock --------------------------------------------------------------------------------------------------
+
+// ---- Call Trees ----------------------------------------------------------------------------------------------------
+
+/// @brief The amount of hash buckets for looking up the node of a call path
+#define PBL_PROFILE_BUCKETS (PBL_PROFILE_MAX_NODES * 2)
+
+/// @brief The node of the root, which is the parent of all calls made outside of Pbl functions
+#define PBL_PROFILE_ROOT_NODE 0
+
+/// @brief The node all calls are recorded as once 'PBL_PROFILE_MAX_NODES' was reached
+#define PBL_PROFILE_TRUNCATED_NODE 1
+
+/// @brief Node of a call tree, which aggregates all calls of a function on the same call path
+struct PblProfileNode {
+  /// @brief The descriptor of the function - NULL for the root and truncated node
+  const PblFunctionDescriptor_T *descriptor;
+  /// @brief The node of the caller
+  uint32_t parent;
+  /// @brief The next node in the same hash bucket plus one - 0 if there is none
+  uint32_t next_in_bucket;
+  uint64_t calls;
+  uint64_t exceptions;
+  uint64_t inclusive_ticks;
+  uint64_t exclusive_ticks;
+};
+
+/// @brief An active call of the thread
+struct PblProfileFrame {
+  uint32_t node;
+  uint64_t start_ticks;
+  /// @brief The inclusive ticks of all finished callees, which are subtracted for the exclusive time
+  uint64_t callee_ticks;
+};
+
+/// @brief Call tree of a thread, which is only written to by its thread
+struct PblProfileThread {
+  /// @brief The next thread in the list of all profiled threads
+  struct PblProfileThread *next;
+  /// @brief The next call tree in the list of call trees of exited threads
+  struct PblProfileThread *next_free;
+  /// @brief The amount of initialised nodes, which is published after a node was initialised
+  _Atomic(uint32_t) nodes_len;
+  /// @brief The node of the innermost active call
+  uint32_t current;
+  /// @brief The depth of nested calls, which may exceed 'PBL_PROFILE_MAX_DEPTH' when calls are not recorded
+  uint32_t depth;
+  /// @brief The first node of every hash bucket plus one - 0 if the bucket is empty
+  uint32_t buckets[PBL_PROFILE_BUCKETS];
+  struct PblProfileNode nodes[PBL_PROFILE_MAX_NODES];
+  struct PblProfileFrame frames[PBL_PROFILE_MAX_DEPTH];
+};
+
+/// @brief The list of all threads that were profiled, including threads that exited already
+static _Atomic(struct PblProfileThread *) PBL_PROFILE_THREADS = NULL;
+
+/// @brief The call tree of the current thread, which is NULL until the thread calls a function for the first time
+static _Thread_local struct PblProfileThread *PBL_PROFILE_THREAD = NULL;
+
+/// @brief The call trees of exited threads, which are continued by the next threads calling a function
+static struct PblProfileThread *PBL_PROFILE_FREE_THREADS = NULL;
+static pthread_mutex_t PBL_PROFILE_FREE_THREADS_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/// @brief The key, whose destructor releases the call tree of an exiting thread
+static pthread_key_t PBL_PROFILE_THREAD_KEY;
+static pthread_once_t PBL_PROFILE_THREAD_KEY_ONCE = PTHREAD_ONCE_INIT;
+
+/// @brief Releases the call tree of the exiting thread, so the next thread continues it instead of allocating a new one
+static void PblReleaseProfileThread(void *ptr) {
+  struct PblProfileThread *thread = ptr;
+
+  // Calls that did not finish are dropped, so the next thread starts at the root
+  thread->depth = 0;
+  thread->current = PBL_PROFILE_ROOT_NODE;
+  PBL_PROFILE_THREAD = NULL;
+
+  pthread_mutex_lock(&PBL_PROFILE_FREE_THREADS_LOCK);
+  thread->next_free = PBL_PROFILE_FREE_THREADS;
+  PBL_PROFILE_FREE_THREADS = thread;
+  pthread_mutex_unlock(&PBL_PROFILE_FREE_THREADS_LOCK);
+}
+
+static void PblCreateProfileThreadKey(void) { pthread_key_create(&PBL_PROFILE_THREAD_KEY, PblReleaseProfileThread); }
+
+/// @brief Gets the call tree for the current thread, which is either the tree of an exited thread or a new tree that is
+/// added to the list of profiled threads
+static struct PblProfileThread *PblCreateProfileThread(void) {
+  pthread_once(&PBL_PROFILE_THREAD_KEY_ONCE, PblCreateProfileThreadKey);
+
+  pthread_mutex_lock(&PBL_PROFILE_FREE_THREADS_LOCK);
+  struct PblProfileThread *thread = PBL_PROFILE_FREE_THREADS;
+  if (thread != NULL) PBL_PROFILE_FREE_THREADS = thread->next_free;
+  pthread_mutex_unlock(&PBL_PROFILE_FREE_THREADS_LOCK);
+
+  if (thread == NULL) {
+    // The call trees only reference static descriptors, so they are allocated outside the garbage collected heap. They
+    // are kept after their thread exited, so the profile of short-lived threads is exported as well
+    thread = calloc(1, sizeof(struct PblProfileThread));
+    if (thread == NULL) PblAbortWithCriticalError(1, "Para: Failed to allocate the call tree of a thread");
+    atomic_init(&thread->nodes_len, 2);
+    thread->current = PBL_PROFILE_ROOT_NODE;
+    thread->nodes[PBL_PROFILE_TRUNCATED_NODE].parent = PBL_PROFILE_ROOT_NODE;
+
+    struct PblProfileThread *head = atomic_load_explicit(&PBL_PROFILE_THREADS, memory_order_relaxed);
+    do {
+      thread->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&PBL_PROFILE_THREADS, &head, thread, memory_order_release,
+                                                    memory_order_relaxed));
+  }
+  pthread_setspecific(PBL_PROFILE_THREAD_KEY, thread);
+  PBL_PROFILE_THREAD = thread;
+  return thread;
+}
+
+/// @brief Gets the bucket of the call path, which is the passed function called from the passed parent node
+static inline uint32_t PblProfileBucket(uint32_t parent, uint64_t function_id) {
+  uint64_t hash = (function_id ^ ((uint64_t) parent * 0x9e3779b97f4a7c15ULL)) * 0xff51afd7ed558ccdULL;
+  return (uint32_t) (hash >> 32) % PBL_PROFILE_BUCKETS;
+}
+
+/// @brief Gets the node of the call path, and creates it if the function was not called on this path yet
+static inline uint32_t PblProfileGetNode(struct PblProfileThread *thread, uint32_t parent,
+                                         const PblFunctionDescriptor_T *descriptor) {
+  uint32_t bucket = PblProfileBucket(parent, descriptor->id);
+  for (uint32_t i = thread->buckets[bucket]; i != 0; i = thread->nodes[i - 1].next_in_bucket) {
+    struct PblProfileNode *node = &thread->nodes[i - 1];
+    if (node->parent == parent && (node->descriptor == descriptor || node->descriptor->id == descriptor->id))
+      return i - 1;
+  }
+
+  uint32_t len = atomic_load_explicit(&thread->nodes_len, memory_order_relaxed);
+  if (len >= PBL_PROFILE_MAX_NODES) return PBL_PROFILE_TRUNCATED_NODE;
+
+  struct PblProfileNode *node = &thread->nodes[len];
+  node->descriptor = descriptor;
+  node->parent = parent;
+  node->next_in_bucket = thread->buckets[bucket];
+  thread->buckets[bucket] = len + 1;
+  atomic_store_explicit(&thread->nodes_len, len + 1, memory_order_release);
+  return len;
+}
+
+// ---- End of Call Trees ---------------------------------------------------------------------------------------------
+
+// ---- Trace Rings ---------------------------------------------------------------------------------------------------
+
+/// @brief Event of a trace ring
+struct PblTraceEvent {
+  /// @brief The descriptor of the called function
+  const PblFunctionDescriptor_T *descriptor;
+  /// @brief The name of the raised exception for exception events, which is a static or interned string
+  const char *exception_name;
+  uint64_t ticks;
+  /// @brief The phase of the event in the trace-event format ('B', 'E' or 'i')
+  char phase;
+};
+
+/// @brief Ring of the recent events of a thread, which is only written to by its thread
+struct PblTraceThread {
+  /// @brief The next thread in the list of all traced threads
+  struct PblTraceThread *next;
+  /// @brief The number of the thread, which is used as its id inside the trace
+  uint32_t number;
+  /// @brief The next ring in the list of rings of exited threads
+  struct PblTraceThread *next_free;
+  /// @brief Whether the thread called a function using a threaded call ctx
+  bool is_threaded;
+  /// @brief The amount of calls, whose end event was not written yet
+  uint32_t depth;
+  /// @brief The amount of events written since the thread was created, where 'head % PBL_TRACE_RING_SIZE' is the
+  /// index of the next event
+  _Atomic(uint64_t) head;
+  struct PblTraceEvent events[PBL_TRACE_RING_SIZE];
+};
+
+/// @brief The list of all threads that were traced, including threads that exited already
+static _Atomic(struct PblTraceThread *) PBL_TRACE_THREADS = NULL;
+
+/// @brief The number of the last traced thread
+static _Atomic(uint32_t) PBL_TRACE_LAST_THREAD_NUMBER = 0;
+
+/// @brief The event ring of the current thread, which is NULL until the thread calls a function for the first time
+static _Thread_local struct PblTraceThread *PBL_TRACE_THREAD = NULL;
+
+/// @brief The rings of exited threads, which are continued by the next threads calling a function
+static struct PblTraceThread *PBL_TRACE_FREE_THREADS = NULL;
+static pthread_mutex_t PBL_TRACE_FREE_THREADS_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/// @brief The key, whose destructor releases the ring of an exiting thread
+static pthread_key_t PBL_TRACE_THREAD_KEY;
+static pthread_once_t PBL_TRACE_THREAD_KEY_ONCE = PTHREAD_ONCE_INIT;
+
+/// @brief Writes the event into the ring of the thread, which overwrites the oldest event if the ring is full
+static inline void PblTraceWrite(struct PblTraceThread *thread, const PblFunctionDescriptor_T *descriptor,
+                                 const char *exception_name, uint64_t ticks, char phase) {
+  uint64_t head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+  struct PblTraceEvent *event = &thread->events[head % PBL_TRACE_RING_SIZE];
+  event->descriptor = descriptor;
+  event->exception_name = exception_name;
+  event->ticks = ticks;
+  event->phase = phase;
+  atomic_store_explicit(&thread->head, head + 1, memory_order_release);
+}
+
+/// @brief Releases the ring of the exiting thread, so the next thread continues it instead of allocating a new one
+static void PblReleaseTraceThread(void *ptr) {
+  struct PblTraceThread *thread = ptr;
+
+  // Calls that did not finish are ended, so the calls of the next thread are not nested inside them
+  uint64_t ticks = PblProfileNowTicks();
+  for (; thread->depth > 0; thread->depth--) PblTraceWrite(thread, NULL, NULL, ticks, 'E');
+  PBL_TRACE_THREAD = NULL;
+
+  pthread_mutex_lock(&PBL_TRACE_FREE_THREADS_LOCK);
+  thread->next_free = PBL_TRACE_FREE_THREADS;
+  PBL_TRACE_FREE_THREADS = thread;
+  pthread_mutex_unlock(&PBL_TRACE_FREE_THREADS_LOCK);
+}
+
+static void PblCreateTraceThreadKey(void) { pthread_key_create(&PBL_TRACE_THREAD_KEY, PblReleaseTraceThread); }
+
+/// @brief Gets the event ring for the current thread, which is either the ring of an exited thread or a new ring that
+/// is added to the list of traced threads
+/// @note A continued ring keeps its thread number, so the events of both threads are shown on the same track
+static struct PblTraceThread *PblCreateTraceThread(void) {
+  pthread_once(&PBL_TRACE_THREAD_KEY_ONCE, PblCreateTraceThreadKey);
+
+  pthread_mutex_lock(&PBL_TRACE_FREE_THREADS_LOCK);
+  struct PblTraceThread *thread = PBL_TRACE_FREE_THREADS;
+  if (thread != NULL) PBL_TRACE_FREE_THREADS = thread->next_free;
+  pthread_mutex_unlock(&PBL_TRACE_FREE_THREADS_LOCK);
+
+  if (thread == NULL) {
+    // The rings only reference static descriptors and names, so they are allocated outside the garbage collected heap.
+    // They are kept after their thread exited, so the events of short-lived threads are exported as well
+    thread = calloc(1, sizeof(struct PblTraceThread));
+    if (thread == NULL) PblAbortWithCriticalError(1, "Para: Failed to allocate the event ring of a thread");
+    thread->number = atomic_fetch_add_explicit(&PBL_TRACE_LAST_THREAD_NUMBER, 1, memory_order_relaxed) + 1;
+    atomic_init(&thread->head, 0);
+
+    struct PblTraceThread *head = atomic_load_explicit(&PBL_TRACE_THREADS, memory_order_relaxed);
+    do {
+      thread->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&PBL_TRACE_THREADS, &head, thread, memory_order_release,
+                                                    memory_order_relaxed));
+  }
+  pthread_setspecific(PBL_TRACE_THREAD_KEY, thread);
+  PBL_TRACE_THREAD = thread;
+  return thread;
+}
+
+/// @brief Gets the name of the exception without creating its lazy properties. Only static and interned names are
+/// used, as other strings may be deallocated together with the exception before the trace is written
+static const char *PblTraceExceptionName(const PblException_T *exception) {
+  if (exception->actual.exc_class != NULL) return exception->actual.exc_class->name;
+  if (exception->actual.site != NULL && exception->actual.site->name != NULL) return exception->actual.site->name;
+  if (exception->actual.name != NULL && exception->actual.name->actual.interned)
+    return exception->actual.name->actual.c_str;
+  return "exception";
+}
+
+/// @brief Writes the string as JSON string including the quotes
+static void PblTraceWriteJsonString(FILE *file, const char *str) {
+  fputc('"', file);
+  for (; *str != '\0'; str++) {
+    unsigned char c = (unsigned char) *str;
+    if (c == '"' || c == '\\')
+      fprintf(file, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(file, "\\u%04x", c);
+    else
+      fputc(c, file);
+  }
+  fputc('"', file);
+}
+
+// ---- End of Trace Rings --------------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+void PblProfileEnter(const PblFunctionDescriptor_T *descriptor) {
+  struct PblProfileThread *thread = PBL_PROFILE_THREAD;
+  if (__builtin_expect(thread == NULL, 0)) thread = PblCreateProfileThread();
+
+  if (__builtin_expect(thread->depth >= PBL_PROFILE_MAX_DEPTH, 0)) {
+    thread->depth++;
+    return;
+  }
+
+  uint32_t node = PblProfileGetNode(thread, thread->current, descriptor);
+  struct PblProfileFrame *frame = &thread->frames[thread->depth++];
+  frame->node = node;
+  frame->callee_ticks = 0;
+  thread->current = node;
+
+  // Reading the clock last, so the lookup is not counted as part of the call
+  frame->start_ticks = PblProfileNowTicks();
+}
+
+void PblProfileExit(bool failed) {
+  uint64_t end_ticks = PblProfileNowTicks();
+  struct PblProfileThread *thread = PBL_PROFILE_THREAD;
+  if (__builtin_expect(thread == NULL || thread->depth == 0, 0)) return;
+
+  if (__builtin_expect(thread->depth > PBL_PROFILE_MAX_DEPTH, 0)) {
+    thread->depth--;
+    return;
+  }
+
+  struct PblProfileFrame *frame = &thread->frames[--thread->depth];
+  uint64_t elapsed = end_ticks - frame->start_ticks;
+  struct PblProfileNode *node = &thread->nodes[frame->node];
+  node->calls++;
+  node->exceptions += failed;
+  node->inclusive_ticks += elapsed;
+  node->exclusive_ticks += elapsed - (frame->callee_ticks < elapsed ? frame->callee_ticks : elapsed);
+
+  if (thread->depth > 0) {
+    thread->frames[thread->depth - 1].callee_ticks += elapsed;
+    thread->current = thread->frames[thread->depth - 1].node;
+  } else {
+    thread->current = PBL_PROFILE_ROOT_NODE;
+  }
+}
+
+/// @brief Returns whether a caller of the node is a call of the same function, so its inclusive time is already
+/// counted by the outer call
+static bool PblProfileIsRecursive(struct PblProfileThread *thread, uint32_t node_index) {
+  uint64_t function_id = thread->nodes[node_index].descriptor->id;
+  for (uint32_t i = thread->nodes[node_index].parent; i > PBL_PROFILE_TRUNCATED_NODE; i = thread->nodes[i].parent) {
+    if (thread->nodes[i].descriptor->id == function_id) return true;
+  }
+  return false;
+}
+
+bool PblProfileGetStats(uint64_t function_id, PblProfileStats_T *stats) {
+  // Validate the pointer for safety measures
+  stats = PblValPtr((void *) stats);
+
+  uint64_t inclusive_ticks = 0;
+  uint64_t exclusive_ticks = 0;
+  bool found = false;
+  *stats = (PblProfileStats_T){.calls = 0, .exceptions = 0, .inclusive_ns = 0, .exclusive_ns = 0};
+
+  struct PblProfileThread *thread = atomic_load_explicit(&PBL_PROFILE_THREADS, memory_order_acquire);
+  for (; thread != NULL; thread = thread->next) {
+    uint32_t len = atomic_load_explicit(&thread->nodes_len, memory_order_acquire);
+    for (uint32_t i = PBL_PROFILE_TRUNCATED_NODE + 1; i < len; i++) {
+      struct PblProfileNode *node = &thread->nodes[i];
+      if (node->descriptor->id != function_id) continue;
+
+      found = true;
+      stats->calls += node->calls;
+      stats->exceptions += node->exceptions;
+      exclusive_ticks += node->exclusive_ticks;
+      if (!PblProfileIsRecursive(thread, i)) inclusive_ticks += node->inclusive_ticks;
+    }
+  }
+
+  if (found) {
+    double ns_per_tick = PblProfileNsPerTick();
+    stats->inclusive_ns = (uint64_t) ((double) inclusive_ticks * ns_per_tick);
+    stats->exclusive_ns = (uint64_t) ((double) exclusive_ticks * ns_per_tick);
+  }
+  return found;
+}
+
+bool PblProfileDumpCollapsed(const char *path) {
+  // Validate the pointer for safety measures
+  path = PblValPtr((void *) path);
+
+  FILE *file = fopen(path, "w");
+  if (file == NULL) return false;
+
+  double ns_per_tick = PblProfileNsPerTick();
+  struct PblProfileThread *thread = atomic_load_explicit(&PBL_PROFILE_THREADS, memory_order_acquire);
+  for (; thread != NULL; thread = thread->next) {
+    uint32_t len = atomic_load_explicit(&thread->nodes_len, memory_order_acquire);
+    for (uint32_t i = PBL_PROFILE_TRUNCATED_NODE; i < len; i++) {
+      uint64_t exclusive_ns = (uint64_t) ((double) thread->nodes[i].exclusive_ticks * ns_per_tick);
+      if (exclusive_ns == 0) continue;
+
+      // Collecting the call path from the callee up to the root, which is at most as deep as the recorded calls
+      uint32_t path_nodes[PBL_PROFILE_MAX_DEPTH + 1];
+      size_t path_len = 0;
+      for (uint32_t n = i; n != PBL_PROFILE_ROOT_NODE && path_len <= PBL_PROFILE_MAX_DEPTH; n = thread->nodes[n].parent)
+        path_nodes[path_len++] = n;
+
+      for (size_t p = path_len; p > 0; p--) {
+        const PblFunctionDescriptor_T *descriptor = thread->nodes[path_nodes[p - 1]].descriptor;
+        fprintf(file, "%s%s", descriptor != NULL ? descriptor->name : "[truncated]", p > 1 ? ";" : "");
+      }
+      fprintf(file, " %llu\n", (unsigned long long) exclusive_ns);
+    }
+  }
+
+  bool failed = ferror(file) != 0;
+  return fclose(file) == 0 && !failed;
+}
+
+void PblTraceEnter(const PblFunctionDescriptor_T *descriptor, bool is_threaded) {
+  struct PblTraceThread *thread = PBL_TRACE_THREAD;
+  if (__builtin_expect(thread == NULL, 0)) thread = PblCreateTraceThread();
+  if (is_threaded) thread->is_threaded = true;
+  thread->depth++;
+  PblTraceWrite(thread, descriptor, NULL, PblProfileNowTicks(), 'B');
+}
+
+void PblTraceExit(const PblException_T *exception) {
+  uint64_t ticks = PblProfileNowTicks();
+  struct PblTraceThread *thread = PBL_TRACE_THREAD;
+  if (__builtin_expect(thread == NULL || thread->depth == 0, 0)) return;
+
+  thread->depth--;
+  if (exception != NULL) PblTraceWrite(thread, NULL, PblTraceExceptionName(exception), ticks, 'i');
+  PblTraceWrite(thread, NULL, NULL, ticks, 'E');
+}
+
+bool PblTraceDump(const char *path) {
+  // Validate the pointer for safety measures
+  path = PblValPtr((void *) path);
+
+  FILE *file = fopen(path, "w");
+  if (file == NULL) return false;
+
+  // The copy of the ring of the thread that is currently written
+  struct PblTraceEvent *events = malloc(PBL_TRACE_RING_SIZE * sizeof(struct PblTraceEvent));
+  if (events == NULL) {
+    fclose(file);
+    return false;
+  }
+
+  double ns_per_tick = PblProfileNsPerTick();
+  long pid = (long) getpid();
+  bool first = true;
+  fputs("{\"traceEvents\":[", file);
+
+  struct PblTraceThread *thread = atomic_load_explicit(&PBL_TRACE_THREADS, memory_order_acquire);
+  for (; thread != NULL; thread = thread->next) {
+    fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%ld,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+            first ? "" : ",", pid, thread->number, thread->is_threaded ? "Pbl threaded ctx" : "Pbl thread",
+            thread->number);
+    first = false;
+
+    // Running threads keep writing events while the ring is copied, so only the copied events that could not have
+    // been overwritten meanwhile are used. The event at the head may be written right now, which is why the event one
+    // ring size before the head is dropped as well
+    uint64_t head = atomic_load_explicit(&thread->head, memory_order_acquire);
+    memcpy(events, thread->events, sizeof(thread->events));
+    atomic_thread_fence(memory_order_acquire);
+    uint64_t current_head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+    uint64_t start = head > PBL_TRACE_RING_SIZE ? head - PBL_TRACE_RING_SIZE : 0;
+    if (current_head + 1 > start + PBL_TRACE_RING_SIZE) start = current_head + 1 - PBL_TRACE_RING_SIZE;
+
+    // The names of the end events are taken from their begin events, where end events whose begin event was already
+    // overwritten are skipped
+    const PblFunctionDescriptor_T *open_calls[PBL_PROFILE_MAX_DEPTH];
+    size_t depth = 0;
+    size_t skipped_depth = 0;
+    for (uint64_t i = start; i < head; i++) {
+      struct PblTraceEvent *event = &events[i % PBL_TRACE_RING_SIZE];
+      const char *name;
+      if (event->phase == 'B') {
+        if (depth < PBL_PROFILE_MAX_DEPTH)
+          open_calls[depth++] = event->descriptor;
+        else
+          skipped_depth++;
+        name = event->descriptor->name;
+      } else if (event->phase == 'E') {
+        if (skipped_depth > 0) {
+          skipped_depth--;
+          continue;
+        }
+        if (depth == 0) continue;
+        name = open_calls[--depth]->name;
+      } else {
+        name = event->exception_name;
+      }
+
+      double ts_us = (double) (event->ticks - PBL_PROFILE_START_TICKS) * ns_per_tick / 1000.0;
+      fputs(",\n{\"name\":", file);
+      PblTraceWriteJsonString(file, name);
+      fprintf(file, ",\"cat\":\"%s\",\"ph\":\"%c\",%s\"ts\":%.3f,\"pid\":%ld,\"tid\":%u}",
+              event->phase == 'i' ? "exception" : "call", event->phase, event->phase == 'i' ? "\"s\":\"t\"," : "",
+              ts_us, pid, thread->number);
+    }
+  }
+  fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+  free(events);
+
+  bool failed = ferror(file) != 0;
+  return fclose(file) == 0 && !failed;
+}
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
@@ -0,0 +1,598 @@
+/// @file pbl-async-io.c
+/// @brief Asynchronous file I/O on streams, which keeps many reads and writes in flight using io_uring if the kernel
+/// supports it, and otherwise using a pool of worker threads
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/io/pbl-async-io.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// Threads and positional I/O for the thread pool backend
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// io_uring is used directly using its system calls, as liburing is not a dependency of the library. The header is
+// only new enough if it defines the features of Linux 5.6, which added the plain read and write operations
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#ifdef IORING_FEAT_RW_CUR_POS
+#define PBL_HAS_IO_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+/// @brief The max. queue depth of an engine, which keeps the io_uring rings small
+#define PBL_ASYNC_IO_MAX_QUEUE_DEPTH 4096
+
+/// @brief The max. amount of bytes transferred by a single operation, which is the limit of Linux for a single read or
+/// write call
+#define PBL_ASYNC_IO_MAX_TRANSFER 0x7ffff000
+
+/// @brief The amount of completions that are moved out of the completion queue of the thread pool at once
+#define PBL_ASYNC_IO_REAP_BATCH 64
+
+// ---- Engine Type ---------------------------------------------------------------------------------------------------
+
+#ifdef PBL_HAS_IO_URING
+/// @brief The memory-mapped submission and completion queues of an io_uring instance
+struct PblAsyncIOUring {
+  /// @brief The file descriptor of the io_uring instance
+  int fd;
+  /// @brief The indices and the index array of the submission queue, which are shared with the kernel
+  unsigned *sq_head;
+  unsigned *sq_tail;
+  unsigned sq_mask;
+  unsigned *sq_array;
+  /// @brief The submission queue entries
+  struct io_uring_sqe *sqes;
+  /// @brief The indices and the entries of the completion queue, which are shared with the kernel
+  unsigned *cq_head;
+  unsigned *cq_tail;
+  unsigned cq_mask;
+  struct io_uring_cqe *cqes;
+  /// @brief The mappings, which are unmapped when the engine is destroyed
+  void *sq_ring;
+  size_t sq_ring_size;
+  void *cq_ring;
+  size_t cq_ring_size;
+  size_t sqes_size;
+};
+#endif
+
+/// @brief The pool of worker threads, which performs the operations using blocking system calls
+struct PblAsyncIOWorkers {
+  /// @brief Protects the job and completion queues
+  pthread_mutex_t lock;
+  /// @brief Signalled once jobs were submitted or the workers should stop
+  pthread_cond_t work;
+  /// @brief Signalled once a job completed
+  pthread_cond_t done;
+  /// @brief The amount of slots of both queues, which is the queue depth of the engine, as it limits the amount of jobs
+  /// in flight
+  size_t capacity;
+  /// @brief The submitted jobs, which were not picked up yet
+  PblAsyncIOHandle_T **jobs;
+  size_t jobs_start;
+  size_t jobs_len;
+  /// @brief The completed jobs, which were not reaped yet
+  PblAsyncIOHandle_T **completed;
+  size_t completed_start;
+  size_t completed_len;
+  /// @brief Whether the workers should exit
+  bool stopping;
+  /// @brief The worker threads
+  pthread_t *threads;
+  size_t threads_len;
+};
+
+struct PblAsyncIOEngine {
+  /// @brief The backend that performs the operations
+  enum PblAsyncIOBackend backend;
+  /// @brief The max. amount of operations in flight
+  size_t queue_depth;
+  /// @brief The operations that were not submitted yet, linked using 'next'
+  PblAsyncIOHandle_T *queued_first;
+  PblAsyncIOHandle_T *queued_last;
+  size_t queued_len;
+  /// @brief The operations in flight, which keeps them reachable for the garbage collector, as the kernel and the
+  /// worker threads are not scanned
+  PblAsyncIOHandle_T *in_flight;
+  size_t in_flight_len;
+#ifdef PBL_HAS_IO_URING
+  struct PblAsyncIOUring ring;
+#endif
+  struct PblAsyncIOWorkers workers;
+};
+
+// ---- End of Engine Type --------------------------------------------------------------------------------------------
+
+// ---- Helper Functions ----------------------------------------------------------------------------------------------
+
+/// @brief Performs the operation of the handle using a blocking system call, and stores the result in the handle
+static void PblPerformAsyncIOBlocking(PblAsyncIOHandle_T *handle) {
+  size_t len = handle->len < PBL_ASYNC_IO_MAX_TRANSFER ? handle->len : PBL_ASYNC_IO_MAX_TRANSFER;
+  ssize_t result;
+  do {
+    result = handle->op == PBL_ASYNC_IO_READ ? pread(handle->fd, handle->buffer, len, (off_t) handle->offset)
+                                             : pwrite(handle->fd, handle->buffer, len, (off_t) handle->offset);
+  } while (result < 0 && errno == EINTR);
+  handle->result = result < 0 ? -errno : result;
+}
+
+/// @brief Adds the handle to the list of operations in flight
+static void PblLinkInFlightAsyncIO(PblAsyncIOEngine_T *engine, PblAsyncIOHandle_T *handle) {
+  handle->prev = NULL;
+  handle->next = engine->in_flight;
+  if (engine->in_flight != NULL) engine->in_flight->prev = handle;
+  engine->in_flight = handle;
+  engine->in_flight_len++;
+  __atomic_store_n(&handle->state, PBL_ASYNC_IO_IN_FLIGHT, __ATOMIC_RELAXED);
+}
+
+/// @brief Removes the completed handle from the list of operations in flight, and runs its callback
+static void PblCompleteAsyncIO(PblAsyncIOEngine_T *engine, PblAsyncIOHandle_T *handle) {
+  if (handle->prev != NULL) handle->prev->next = handle->next;
+  else engine->in_flight = handle->next;
+  if (handle->next != NULL) handle->next->prev = handle->prev;
+  handle->prev = NULL;
+  handle->next = NULL;
+  engine->in_flight_len--;
+
+  __atomic_store_n(&handle->state, PBL_ASYNC_IO_COMPLETED, __ATOMIC_RELEASE);
+  if (handle->callback != NULL) handle->callback(handle, handle->user_data);
+}
+
+/// @brief Removes the first queued operation
+static PblAsyncIOHandle_T *PblPopQueuedAsyncIO(PblAsyncIOEngine_T *engine) {
+  PblAsyncIOHandle_T *handle = engine->queued_first;
+  engine->queued_first = handle->next;
+  if (engine->queued_first == NULL) engine->queued_last = NULL;
+  engine->queued_len--;
+  return handle;
+}
+
+/// @brief Gets the file descriptor of the stream, after flushing pending writes, so async writes do not overtake them
+static int PblGetAsyncStreamFd(PblIOStream_T *stream, bool flush) {
+  if (flush) PblStreamFlush(stream);
+  if (stream->actual.buffer != NULL || stream->actual.file == NULL) return (int) stream->actual.fd->actual;
+  return fileno(stream->actual.file->actual);
+}
+
+// ---- End of Helper Functions ---------------------------------------------------------------------------------------
+
+// ---- io_uring Backend ----------------------------------------------------------------------------------------------
+
+#ifdef PBL_HAS_IO_URING
+static inline int PblIOUringSetup(unsigned entries, struct io_uring_params *params) {
+  return (int) syscall(__NR_io_uring_setup, entries, params);
+}
+
+static inline int PblIOUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return (int) syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static inline int PblIOUringRegister(int fd, unsigned opcode, void *arg, unsigned nr_args) {
+  return (int) syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/// @brief Checks whether the kernel supports the plain read and write operations, which is not the case before
+/// Linux 5.6 (where probing also fails)
+static bool PblIOUringSupportsReadWrite(int fd) {
+  char storage[sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op)] = {0};
+  struct io_uring_probe *probe = (struct io_uring_probe *) storage;
+  if (PblIOUringRegister(fd, IORING_REGISTER_PROBE, probe, 256) < 0) return false;
+  if (probe->last_op < IORING_OP_WRITE) return false;
+  return (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+         (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED);
+}
+
+/// @brief Releases the mappings and the file descriptor of the io_uring instance
+static void PblCloseIOUring(struct PblAsyncIOUring *ring) {
+  if (ring->sqes != NULL && ring->sqes != MAP_FAILED) munmap(ring->sqes, ring->sqes_size);
+  if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) {
+    munmap(ring->cq_ring, ring->cq_ring_size);
+  }
+  if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) munmap(ring->sq_ring, ring->sq_ring_size);
+  if (ring->fd != -1) close(ring->fd);
+  ring->fd = -1;
+}
+
+/// @brief Creates the io_uring instance and maps its queues
+/// @return True if io_uring is available, false if the kernel does not support it or it is blocked (e.g. by seccomp)
+static bool PblOpenIOUring(struct PblAsyncIOUring *ring, size_t queue_depth) {
+  struct io_uring_params params = {0};
+  ring->fd = PblIOUringSetup((unsigned) queue_depth, &params);
+  if (ring->fd < 0) {
+    ring->fd = -1;
+    return false;
+  }
+  if (!PblIOUringSupportsReadWrite(ring->fd)) {
+    PblCloseIOUring(ring);
+    return false;
+  }
+
+  ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap && ring->cq_ring_size > ring->sq_ring_size) ring->sq_ring_size = ring->cq_ring_size;
+
+  ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                       IORING_OFF_SQ_RING);
+  ring->cq_ring = single_mmap ? ring->sq_ring
+                              : mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                     ring->fd, IORING_OFF_CQ_RING);
+  ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+                    IORING_OFF_SQES);
+  if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+    PblCloseIOUring(ring);
+    return false;
+  }
+
+  char *sq = ring->sq_ring;
+  ring->sq_head = (unsigned *) (sq + params.sq_off.head);
+  ring->sq_tail = (unsigned *) (sq + params.sq_off.tail);
+  ring->sq_mask = *(unsigned *) (sq + params.sq_off.ring_mask);
+  ring->sq_array = (unsigned *) (sq + params.sq_off.array);
+  char *cq = ring->cq_ring;
+  ring->cq_head = (unsigned *) (cq + params.cq_off.head);
+  ring->cq_tail = (unsigned *) (cq + params.cq_off.tail);
+  ring->cq_mask = *(unsigned *) (cq + params.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+  return true;
+}
+
+/// @brief Writes the operations into the submission queue, and submits all entries the kernel did not consume yet
+/// using a single system call
+static size_t PblSubmitIOUring(PblAsyncIOEngine_T *engine, unsigned min_complete) {
+  struct PblAsyncIOUring *ring = &engine->ring;
+  size_t submitted = 0;
+  unsigned tail = *ring->sq_tail;
+  while (engine->queued_len > 0 && engine->in_flight_len < engine->queue_depth) {
+    PblAsyncIOHandle_T *handle = PblPopQueuedAsyncIO(engine);
+    unsigned index = tail & ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = handle->op == PBL_ASYNC_IO_READ ? IORING_OP_READ : IORING_OP_WRITE;
+    sqe->fd = handle->fd;
+    sqe->addr = (uint64_t) (uintptr_t) handle->buffer;
+    sqe->len = (uint32_t) (handle->len < PBL_ASYNC_IO_MAX_TRANSFER ? handle->len : PBL_ASYNC_IO_MAX_TRANSFER);
+    sqe->off = (uint64_t) handle->offset;
+    sqe->user_data = (uint64_t) (uintptr_t) handle;
+    ring->sq_array[index] = index;
+    tail++;
+    PblLinkInFlightAsyncIO(engine, handle);
+    submitted++;
+  }
+  __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+  // Entries that were not consumed by a previous failed call are submitted again
+  unsigned to_submit = tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+  if (to_submit == 0 && min_complete == 0) return submitted;
+  unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+  while (PblIOUringEnter(ring->fd, to_submit, min_complete, flags) < 0 && errno == EINTR) {
+    to_submit = tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+  }
+  return submitted;
+}
+
+/// @brief Reaps all entries of the completion queue
+static size_t PblReapIOUring(PblAsyncIOEngine_T *engine) {
+  struct PblAsyncIOUring *ring = &engine->ring;
+  size_t reaped = 0;
+  unsigned head = *ring->cq_head;
+  while (head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+    struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+    PblAsyncIOHandle_T *handle = (PblAsyncIOHandle_T *) (uintptr_t) cqe->user_data;
+    handle->result = cqe->res;
+    head++;
+    // Releasing the entry before the callback runs, as the callback may submit new operations
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    PblCompleteAsyncIO(engine, handle);
+    reaped++;
+  }
+  return reaped;
+}
+#endif
+
+// ---- End of io_uring Backend ---------------------------------------------------------------------------------------
+
+// ---- Thread Pool Backend -------------------------------------------------------------------------------------------
+
+/// @brief Runs the jobs of the pool
+/// @note This never allocates using the garbage collector, as the thread is not registered with it
+static void *PblRunAsyncIOWorker(void *arg) {
+  struct PblAsyncIOWorkers *workers = arg;
+  size_t capacity = workers->capacity;
+
+  pthread_mutex_lock(&workers->lock);
+  while (true) {
+    while (workers->jobs_len == 0 && !workers->stopping) pthread_cond_wait(&workers->work, &workers->lock);
+    if (workers->jobs_len == 0) break;
+
+    PblAsyncIOHandle_T *handle = workers->jobs[workers->jobs_start];
+    workers->jobs_start = (workers->jobs_start + 1) % capacity;
+    workers->jobs_len--;
+    pthread_mutex_unlock(&workers->lock);
+
+    PblPerformAsyncIOBlocking(handle);
+
+    pthread_mutex_lock(&workers->lock);
+    workers->completed[(workers->completed_start + workers->completed_len) % capacity] = handle;
+    workers->completed_len++;
+    pthread_cond_signal(&workers->done);
+  }
+  pthread_mutex_unlock(&workers->lock);
+  return NULL;
+}
+
+/// @brief Stops and joins the worker threads
+static void PblStopAsyncIOWorkers(struct PblAsyncIOWorkers *workers) {
+  pthread_mutex_lock(&workers->lock);
+  workers->stopping = true;
+  pthread_cond_broadcast(&workers->work);
+  pthread_mutex_unlock(&workers->lock);
+  for (size_t i = 0; i < workers->threads_len; i++) pthread_join(workers->threads[i], NULL);
+  workers->threads_len = 0;
+}
+
+/// @brief Starts the worker threads
+/// @return True if at least one thread was started
+static bool PblStartAsyncIOWorkers(PblAsyncIOEngine_T *engine, size_t threads) {
+  struct PblAsyncIOWorkers *workers = &engine->workers;
+  pthread_mutex_init(&workers->lock, NULL);
+  pthread_cond_init(&workers->work, NULL);
+  pthread_cond_init(&workers->done, NULL);
+  workers->capacity = engine->queue_depth;
+  // Both queues are scanned by the garbage collector, as they are the only references the workers hold
+  workers->jobs = PblMallocUncollectable(engine->queue_depth * sizeof(PblAsyncIOHandle_T *));
+  workers->completed = PblMallocUncollectable(engine->queue_depth * sizeof(PblAsyncIOHandle_T *));
+  workers->threads = PblMallocUncollectable(threads * sizeof(pthread_t));
+  for (size_t i = 0; i < threads; i++) {
+    if (pthread_create(&workers->threads[i], NULL, PblRunAsyncIOWorker, workers) != 0) break;
+    workers->threads_len++;
+  }
+  return workers->threads_len > 0;
+}
+
+/// @brief Passes the queued operations to the workers
+static size_t PblSubmitAsyncIOWorkers(PblAsyncIOEngine_T *engine) {
+  struct PblAsyncIOWorkers *workers = &engine->workers;
+  size_t submitted = 0;
+  pthread_mutex_lock(&workers->lock);
+  while (engine->queued_len > 0 && engine->in_flight_len < engine->queue_depth) {
+    PblAsyncIOHandle_T *handle = PblPopQueuedAsyncIO(engine);
+    PblLinkInFlightAsyncIO(engine, handle);
+    workers->jobs[(workers->jobs_start + workers->jobs_len) % engine->queue_depth] = handle;
+    workers->jobs_len++;
+    submitted++;
+  }
+  if (submitted > 0) pthread_cond_broadcast(&workers->work);
+  pthread_mutex_unlock(&workers->lock);
+  return submitted;
+}
+
+/// @brief Reaps the completed jobs, and waits for at least one if 'block' is set and an operation is in flight
+static size_t PblReapAsyncIOWorkers(PblAsyncIOEngine_T *engine, bool block) {
+  struct PblAsyncIOWorkers *workers = &engine->workers;
+  PblAsyncIOHandle_T *batch[PBL_ASYNC_IO_REAP_BATCH];
+  size_t reaped = 0;
+  while (true) {
+    pthread_mutex_lock(&workers->lock);
+    if (block && reaped == 0) {
+      while (workers->completed_len == 0) pthread_cond_wait(&workers->done, &workers->lock);
+    }
+    size_t amount = workers->completed_len;
+    if (amount > PBL_ASYNC_IO_REAP_BATCH) amount = PBL_ASYNC_IO_REAP_BATCH;
+    for (size_t i = 0; i < amount; i++) {
+      batch[i] = workers->completed[workers->completed_start];
+      workers->completed_start = (workers->completed_start + 1) % engine->queue_depth;
+    }
+    workers->completed_len -= amount;
+    pthread_mutex_unlock(&workers->lock);
+
+    // The callbacks run without holding the lock, as they may submit new operations
+    for (size_t i = 0; i < amount; i++) PblCompleteAsyncIO(engine, batch[i]);
+    reaped += amount;
+    if (amount < PBL_ASYNC_IO_REAP_BATCH) return reaped;
+  }
+}
+
+// ---- End of Thread Pool Backend ------------------------------------------------------------------------------------
+
+// ---- Functions Implementation --------------------------------------------------------------------------------------
+
+PblAsyncIOEngine_T *PblAsyncIOCreateEngine_Base(size_t queue_depth, size_t threads, enum PblAsyncIOBackend backend) {
+  if (queue_depth == 0) queue_depth = 1;
+  if (queue_depth > PBL_ASYNC_IO_MAX_QUEUE_DEPTH) queue_depth = PBL_ASYNC_IO_MAX_QUEUE_DEPTH;
+  if (threads == 0) threads = 1;
+
+  // The engine is referenced by the kernel and the worker threads, so it is freed manually
+  PblAsyncIOEngine_T *engine = PblMallocUncollectable(sizeof(PblAsyncIOEngine_T));
+  memset(engine, 0, sizeof(PblAsyncIOEngine_T));
+  engine->queue_depth = queue_depth;
+
+#ifdef PBL_HAS_IO_URING
+  engine->ring.fd = -1;
+  if (backend != PBL_ASYNC_IO_BACKEND_THREAD_POOL && PblOpenIOUring(&engine->ring, queue_depth)) {
+    engine->backend = PBL_ASYNC_IO_BACKEND_IO_URING;
+    return engine;
+  }
+#endif
+  if (backend == PBL_ASYNC_IO_BACKEND_IO_URING) {
+    PblFree(engine);
+    return NULL;
+  }
+
+  engine->backend = PBL_ASYNC_IO_BACKEND_THREAD_POOL;
+  if (!PblStartAsyncIOWorkers(engine, threads)) {
+    PblFree(engine->workers.jobs);
+    PblFree(engine->workers.completed);
+    PblFree(engine->workers.threads);
+    PblFree(engine);
+    return NULL;
+  }
+  return engine;
+}
+
+__attribute__((unused)) PblAsyncIOEngine_T *PblAsyncIOCreateEngine_Overhead(struct PblAsyncIOCreateEngine_Args in) {
+  size_t queue_depth = in.queue_depth != 0 ? in.queue_depth : PBL_ASYNC_IO_DEFAULT_QUEUE_DEPTH;
+  size_t threads = in.threads != 0 ? in.threads : PBL_ASYNC_IO_DEFAULT_THREADS;
+  return PblAsyncIOCreateEngine_Base(queue_depth, threads, in.backend);
+}
+
+void PblAsyncIODestroyEngine(PblAsyncIOEngine_T *engine) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+
+  PblAsyncIOWait(engine, SIZE_MAX);
+#ifdef PBL_HAS_IO_URING
+  if (engine->backend == PBL_ASYNC_IO_BACKEND_IO_URING) PblCloseIOUring(&engine->ring);
+#endif
+  if (engine->backend == PBL_ASYNC_IO_BACKEND_THREAD_POOL) {
+    PblStopAsyncIOWorkers(&engine->workers);
+    pthread_mutex_destroy(&engine->workers.lock);
+    pthread_cond_destroy(&engine->workers.work);
+    pthread_cond_destroy(&engine->workers.done);
+    PblFree(engine->workers.jobs);
+    PblFree(engine->workers.completed);
+    PblFree(engine->workers.threads);
+  }
+  PblFree(engine);
+}
+
+enum PblAsyncIOBackend PblAsyncIOGetBackend(PblAsyncIOEngine_T *engine) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+  return engine->backend;
+}
+
+const char *PblGetAsyncIOBackendName(enum PblAsyncIOBackend backend) {
+  switch (backend) {
+    case PBL_ASYNC_IO_BACKEND_IO_URING:
+      return "io_uring";
+    case PBL_ASYNC_IO_BACKEND_THREAD_POOL:
+      return "thread pool";
+    default:
+      return "auto";
+  }
+}
+
+/// @brief Creates the handle of an operation and queues it
+static PblAsyncIOHandle_T *PblQueueAsyncIO(PblAsyncIOEngine_T *engine, enum PblAsyncIOOp op, int fd, void *buffer,
+                                           size_t len, int64_t offset, PblAsyncIOCallback_T callback,
+                                           void *user_data) {
+  PblAsyncIOHandle_T *handle = PblMalloc(sizeof(PblAsyncIOHandle_T));
+  *handle = (PblAsyncIOHandle_T){.op = op,
+                                 .state = PBL_ASYNC_IO_QUEUED,
+                                 .fd = fd,
+                                 .buffer = buffer,
+                                 .len = len,
+                                 .offset = offset,
+                                 .result = 0,
+                                 .callback = callback,
+                                 .user_data = user_data,
+                                 .engine = engine,
+                                 .prev = NULL,
+                                 .next = NULL};
+
+  if (engine->queued_last != NULL) engine->queued_last->next = handle;
+  else engine->queued_first = handle;
+  engine->queued_last = handle;
+  engine->queued_len++;
+  return handle;
+}
+
+__attribute__((unused)) PblAsyncIOHandle_T *PblAsyncRead_Overhead(struct PblAsyncRead_Args in) {
+  // Validate the pointer for safety measures
+  PblAsyncIOEngine_T *engine = PBL_VAL_REQ_ARG(in.engine);
+  PblIOStream_T *stream = PBL_VAL_REQ_ARG(in.stream);
+  void *buffer = PBL_VAL_REQ_ARG(in.buffer);
+  return PblQueueAsyncIO(engine, PBL_ASYNC_IO_READ, PblGetAsyncStreamFd(stream, false), buffer, in.len, in.offset,
+                         in.callback, in.user_data);
+}
+
+__attribute__((unused)) PblAsyncIOHandle_T *PblAsyncWrite_Overhead(struct PblAsyncWrite_Args in) {
+  // Validate the pointer for safety measures
+  PblAsyncIOEngine_T *engine = PBL_VAL_REQ_ARG(in.engine);
+  PblIOStream_T *stream = PBL_VAL_REQ_ARG(in.stream);
+  void *buffer = PBL_VAL_REQ_ARG(in.buffer);
+  return PblQueueAsyncIO(engine, PBL_ASYNC_IO_WRITE, PblGetAsyncStreamFd(stream, true), buffer, in.len, in.offset,
+                         in.callback, in.user_data);
+}
+
+size_t PblAsyncIOSubmit(PblAsyncIOEngine_T *engine) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+
+#ifdef PBL_HAS_IO_URING
+  if (engine->backend == PBL_ASYNC_IO_BACKEND_IO_URING) return PblSubmitIOUring(engine, 0);
+#endif
+  return PblSubmitAsyncIOWorkers(engine);
+}
+
+/// @brief Reaps the completed operations, and waits for at least one if 'block' is set
+static size_t PblReapAsyncIO(PblAsyncIOEngine_T *engine, bool block) {
+#ifdef PBL_HAS_IO_URING
+  if (engine->backend == PBL_ASYNC_IO_BACKEND_IO_URING) {
+    size_t reaped = PblReapIOUring(engine);
+    if (reaped > 0 || !block) return reaped;
+    PblSubmitIOUring(engine, 1);
+    return PblReapIOUring(engine);
+  }
+#endif
+  return PblReapAsyncIOWorkers(engine, block);
+}
+
+size_t PblAsyncIOPoll(PblAsyncIOEngine_T *engine) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+
+  PblAsyncIOSubmit(engine);
+  size_t reaped = PblReapAsyncIO(engine, false);
+  // Completions free slots in the queue, which are filled right away
+  if (reaped > 0 && engine->queued_len > 0) PblAsyncIOSubmit(engine);
+  return reaped;
+}
+
+size_t PblAsyncIOWait(PblAsyncIOEngine_T *engine, size_t min_completions) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+
+  size_t reaped = 0;
+  while (reaped < min_completions) {
+    PblAsyncIOSubmit(engine);
+    if (engine->in_flight_len == 0) break;
+    reaped += PblReapAsyncIO(engine, true);
+  }
+  if (engine->queued_len > 0) PblAsyncIOSubmit(engine);
+  return reaped;
+}
+
+int64_t PblAsyncIOWaitHandle(PblAsyncIOHandle_T *handle) {
+  // Validate the pointer for safety measures
+  handle = PblValPtr((void *) handle);
+
+  while (!PblAsyncIOIsComplete(handle)) PblAsyncIOWait(handle->engine, 1);
+  return handle->result;
+}
+
+bool PblAsyncIOIsComplete(PblAsyncIOHandle_T *handle) {
+  // Validate the pointer for safety measures
+  handle = PblValPtr((void *) handle);
+  return __atomic_load_n(&handle->state, __ATOMIC_ACQUIRE) == PBL_ASYNC_IO_COMPLETED;
+}
+
+size_t PblAsyncIOPending(PblAsyncIOEngine_T *engine) {
+  // Validate the pointer for safety measures
+  engine = PblValPtr((void *) engine);
+  return engine->queued_len + engine->in_flight_len;
+}
+
+// ---- End of Functions Implementation -------------------------------------------------------------------------------
@@ -4,6 +4,11 @@
 /// @date 2021-11-23
 /// @copyright Copyright (c) 2021
 
+// Enabling the GNU extensions copy_file_range and splice, which have to be requested before any system header
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 // Parent Header for this file
 #include <libpbl/io/pbl-io.h>
 
@@ -11,6 +16,1105 @@
 #include <libpbl/mem/pbl-mem.h>
 #include <libpbl/types/pbl-string.h>
 
+// Atomics for the lazy initialisation of the standard streams
+#include <stdatomic.h>
+
+// POSIX file descriptor I/O for the buffered streams
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// Zero-copy transfers between file descriptors
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+// Vectored writes and number formatting for 'PblPrintMany' and 'PblPrintf'
+#include <math.h>
+#include <stdlib.h>
+#include <sys/uio.h>
+#if defined(__has_include)
+#if __has_include(<stdio_ext.h>)
+#include <stdio_ext.h>
+#define PBL_HAS_STDIO_EXT
+#endif
+#endif
+
+// ---- Buffered Streams ----------------------------------------------------------------------------------------------
+
+/// @brief Pbl-managed buffer of a stream, which is used either for reading or for writing at a time
+struct PblStreamBuffer {
+  /// @brief The file descriptor that is read from and written to
+  int fd;
+  /// @brief The buffered bytes
+  char *data;
+  /// @brief The size of 'data' in bytes
+  size_t capacity;
+  /// @brief Reading: the index of the next unread byte. Writing: unused (always 0)
+  size_t pos;
+  /// @brief Reading: the end of the buffered bytes. Writing: the amount of pending bytes
+  size_t len;
+  /// @brief Whether 'data' contains pending bytes that still have to be written
+  bool writing;
+  /// @brief The flush policy for writes
+  enum PblStreamFlushPolicy flush;
+  /// @brief Whether locking is skipped, since the stream is only used by a single thread
+  bool single_threaded;
+  /// @brief The lock for streams that are shared between threads
+  pthread_mutex_t lock;
+};
+
+/// @brief Locks the buffer, unless it is single-threaded
+static inline void PblLockStreamBuffer(struct PblStreamBuffer *buffer) {
+  if (!buffer->single_threaded) pthread_mutex_lock(&buffer->lock);
+}
+
+/// @brief Unlocks the buffer, unless it is single-threaded
+static inline void PblUnlockStreamBuffer(struct PblStreamBuffer *buffer) {
+  if (!buffer->single_threaded) pthread_mutex_unlock(&buffer->lock);
+}
+
+/// @brief Returns whether the stream was closed, meaning its lock and file descriptor must not be used anymore
+/// @note Streams without an 'open' property are treated as open
+static inline bool PblIsStreamClosed(PblIOStream_T *stream) {
+  return stream->actual.open != NULL && !stream->actual.open->actual;
+}
+
+/// @brief Writes all passed bytes to the file descriptor, while retrying on partial writes and interrupts
+/// @return The amount of bytes written, which is only less than 'len' if an error occurred
+static size_t PblWriteAllToFd(int fd, const char *src, size_t len) {
+  size_t written = 0;
+  while (written < len) {
+    ssize_t result = write(fd, src + written, len - written);
+    if (result < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    written += (size_t) result;
+  }
+  return written;
+}
+
+/// @brief Writes the pending bytes of the buffer to the file descriptor
+/// @note Requires the buffer to be locked
+static bool PblFlushStreamBuffer(struct PblStreamBuffer *buffer) {
+  if (!buffer->writing || buffer->len == 0) return true;
+
+  size_t written = PblWriteAllToFd(buffer->fd, buffer->data, buffer->len);
+  if (written < buffer->len) {
+    // Keeping the bytes that could not be written, so a later flush may retry them
+    memmove(buffer->data, buffer->data + written, buffer->len - written);
+    buffer->len -= written;
+    return false;
+  }
+  buffer->len = 0;
+  return true;
+}
+
+/// @brief Prepares the buffer for reading by flushing pending writes
+/// @note Requires the buffer to be locked
+static bool PblSwitchStreamBufferToRead(struct PblStreamBuffer *buffer) {
+  if (!buffer->writing) return true;
+  if (!PblFlushStreamBuffer(buffer)) return false;
+  buffer->writing = false;
+  buffer->pos = buffer->len = 0;
+  return true;
+}
+
+/// @brief Prepares the buffer for writing by dropping read-ahead bytes, and moving the file offset back to the first
+/// unread byte (which fails silently for pipes and terminals, where the read-ahead is lost either way)
+/// @note Requires the buffer to be locked
+static void PblSwitchStreamBufferToWrite(struct PblStreamBuffer *buffer) {
+  if (buffer->writing) return;
+  if (buffer->pos < buffer->len) lseek(buffer->fd, -(off_t) (buffer->len - buffer->pos), SEEK_CUR);
+  buffer->writing = true;
+  buffer->pos = buffer->len = 0;
+}
+
+/// @brief Converts a fopen-like mode into the flags for open()
+/// @return The flags, or -1 if the mode is invalid
+static int PblGetOpenFlagsFromMode(const char *mode) {
+  int flags;
+  switch (mode[0]) {
+    case 'r':
+      flags = 0;
+      break;
+    case 'w':
+      flags = O_CREAT | O_TRUNC;
+      break;
+    case 'a':
+      flags = O_CREAT | O_APPEND;
+      break;
+    default:
+      return -1;
+  }
+
+  // Ignoring 'b', as there is no difference between binary and text mode on POSIX systems
+  bool update = strchr(mode, '+') != NULL;
+  if (update) {
+    flags |= O_RDWR;
+  } else {
+    flags |= mode[0] == 'r' ? O_RDONLY : O_WRONLY;
+  }
+  return flags | O_CLOEXEC;
+}
+
+PblIOStream_T *PblGetBufferedIOStreamT(int fd, size_t buffer_size, enum PblStreamFlushPolicy flush,
+                                       bool single_threaded) {
+  struct PblStreamBuffer *buffer = PblMalloc(sizeof(struct PblStreamBuffer));
+  buffer->fd = fd;
+  buffer->capacity = buffer_size != 0 ? buffer_size : PBL_STREAM_DEFAULT_BUFFER_SIZE;
+  // The buffer only contains bytes, so the garbage collector does not have to scan it
+  buffer->data = PblMallocAtomic(buffer->capacity);
+  buffer->pos = 0;
+  buffer->len = 0;
+  buffer->writing = false;
+  buffer->flush = flush;
+  buffer->single_threaded = single_threaded;
+  pthread_mutex_init(&buffer->lock, NULL);
+
+  PblIOStream_T *conv = PblMalloc(sizeof(PblIOStream_T));
+  *conv = PblStream_T_DefDefault;
+  conv->actual.fd = PblGetUIntT((unsigned int) fd);
+  conv->actual.open = PblGetBoolT(true);
+  conv->actual.buffer = buffer;
+  return conv;
+}
+
+PblIOStream_T *PblStreamOpen_Base(PblString_T *path, PblString_T *mode, size_t buffer_size,
+                                  enum PblStreamFlushPolicy flush, bool single_threaded) {
+  int flags = PblGetOpenFlagsFromMode(PblGetStringBytes(mode));
+  if (flags == -1) {
+    errno = EINVAL;
+    return NULL;
+  }
+
+  int fd;
+  do {
+    fd = open(PblGetStringBytes(path), flags, 0666);
+  } while (fd == -1 && errno == EINTR);
+  if (fd == -1) return NULL;
+
+  PblIOStream_T *stream = PblGetBufferedIOStreamT(fd, buffer_size, flush, single_threaded);
+  stream->actual.mode = PblInternString(mode);
+  return stream;
+}
+
+__attribute__((unused)) PblIOStream_T *PblStreamOpen_Overhead(struct PblStreamOpen_Args in) {
+  // Validate the pointer for safety measures
+  PblString_T *path = PBL_VAL_REQ_ARG(in.path);
+  PblString_T *mode = in.mode != NULL ? in.mode : PblInternCString("r");
+  return PblStreamOpen_Base(path, mode, in.buffer_size, in.flush, in.single_threaded);
+}
+
+size_t PblStreamRead(PblIOStream_T *stream, void *dst, size_t len) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  if (len == 0 || PblIsStreamClosed(stream)) return 0;
+  dst = PblValPtr(dst);
+
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer == NULL) return fread(dst, sizeof(char), len, stream->actual.file->actual);
+
+  PblLockStreamBuffer(buffer);
+  if (!PblSwitchStreamBufferToRead(buffer)) {
+    PblUnlockStreamBuffer(buffer);
+    return 0;
+  }
+
+  char *out = dst;
+  size_t done = 0;
+  while (done < len) {
+    // Serving the request from the already buffered bytes
+    if (buffer->pos < buffer->len) {
+      size_t available = buffer->len - buffer->pos;
+      size_t amount = available < len - done ? available : len - done;
+      memcpy(out + done, buffer->data + buffer->pos, amount);
+      buffer->pos += amount;
+      done += amount;
+      continue;
+    }
+
+    // Large reads bypass the buffer to avoid copying the data twice
+    bool direct = len - done >= buffer->capacity;
+    ssize_t result =
+      direct ? read(buffer->fd, out + done, len - done) : read(buffer->fd, buffer->data, buffer->capacity);
+    if (result < 0 && errno == EINTR) continue;
+    if (result <= 0) break;
+
+    if (direct) {
+      done += (size_t) result;
+    } else {
+      buffer->pos = 0;
+      buffer->len = (size_t) result;
+    }
+  }
+
+  PblUnlockStreamBuffer(buffer);
+  return done;
+}
+
+/// @brief Writes the passed bytes into the buffer, or directly to the file descriptor if the stream is unbuffered or
+/// the write is larger than the buffer
+/// @note Requires the buffer to be locked
+static size_t PblWriteToStreamBuffer(struct PblStreamBuffer *buffer, const char *src, size_t len) {
+  PblSwitchStreamBufferToWrite(buffer);
+
+  if (buffer->flush == PBL_STREAM_FLUSH_NONE || len >= buffer->capacity) {
+    // The pending bytes have to be written first to keep the order
+    return PblFlushStreamBuffer(buffer) ? PblWriteAllToFd(buffer->fd, src, len) : 0;
+  }
+
+  if (buffer->len + len > buffer->capacity && !PblFlushStreamBuffer(buffer)) return 0;
+  memcpy(buffer->data + buffer->len, src, len);
+  buffer->len += len;
+
+  if (buffer->flush == PBL_STREAM_FLUSH_LINE && memchr(src, '\n', len) != NULL) PblFlushStreamBuffer(buffer);
+  return len;
+}
+
+size_t PblStreamWrite(PblIOStream_T *stream, const void *src, size_t len) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  if (len == 0 || PblIsStreamClosed(stream)) return 0;
+  src = PblValPtr((void *) src);
+
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer == NULL) return fwrite(src, sizeof(char), len, stream->actual.file->actual);
+
+  PblLockStreamBuffer(buffer);
+  size_t written = PblWriteToStreamBuffer(buffer, src, len);
+  PblUnlockStreamBuffer(buffer);
+  return written;
+}
+
+bool PblStreamFlush(PblIOStream_T *stream) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  if (PblIsStreamClosed(stream)) return false;
+
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer == NULL) return fflush(stream->actual.file->actual) == 0;
+
+  PblLockStreamBuffer(buffer);
+  bool success = PblFlushStreamBuffer(buffer);
+  PblUnlockStreamBuffer(buffer);
+  return success;
+}
+
+bool PblStreamClose(PblIOStream_T *stream) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+
+  if (PblIsStreamClosed(stream)) return true;
+
+  bool success;
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer == NULL) {
+    success = fclose(stream->actual.file->actual) == 0;
+    stream->actual.file->actual = NULL;
+  } else {
+    PblLockStreamBuffer(buffer);
+    success = PblFlushStreamBuffer(buffer);
+    success = close(buffer->fd) == 0 && success;
+    // The descriptor number may be re-used by the kernel for another file, so it must not be kept
+    buffer->fd = -1;
+    buffer->pos = buffer->len = 0;
+    PblUnlockStreamBuffer(buffer);
+    // The garbage collector does not run destructors, so the lock has to be released together with the descriptor
+    if (!buffer->single_threaded) pthread_mutex_destroy(&buffer->lock);
+  }
+  stream->actual.open = PblGetBoolT(false);
+  return success;
+}
+
+// ---- End of Buffered Streams ---------------------------------------------------------------------------------------
+
+// ---- Line Reading --------------------------------------------------------------------------------------------------
+
+/// @brief Reads the next line from a stdio stream using getline
+static PblString_T *PblReadLineFromFile(FILE *file) {
+  char *line = NULL;
+  size_t line_capacity = 0;
+  ssize_t len = getline(&line, &line_capacity, file);
+  if (len < 0) {
+    free(line);
+    return NULL;
+  }
+
+  if (len > 0 && line[len - 1] == '\n') len--;
+  PblString_T *str = PblGetStringTFromView(PblGetStringViewOfBytes(line, (size_t) len));
+  // getline allocates using the C library, which is not managed by the garbage collector
+  free(line);
+  return str;
+}
+
+PblString_T *PblReadLine(PblIOStream_T *stream) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  if (PblIsStreamClosed(stream)) return NULL;
+
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer == NULL) return PblReadLineFromFile(stream->actual.file->actual);
+
+  PblLockStreamBuffer(buffer);
+  if (!PblSwitchStreamBufferToRead(buffer)) {
+    PblUnlockStreamBuffer(buffer);
+    return NULL;
+  }
+
+  // Bytes of a line that spans multiple refills of the buffer
+  char *pending = NULL;
+  size_t pending_len = 0;
+  size_t pending_capacity = 0;
+  PblString_T *str = NULL;
+  while (true) {
+    size_t available = buffer->len - buffer->pos;
+    const char *start = buffer->data + buffer->pos;
+    const char *newline = available > 0 ? memchr(start, '\n', available) : NULL;
+    size_t line_len = newline != NULL ? (size_t) (newline - start) : available;
+
+    if (newline != NULL && pending_len == 0) {
+      // Fast path: the entire line is contained in the buffer
+      str = PblGetStringTFromView(PblGetStringViewOfBytes(start, line_len));
+      buffer->pos += line_len + 1;
+      break;
+    }
+
+    if (line_len > 0) {
+      if (pending_len + line_len > pending_capacity) {
+        pending_capacity = (pending_len + line_len) * 2;
+        pending = pending == NULL ? PblMallocAtomic(pending_capacity) : PblRealloc(pending, pending_capacity);
+      }
+      memcpy(pending + pending_len, start, line_len);
+      pending_len += line_len;
+    }
+
+    if (newline != NULL) {
+      buffer->pos += line_len + 1;
+      str = PblGetStringTFromView(PblGetStringViewOfBytes(pending, pending_len));
+      break;
+    }
+
+    // The buffer is exhausted and has to be refilled
+    buffer->pos = buffer->len = 0;
+    ssize_t result = read(buffer->fd, buffer->data, buffer->capacity);
+    if (result < 0 && errno == EINTR) continue;
+    if (result <= 0) {
+      // The last line does not have to end with a newline
+      if (pending_len > 0) str = PblGetStringTFromView(PblGetStringViewOfBytes(pending, pending_len));
+      break;
+    }
+    buffer->len = (size_t) result;
+  }
+
+  PblUnlockStreamBuffer(buffer);
+  if (pending != NULL) PblFree(pending);
+  return str;
+}
+
+PblLineIterator_T PblGetLineIterator(PblIOStream_T *stream, size_t block_size) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+
+  return (PblLineIterator_T){.stream = stream,
+                             .data = NULL,
+                             .capacity = block_size != 0 ? block_size : PBL_LINE_ITERATOR_DEFAULT_BLOCK_SIZE,
+                             .pos = 0,
+                             .scanned = 0,
+                             .len = 0,
+                             .eof = false};
+}
+
+bool PblLineIteratorNext(PblLineIterator_T *iter, PblStringView_T *line) {
+  // Validate the pointer for safety measures
+  iter = PblValPtr((void *) iter);
+  line = PblValPtr((void *) line);
+
+  // The block only contains bytes, so the garbage collector does not have to scan it
+  if (iter->data == NULL) iter->data = PblMallocAtomic(iter->capacity);
+
+  while (true) {
+    // Only searching the bytes that were not searched yet, so long lines spanning multiple reads stay linear
+    const char *newline = iter->scanned < iter->len
+                            ? memchr(iter->data + iter->scanned, '\n', iter->len - iter->scanned)
+                            : NULL;
+    if (newline != NULL) {
+      size_t end = (size_t) (newline - iter->data);
+      *line = PblGetStringViewOfBytes(iter->data + iter->pos, end - iter->pos);
+      iter->pos = iter->scanned = end + 1;
+      return true;
+    }
+    iter->scanned = iter->len;
+
+    if (iter->eof) {
+      if (iter->pos >= iter->len) return false;
+      // The last line does not have to end with a newline
+      *line = PblGetStringViewOfBytes(iter->data + iter->pos, iter->len - iter->pos);
+      iter->pos = iter->len;
+      return true;
+    }
+
+    // Moving the incomplete line to the start of the block, and growing it if the line fills the entire block
+    size_t rest = iter->len - iter->pos;
+    if (iter->pos > 0) memmove(iter->data, iter->data + iter->pos, rest);
+    iter->pos = 0;
+    iter->scanned = iter->len = rest;
+    if (rest == iter->capacity) {
+      iter->capacity *= 2;
+      iter->data = PblRealloc(iter->data, iter->capacity);
+    }
+
+    size_t amount = PblStreamRead(iter->stream, iter->data + iter->len, iter->capacity - iter->len);
+    if (amount == 0) iter->eof = true;
+    iter->len += amount;
+  }
+}
+
+// ---- End of Line Reading -------------------------------------------------------------------------------------------
+
+// ---- Stream Transfer -----------------------------------------------------------------------------------------------
+
+/// @brief The max. amount of bytes passed to a single zero-copy system call, which is the most Linux transfers at once
+#define PBL_STREAM_COPY_MAX_CHUNK ((size_t) 0x7ffff000)
+
+/// @brief Locks the buffers of both streams in a fixed order, so two copies in opposite directions can not deadlock
+static void PblLockStreamBufferPair(struct PblStreamBuffer *first, struct PblStreamBuffer *second) {
+  if (first != NULL && second != NULL && (uintptr_t) second < (uintptr_t) first) {
+    struct PblStreamBuffer *tmp = first;
+    first = second;
+    second = tmp;
+  }
+  if (first != NULL) PblLockStreamBuffer(first);
+  if (second != NULL) PblLockStreamBuffer(second);
+}
+
+/// @brief Unlocks the buffers of both streams
+static void PblUnlockStreamBufferPair(struct PblStreamBuffer *first, struct PblStreamBuffer *second) {
+  if (first != NULL) PblUnlockStreamBuffer(first);
+  if (second != NULL) PblUnlockStreamBuffer(second);
+}
+
+/// @brief Gets the file descriptor of a stdio source stream, after discarding its read-ahead using fflush (which
+/// moves the file offset back to the stream position)
+/// @return The file descriptor, or -1 if the stream has none or the read-ahead can not be discarded, since the file
+/// is not seekable (e.g. a pipe)
+static int PblGetStdioSourceFd(FILE *file) {
+  int fd = fileno(file);
+  if (fd == -1 || lseek(fd, 0, SEEK_CUR) == -1) return -1;
+  return fflush(file) == 0 ? fd : -1;
+}
+
+/// @brief Writes the bytes to the destination of a copy, which was already flushed
+static size_t PblWriteCopiedBytes(PblIOStream_T *dst, int out_fd, const char *src, size_t len) {
+  if (out_fd != -1) return PblWriteAllToFd(out_fd, src, len);
+  return fwrite(src, sizeof(char), len, dst->actual.file->actual);
+}
+
+/// @brief Returns whether the errno value of a zero-copy system call means that it does not support the passed file
+/// descriptors, meaning the next path should be tried
+static inline bool PblIsUnsupportedTransferError(int error) {
+  return error == EINVAL || error == EXDEV || error == ENOSYS || error == EOPNOTSUPP || error == EBADF;
+}
+
+/// @brief Tries to copy the bytes using copy_file_range, sendfile and splice in this order
+/// @return True if one of the paths was taken (even if it failed midway or the end of the source was reached), false
+/// if none of them supports the passed file descriptors
+static bool PblCopyWithSyscalls(int in_fd, int out_fd, size_t len, PblStreamCopyResult_T *result) {
+#ifdef __linux__
+  static const enum PblStreamCopyPath paths[] = {PBL_STREAM_COPY_FILE_RANGE, PBL_STREAM_COPY_SENDFILE,
+                                                 PBL_STREAM_COPY_SPLICE};
+  for (size_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+    size_t moved = 0;
+    bool unsupported = false;
+    while (moved < len) {
+      size_t chunk = len - moved < PBL_STREAM_COPY_MAX_CHUNK ? len - moved : PBL_STREAM_COPY_MAX_CHUNK;
+      ssize_t amount;
+      switch (paths[i]) {
+        case PBL_STREAM_COPY_FILE_RANGE:
+          amount = copy_file_range(in_fd, NULL, out_fd, NULL, chunk, 0);
+          break;
+        case PBL_STREAM_COPY_SENDFILE:
+          amount = sendfile(out_fd, in_fd, NULL, chunk);
+          break;
+        default:
+          amount = splice(in_fd, NULL, out_fd, NULL, chunk, SPLICE_F_MOVE);
+          break;
+      }
+
+      if (amount < 0) {
+        if (errno == EINTR) continue;
+        if (moved == 0 && PblIsUnsupportedTransferError(errno)) {
+          unsupported = true;
+          break;
+        }
+        result->error = errno;
+        break;
+      }
+      // copy_file_range reports 0 instead of an error for pseudo files (e.g. in /proc), so sendfile has to verify
+      // whether the end was actually reached
+      if (amount == 0 && moved == 0 && paths[i] == PBL_STREAM_COPY_FILE_RANGE) unsupported = true;
+      if (amount == 0) break;
+      moved += (size_t) amount;
+    }
+
+    if (unsupported) continue;
+    if (moved > 0) result->path = paths[i];
+    result->bytes += moved;
+    return true;
+  }
+#endif
+  return false;
+}
+
+/// @brief Copies the bytes by reading them into a user-space buffer, which is sized to the copy if it is smaller than
+/// 'PBL_STREAM_COPY_BUFFER_SIZE'
+static void PblCopyWithBuffer(PblIOStream_T *src, PblIOStream_T *dst, int in_fd, int out_fd, size_t len,
+                              PblStreamCopyResult_T *result) {
+  size_t block_size = len < PBL_STREAM_COPY_BUFFER_SIZE ? len : PBL_STREAM_COPY_BUFFER_SIZE;
+  char *block = PblMallocAtomic(block_size);
+  size_t moved = 0;
+  while (moved < len) {
+    size_t chunk = len - moved < block_size ? len - moved : block_size;
+    size_t amount;
+    if (src->actual.buffer != NULL) {
+      ssize_t read_result = read(in_fd, block, chunk);
+      if (read_result < 0 && errno == EINTR) continue;
+      if (read_result < 0) result->error = errno;
+      amount = read_result > 0 ? (size_t) read_result : 0;
+    } else {
+      amount = fread(block, sizeof(char), chunk, src->actual.file->actual);
+      if (amount < chunk && ferror(src->actual.file->actual)) result->error = errno;
+    }
+    if (amount == 0) break;
+
+    size_t written = PblWriteCopiedBytes(dst, out_fd, block, amount);
+    moved += written;
+    if (written < amount) {
+      result->error = errno;
+      break;
+    }
+  }
+
+  PblFree(block);
+  if (moved > 0) result->path = PBL_STREAM_COPY_BUFFERED;
+  result->bytes += moved;
+}
+
+/// @brief Copies the bytes between the streams
+/// @note Requires the buffers of both streams to be locked
+static void PblCopyBetweenLockedStreams(PblIOStream_T *src, PblIOStream_T *dst, size_t len,
+                                        PblStreamCopyResult_T *result) {
+  struct PblStreamBuffer *src_buffer = src->actual.buffer;
+  struct PblStreamBuffer *dst_buffer = dst->actual.buffer;
+
+  // Flushing the pending writes of the destination, so the copied bytes can be written directly to its descriptor
+  int out_fd;
+  if (dst_buffer != NULL) {
+    PblSwitchStreamBufferToWrite(dst_buffer);
+    if (!PblFlushStreamBuffer(dst_buffer)) {
+      result->error = errno;
+      return;
+    }
+    out_fd = dst_buffer->fd;
+  } else {
+    if (fflush(dst->actual.file->actual) != 0) {
+      result->error = errno;
+      return;
+    }
+    out_fd = fileno(dst->actual.file->actual);
+  }
+
+  int in_fd;
+  if (src_buffer != NULL) {
+    if (!PblSwitchStreamBufferToRead(src_buffer)) {
+      result->error = errno;
+      return;
+    }
+
+    // Writing the bytes that were already read ahead first
+    size_t available = src_buffer->len - src_buffer->pos;
+    size_t amount = available < len ? available : len;
+    if (amount > 0) {
+      size_t written = PblWriteCopiedBytes(dst, out_fd, src_buffer->data + src_buffer->pos, amount);
+      src_buffer->pos += written;
+      result->bytes += written;
+      if (written < amount) {
+        result->error = errno;
+        return;
+      }
+    }
+    in_fd = src_buffer->fd;
+  } else {
+    in_fd = PblGetStdioSourceFd(src->actual.file->actual);
+  }
+
+  size_t remaining = len - result->bytes;
+  if (remaining == 0) return;
+  if (in_fd != -1 && out_fd != -1 && PblCopyWithSyscalls(in_fd, out_fd, remaining, result)) return;
+  PblCopyWithBuffer(src, dst, in_fd, out_fd, remaining, result);
+}
+
+PblStreamCopyResult_T PblStreamCopy(PblIOStream_T *src, PblIOStream_T *dst, size_t len) {
+  // Validate the pointer for safety measures
+  src = PblValPtr((void *) src);
+  dst = PblValPtr((void *) dst);
+
+  PblStreamCopyResult_T result = {.bytes = 0, .path = PBL_STREAM_COPY_NONE, .error = 0};
+  if (len == 0) return result;
+
+  struct PblStreamBuffer *src_buffer = src->actual.buffer;
+  struct PblStreamBuffer *dst_buffer = dst->actual.buffer;
+  if (src_buffer != NULL && src_buffer == dst_buffer) {
+    result.error = EINVAL;
+    return result;
+  }
+  if (PblIsStreamClosed(src) || PblIsStreamClosed(dst)) {
+    result.error = EBADF;
+    return result;
+  }
+
+  PblLockStreamBufferPair(src_buffer, dst_buffer);
+  PblCopyBetweenLockedStreams(src, dst, len, &result);
+  PblUnlockStreamBufferPair(src_buffer, dst_buffer);
+
+  // Bytes that were only written from the read-ahead of the source were still passed through user-space
+  if (result.path == PBL_STREAM_COPY_NONE && result.bytes > 0) result.path = PBL_STREAM_COPY_BUFFERED;
+  return result;
+}
+
+const char *PblGetStreamCopyPathName(enum PblStreamCopyPath path) {
+  switch (path) {
+    case PBL_STREAM_COPY_FILE_RANGE:
+      return "copy_file_range";
+    case PBL_STREAM_COPY_SENDFILE:
+      return "sendfile";
+    case PBL_STREAM_COPY_SPLICE:
+      return "splice";
+    case PBL_STREAM_COPY_BUFFERED:
+      return "buffered";
+    default:
+      return "none";
+  }
+}
+
+// ---- End of Stream Transfer ----------------------------------------------------------------------------------------
+
+// ---- Vectored Printing ---------------------------------------------------------------------------------------------
+
+/// @brief Creates a print arg, which prints the passed number
+#define PBL_PRINT_ARG_OF_NUMBER(arg_type, field, val)                                                                  \
+  (PblPrintArg_T) { .type = (arg_type), .ptr = NULL, .len = 0, .num.field = (val) }
+
+PblPrintArg_T PblGetPrintArgOfString(PblString_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return (PblPrintArg_T){.type = PBL_PRINT_ARG_BYTES, .ptr = PblGetStringBytes(val), .len = val->actual.len->actual};
+}
+
+PblPrintArg_T PblGetPrintArgOfView(PblStringView_T val) {
+  return (PblPrintArg_T){.type = PBL_PRINT_ARG_BYTES, .ptr = val.actual.ptr, .len = val.actual.len};
+}
+
+PblPrintArg_T PblGetPrintArgOfCString(const char *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return (PblPrintArg_T){.type = PBL_PRINT_ARG_BYTES, .ptr = val, .len = strlen(val)};
+}
+
+PblPrintArg_T PblGetPrintArgOfCharT(PblChar_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return (PblPrintArg_T){.type = PBL_PRINT_ARG_BYTES, .ptr = (const char *) &val->actual, .len = 1};
+}
+
+PblPrintArg_T PblGetPrintArgOfBoolT(PblBool_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PblGetPrintArgOfBool(val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfShortT(PblShort_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_SIGNED, i, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfUShortT(PblUShort_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfIntT(PblInt_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_SIGNED, i, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfUIntT(PblUInt_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfLongT(PblLong_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_SIGNED, i, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfULongT(PblULong_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfLongLongT(PblLongLong_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_SIGNED, i, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfULongLongT(PblULongLong_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfSizeT(PblSize_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfFloatT(PblFloat_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_FLOAT, d, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfDoubleT(PblDouble_T *val) {
+  // Validate the pointer for safety measures
+  val = PblValPtr((void *) val);
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_DOUBLE, d, val->actual);
+}
+
+PblPrintArg_T PblGetPrintArgOfChar(char val) { return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_CHAR, c, val); }
+
+PblPrintArg_T PblGetPrintArgOfBool(bool val) {
+  return (PblPrintArg_T){.type = PBL_PRINT_ARG_BYTES, .ptr = val ? "true" : "false", .len = val ? 4 : 5};
+}
+
+PblPrintArg_T PblGetPrintArgOfSigned(long long val) { return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_SIGNED, i, val); }
+
+PblPrintArg_T PblGetPrintArgOfUnsigned(unsigned long long val) {
+  return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_UNSIGNED, u, val);
+}
+
+PblPrintArg_T PblGetPrintArgOfFloat(float val) { return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_FLOAT, d, val); }
+
+PblPrintArg_T PblGetPrintArgOfDouble(double val) { return PBL_PRINT_ARG_OF_NUMBER(PBL_PRINT_ARG_DOUBLE, d, val); }
+
+/// @brief Formats the unsigned integer in decimal into 'dst'
+/// @return The length of the formatted number
+static size_t PblFormatUnsigned(char *dst, unsigned long long val) {
+  char digits[20];
+  size_t len = 0;
+  do {
+    digits[sizeof(digits) - ++len] = (char) ('0' + val % 10);
+    val /= 10;
+  } while (val != 0);
+  memcpy(dst, digits + sizeof(digits) - len, len);
+  return len;
+}
+
+/// @brief Powers of ten that are exactly representable as doubles, used by 'PblFormatShortDecimal'
+static const double PBL_PRINT_POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6};
+
+/// @brief Formats the floating point number into 'dst' without snprintf, if it has at most 6 fractional digits and
+/// is in the range where '%g' uses the fixed notation (at least 1e-4, and below 1e6 for floats or 1e15 for doubles)
+/// @return The length of the formatted number, or 0 if the number has to be formatted using snprintf
+static size_t PblFormatShortDecimal(char *dst, double val, bool single) {
+  double abs = val < 0 ? -val : val;
+  if (!(abs < (single ? 1e6 : 1e15)) || (abs < 1e-4 && abs != 0)) return 0;
+
+  for (size_t k = 0; k < sizeof(PBL_PRINT_POW10) / sizeof(double); k++) {
+    double scaled = abs * PBL_PRINT_POW10[k];
+    // The digits have to be an exact integer for the division below to be the correctly rounded decimal
+    if (scaled >= 9007199254740992.0) return 0;
+    // Rounding half to even like printf, so both paths format the same value identically
+    unsigned long long digits = (unsigned long long) scaled;
+    double fraction = scaled - (double) digits;
+    if (fraction > 0.5 || (fraction == 0.5 && (digits & 1) != 0)) digits++;
+    double read_back = (double) digits / PBL_PRINT_POW10[k];
+    if (single ? (float) read_back != (float) abs : read_back != abs) continue;
+
+    size_t len = 0;
+    if (signbit(val)) dst[len++] = '-';
+    char buffer[24];
+    size_t digits_len = PblFormatUnsigned(buffer, digits);
+    if (digits_len <= k) {
+      // Numbers below 1 are padded with leading zeros, e.g. 5 with k=2 is 0.05
+      dst[len++] = '0';
+      dst[len++] = '.';
+      memset(dst + len, '0', k - digits_len);
+      len += k - digits_len;
+      memcpy(dst + len, buffer, digits_len);
+      return len + digits_len;
+    }
+    memcpy(dst + len, buffer, digits_len - k);
+    len += digits_len - k;
+    if (k > 0) {
+      dst[len++] = '.';
+      memcpy(dst + len, buffer + digits_len - k, k);
+      len += k;
+    }
+    return len;
+  }
+  return 0;
+}
+
+/// @brief Formats the floating point number into 'dst' using the shortest precision that reads back as the same value,
+/// starting at the precision that is always exact for decimals (6 for floats, 15 for doubles)
+/// @return The length of the formatted number
+static size_t PblFormatFloating(char *dst, double val, bool single) {
+  size_t short_len = PblFormatShortDecimal(dst, val, single);
+  if (short_len != 0) return short_len;
+
+  int max_precision = single ? 9 : 17;
+  int precision = single ? 6 : 15;
+  int len = snprintf(dst, PBL_PRINT_MAX_NUMBER_LEN, "%.*g", precision, val);
+  while (isfinite(val) && precision < max_precision) {
+    double read_back = strtod(dst, NULL);
+    if (single ? (float) read_back == (float) val : read_back == val) break;
+    len = snprintf(dst, PBL_PRINT_MAX_NUMBER_LEN, "%.*g", ++precision, val);
+  }
+  return (size_t) len;
+}
+
+size_t PblFormatPrintArgNumber(const PblPrintArg_T *arg, char *dst) {
+  size_t len;
+  switch (arg->type) {
+    case PBL_PRINT_ARG_SIGNED:
+      if (arg->num.i < 0) {
+        dst[0] = '-';
+        // Negating as unsigned, so the min. value does not overflow
+        len = 1 + PblFormatUnsigned(dst + 1, 0ULL - (unsigned long long) arg->num.i);
+      } else {
+        len = PblFormatUnsigned(dst, (unsigned long long) arg->num.i);
+      }
+      break;
+    case PBL_PRINT_ARG_UNSIGNED:
+      len = PblFormatUnsigned(dst, arg->num.u);
+      break;
+    case PBL_PRINT_ARG_CHAR:
+      dst[0] = arg->num.c;
+      len = 1;
+      break;
+    case PBL_PRINT_ARG_FLOAT:
+    case PBL_PRINT_ARG_DOUBLE:
+      len = PblFormatFloating(dst, arg->num.d, arg->type == PBL_PRINT_ARG_FLOAT);
+      break;
+    default:
+      len = 0;
+      break;
+  }
+  return len;
+}
+
+/// @brief The parts of a print that are gathered before they are written using a single vectored write
+struct PblPrintGather {
+  /// @brief The stream that is written to
+  PblIOStream_T *stream;
+  /// @brief The gathered parts
+  struct iovec parts[PBL_PRINT_MAX_PARTS];
+  /// @brief The amount of gathered parts
+  int amount;
+  /// @brief The total length of the gathered parts
+  size_t total;
+  /// @brief The formatted numbers, which are referenced by the gathered parts
+  char scratch[PBL_PRINT_MAX_PARTS * PBL_PRINT_MAX_NUMBER_LEN];
+  /// @brief The amount of used bytes in 'scratch'
+  size_t scratch_used;
+  /// @brief The amount of bytes written so far
+  size_t written;
+};
+
+/// @brief Writes all passed parts to the file descriptor, while retrying on partial writes and interrupts
+/// @return The amount of bytes written
+static size_t PblWritevAllToFd(int fd, struct iovec *parts, int amount) {
+  size_t written = 0;
+  while (amount > 0) {
+    ssize_t result = writev(fd, parts, amount);
+    if (result < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    written += (size_t) result;
+
+    // Skipping the parts that were written entirely, and moving into the partially written one
+    size_t rest = (size_t) result;
+    while (amount > 0 && rest >= parts->iov_len) {
+      rest -= parts->iov_len;
+      parts++;
+      amount--;
+    }
+    if (amount > 0) {
+      parts->iov_base = (char *) parts->iov_base + rest;
+      parts->iov_len -= rest;
+    }
+  }
+  return written;
+}
+
+/// @brief Returns whether the FILE is unbuffered, meaning every stdio write would be a separate system call
+/// @note Without <stdio_ext.h> the buffering mode can not be queried, so every FILE is treated as unbuffered
+static bool PblIsFileUnbuffered(FILE *file) {
+#ifdef PBL_HAS_STDIO_EXT
+  // Unbuffered FILEs use a buffer of a single byte, while 0 means the buffer was not allocated yet
+  return __fbufsize(file) == 1;
+#else
+  (void) file;
+  return true;
+#endif
+}
+
+/// @brief Writes the gathered parts onto the stream and resets the gather
+/// @note Requires the stream to be locked
+static void PblEmitPrintGather(struct PblPrintGather *gather) {
+  if (gather->amount == 0) return;
+
+  struct PblStreamBuffer *buffer = gather->stream->actual.buffer;
+  if (buffer != NULL) {
+    PblSwitchStreamBufferToWrite(buffer);
+    if (buffer->flush != PBL_STREAM_FLUSH_NONE && buffer->len + gather->total <= buffer->capacity) {
+      // Copying the parts into the buffer, which avoids the system call entirely
+      bool has_newline = false;
+      for (int i = 0; i < gather->amount; i++) {
+        memcpy(buffer->data + buffer->len, gather->parts[i].iov_base, gather->parts[i].iov_len);
+        buffer->len += gather->parts[i].iov_len;
+        has_newline = has_newline || memchr(gather->parts[i].iov_base, '\n', gather->parts[i].iov_len) != NULL;
+      }
+      gather->written += gather->total;
+      if (buffer->flush == PBL_STREAM_FLUSH_LINE && has_newline) PblFlushStreamBuffer(buffer);
+    } else if (PblFlushStreamBuffer(buffer)) {
+      gather->written += PblWritevAllToFd(buffer->fd, gather->parts, gather->amount);
+    }
+  } else {
+    FILE *file = gather->stream->actual.file->actual;
+    int fd = fileno(file);
+    if (fd != -1 && PblIsFileUnbuffered(file) && fflush(file) == 0) {
+      gather->written += PblWritevAllToFd(fd, gather->parts, gather->amount);
+    } else {
+      // Buffered FILEs already collect the parts into a single write, and streams without a file descriptor (e.g.
+      // memory streams) can only be written using stdio
+      for (int i = 0; i < gather->amount; i++)
+        gather->written += fwrite(gather->parts[i].iov_base, sizeof(char), gather->parts[i].iov_len, file);
+    }
+  }
+
+  gather->amount = 0;
+  gather->total = 0;
+  gather->scratch_used = 0;
+}
+
+/// @brief Adds the bytes to the gather, and writes the gathered parts first if the gather is full
+static void PblGatherBytes(struct PblPrintGather *gather, const char *ptr, size_t len) {
+  if (len == 0) return;
+  if (gather->amount == PBL_PRINT_MAX_PARTS) PblEmitPrintGather(gather);
+  gather->parts[gather->amount++] = (struct iovec){.iov_base = (void *) ptr, .iov_len = len};
+  gather->total += len;
+}
+
+/// @brief Adds the arg to the gather, which formats numbers into the scratch buffer of the gather
+static void PblGatherPrintArg(struct PblPrintGather *gather, const PblPrintArg_T *arg) {
+  if (arg->type == PBL_PRINT_ARG_BYTES) {
+    PblGatherBytes(gather, arg->ptr, arg->len);
+    return;
+  }
+
+  // The parts reference the scratch buffer, so it may only be reused after they were written
+  if (gather->amount == PBL_PRINT_MAX_PARTS) PblEmitPrintGather(gather);
+  char *dst = gather->scratch + gather->scratch_used;
+  size_t len = PblFormatPrintArgNumber(arg, dst);
+  gather->scratch_used += PBL_PRINT_MAX_NUMBER_LEN;
+  PblGatherBytes(gather, dst, len);
+}
+
+/// @brief Locks the stream for an entire print, so its parts are not interleaved with the output of other threads
+static void PblLockPrintStream(PblIOStream_T *stream) {
+  if (stream->actual.buffer != NULL) {
+    PblLockStreamBuffer(stream->actual.buffer);
+  } else {
+    flockfile(stream->actual.file->actual);
+  }
+}
+
+/// @brief Unlocks the stream after a print
+static void PblUnlockPrintStream(PblIOStream_T *stream) {
+  if (stream->actual.buffer != NULL) {
+    PblUnlockStreamBuffer(stream->actual.buffer);
+  } else {
+    funlockfile(stream->actual.file->actual);
+  }
+}
+
+size_t PblPrintArgs(PblIOStream_T *stream, const PblPrintArg_T *args, size_t amount) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  if (amount == 0 || PblIsStreamClosed(stream)) return 0;
+  args = PblValPtr((void *) args);
+
+  struct PblPrintGather gather = {.stream = stream, .amount = 0, .total = 0, .scratch_used = 0, .written = 0};
+  PblLockPrintStream(stream);
+  for (size_t i = 0; i < amount; i++) PblGatherPrintArg(&gather, &args[i]);
+  PblEmitPrintGather(&gather);
+  PblUnlockPrintStream(stream);
+  return gather.written;
+}
+
+size_t PblPrintFormatArgs(PblIOStream_T *stream, const char *format, const PblPrintArg_T *args, size_t amount) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  format = PblValPtr((void *) format);
+  if (PblIsStreamClosed(stream)) return 0;
+
+  struct PblPrintGather gather = {.stream = stream, .amount = 0, .total = 0, .scratch_used = 0, .written = 0};
+  PblLockPrintStream(stream);
+
+  size_t next_arg = 0;
+  const char *literal = format;
+  const char *pos = format;
+  while (*pos != '\0') {
+    if (*pos != '{' && *pos != '}') {
+      pos++;
+      continue;
+    }
+
+    bool placeholder = pos[0] == '{' && pos[1] == '}' && next_arg < amount;
+    bool escaped = pos[1] == pos[0];
+    if (!placeholder && !escaped) {
+      pos++;
+      continue;
+    }
+
+    // Escaped braces are written as a single brace by ending the literal after the first one
+    PblGatherBytes(&gather, literal, (size_t) (pos - literal) + (escaped && !placeholder ? 1 : 0));
+    if (placeholder) PblGatherPrintArg(&gather, &args[next_arg++]);
+    pos += 2;
+    literal = pos;
+  }
+  PblGatherBytes(&gather, literal, (size_t) (pos - literal));
+
+  PblEmitPrintGather(&gather);
+  PblUnlockPrintStream(stream);
+  return gather.written;
+}
+
+// ---- End of Vectored Printing --------------------------------------------------------------------------------------
+
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
 PblIOFile_T *PblGetIOFileT(FILE *val) {
@@ -36,6 +1140,38 @@ PblIOStream_T *PblGetIOStreamT(int fd, const char *mode) {
   return conv;
 }
 
+/// @brief The default end char of 'PblPrint' - shared to avoid allocating a new char on every call
+static PblChar_T PBL_PRINT_DEFAULT_END = {.meta = {.defined = true}, .actual = '\n'};
+/// @brief The default end char of 'PblInput' and 'PblInputChar' - shared to avoid allocating a new char on every call
+static PblChar_T PBL_INPUT_DEFAULT_END = {.meta = {.defined = true}, .actual = '\0'};
+
+/// @brief The shared standard streams, which are NULL until they are requested for the first time
+static _Atomic(PblIOStream_T *) PBL_STDIN_STREAM = NULL;
+static _Atomic(PblIOStream_T *) PBL_STDOUT_STREAM = NULL;
+static _Atomic(PblIOStream_T *) PBL_STDERR_STREAM = NULL;
+
+/// @brief Gets the shared stream stored in 'cache', and creates it if it does not exist yet
+static PblIOStream_T *PblGetSharedStdStream(_Atomic(PblIOStream_T *) *cache, unsigned int fd, FILE *file) {
+  PblIOStream_T *stream = atomic_load_explicit(cache, memory_order_acquire);
+  if (stream != NULL) return stream;
+
+  PblIOStream_T *created = PblMalloc(sizeof(PblIOStream_T));
+  *created = PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblIOStream_T, .fd = PblGetUIntT(fd),
+                                                            .file = PblGetIOFileT(file), .open = PblGetBoolT(true),
+                                                            .mode = PblInternCString("a"));
+
+  // If another thread was faster, its stream is used and the one created here is left to the garbage collector
+  if (!atomic_compare_exchange_strong_explicit(cache, &stream, created, memory_order_acq_rel, memory_order_acquire))
+    return stream;
+  return created;
+}
+
+PblIOStream_T *PblStdin(void) { return PblGetSharedStdStream(&PBL_STDIN_STREAM, 0, stdin); }
+
+PblIOStream_T *PblStdout(void) { return PblGetSharedStdStream(&PBL_STDOUT_STREAM, 1, stdout); }
+
+PblIOStream_T *PblStderr(void) { return PblGetSharedStdStream(&PBL_STDERR_STREAM, 2, stderr); }
+
 PblChar_T *PblInputChar_Base(PblString_T *display_msg, PblChar_T* end) {
   PblPrint(display_msg, .end=end);
 
@@ -47,7 +1183,7 @@ PblChar_T *PblInputChar_Base(PblString_T *display_msg, PblChar_T* end) {
 __attribute__((unused)) PblChar_T * PblInputChar_Overhead(struct PblInputChar_Args in) {
   // Validate the pointer for safety measures
   PblString_T *display_msg = PBL_VAL_REQ_ARG(in.display_msg);
-  PblChar_T *end = in.end != NULL ? in.end : PblGetCharT('\0');
+  PblChar_T *end = in.end != NULL ? in.end : &PBL_INPUT_DEFAULT_END;
   return PblInputChar_Base(display_msg, end);
 }
 
@@ -55,46 +1191,43 @@ PblString_T *PblInput_Base(PblString_T *display_msg, PblChar_T *end) {
   // Printing the initial display message
   PblPrint(display_msg, .end=end);
 
-  // Initial size
-  unsigned int length = 100;
-  // Allocate mem for 100 chars
-  char *in_str = PblMalloc(length * sizeof(char));
-  // Keep Track of how many chars where inputted now
-  int count = 0;
-
-  char c;
-  // Run as long as it's not a newline
-  while((c = (char) getchar()) != '\n') {
-    // If the character is EOF, abort immediately
-    // (This should not happen though on a console stream, but covering for possible edge cases )
-    if (c == EOF)
-      break;
-
-    if(count >= length) {
-      // Resize the buffer. We increase each time with 50
-      length += 50;
-      in_str = PblRealloc(in_str, length * sizeof(char));
-    }
-    // Writing the char into the name
-    in_str[count++] = c;
-  }
-  return PblGetStringT(in_str);
+  // Reading until the newline, which is not included in the returned string
+  PblString_T *line = PblReadLine(PblStdin());
+  return line != NULL ? line : PblGetStringT("");
 }
 
 __attribute__((unused)) PblString_T * PblInput_Overhead(struct PblInput_Args in) {
   // Validate the pointer for safety measures
   PblString_T *display_msg = PBL_VAL_REQ_ARG(in.display_msg);
-  PblChar_T *end = in.end != NULL ? in.end : PblGetCharT('\0');
+  PblChar_T *end = in.end != NULL ? in.end : &PBL_INPUT_DEFAULT_END;
   return PblInput_Base(display_msg, end);
 }
 
 PblVoid_T PblPrint_Base(PblString_T *out, PblIOStream_T *stream, PblChar_T *end) {
   // Validate the pointer for safety measures
   out = PblValPtr((void *) out);
+  stream = PblValPtr((void *) stream);
+  end = PblValPtr((void *) end);
+  if (PblIsStreamClosed(stream)) return PblVoid_T_DeclDefault;
 
-  for (int i = 0; i < out->actual.len->actual; i++)
-    fprintf(stream->actual.file->actual, "%c", (out->actual.str[i].actual));
-  fprintf(stream->actual.file->actual, "%c", end->actual);
+  // Streams with a Pbl-managed buffer bypass stdio entirely
+  struct PblStreamBuffer *buffer = stream->actual.buffer;
+  if (buffer != NULL) {
+    PblLockStreamBuffer(buffer);
+    PblWriteToStreamBuffer(buffer, PblGetStringBytes(out), out->actual.len->actual);
+    PblWriteToStreamBuffer(buffer, (const char *) &end->actual, sizeof(char));
+    PblUnlockStreamBuffer(buffer);
+    return PblVoid_T_DeclDefault;
+  }
+
+  FILE *file = stream->actual.file->actual;
+  // Locking the FILE once for the entire print, which also ensures the content and the end char are not interleaved
+  // with the output of other threads
+  flockfile(file);
+  // Writing the contiguous byte copy in one go instead of formatting every char on its own
+  fwrite(PblGetStringBytes(out), sizeof(char), out->actual.len->actual, file);
+  putc_unlocked(end->actual, file);
+  funlockfile(file);
   return PblVoid_T_DeclDefault;
 }
 
@@ -102,15 +1235,28 @@ __attribute__((unused)) PblVoid_T PblPrint_Overhead(struct PblPrint_Args in) {
   // Validate the pointer for safety measures
   PblString_T *out = PBL_VAL_REQ_ARG(in.out);
 
-  PblIOStream_T *stream;
-  if (in.stream != NULL) {
-    stream = in.stream;
-  } else {
-    stream = PblMalloc(sizeof(PblIOStream_T));
-    *stream = PBL_STREAM_STDOUT;
-  }
-  PblChar_T *end = in.end != NULL ? in.end : PblGetCharT('\n');
+  PblIOStream_T *stream = in.stream != NULL ? in.stream : PblStdout();
+  PblChar_T *end = in.end != NULL ? in.end : &PBL_PRINT_DEFAULT_END;
   return PblPrint_Base(out, stream, end);
 }
 
+bool PblPrintTraceback_Base(PblFunctionCallMetaData_T *ctx, PblIOStream_T *stream) {
+  // Validate the pointer for safety measures
+  ctx = PblValPtr((void *) ctx);
+  stream = PblValPtr((void *) stream);
+
+  PblString_T *traceback = PblFormatTraceback(ctx);
+  if (traceback == NULL) return false;
+  PblPrintArg_T arg = PblGetPrintArgOfString(traceback);
+  return PblPrintArgs(stream, &arg, 1) == traceback->actual.len->actual;
+}
+
+__attribute__((unused)) bool PblPrintTraceback_Overhead(struct PblPrintTraceback_Args in) {
+  // Validate the pointer for safety measures
+  PblFunctionCallMetaData_T *ctx = PBL_VAL_REQ_ARG(in.ctx);
+
+  PblIOStream_T *stream = in.stream != NULL ? in.stream : PblStderr();
+  return PblPrintTraceback_Base(ctx, stream);
+}
+
 // ---- End of Function Definitions -----------------------------------------------------------------------------------
@@ -0,0 +1,500 @@
+/// @file pbl-log.c
+/// @brief Asynchronous logging, where every thread writes its records into its own lock-free ring buffer, which a
+/// background thread drains in large batches onto the target stream
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/io/pbl-log.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// Threads and atomics for the ring buffers and the background thread
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// ---- Ring Buffers --------------------------------------------------------------------------------------------------
+
+/// @brief The size of a cache line, which separates the indices of the producer and the consumer of a ring buffer
+#define PBL_LOG_CACHE_LINE_SIZE 64
+
+/// @brief The min. size of a ring buffer in bytes
+#define PBL_LOG_MIN_RING_SIZE 64
+
+/// @brief Single-producer single-consumer ring buffer of a thread, which contains newline-terminated records. The
+/// owning thread is the only producer, and the background thread the only consumer
+struct PblLogRing {
+  /// @brief The total amount of bytes written by the producer - a record is published by advancing it after the
+  /// record was written entirely
+  _Alignas(PBL_LOG_CACHE_LINE_SIZE) _Atomic(size_t) head;
+  /// @brief The last value of 'tail' the producer has seen, which avoids loading the index of the consumer for every
+  /// record
+  size_t cached_tail;
+  /// @brief Whether the producer accepted a record it did not commit or drop yet, which 'PblLogStop' waits for
+  _Atomic(bool) writing;
+  /// @brief The amount of records accepted into the buffer (only written by the producer)
+  _Atomic(uint64_t) records_logged;
+  /// @brief The amount of records dropped by the producer (only written by the producer)
+  _Atomic(uint64_t) records_dropped;
+  /// @brief The total amount of bytes consumed by the background thread
+  _Alignas(PBL_LOG_CACHE_LINE_SIZE) _Atomic(size_t) tail;
+  /// @brief Whether the producer already woke the background thread since the last time the buffer was drained
+  _Atomic(bool) nudged;
+  /// @brief The buffered bytes
+  _Alignas(PBL_LOG_CACHE_LINE_SIZE) char *data;
+  /// @brief The size of 'data' in bytes, which is a power of two
+  size_t capacity;
+  /// @brief Whether the owning thread exited, meaning the buffer can be freed once it is drained
+  _Atomic(bool) closed;
+  /// @brief The next ring buffer in the list of the logger
+  struct PblLogRing *next;
+};
+
+/// @brief The global state of the logger
+struct PblLogger {
+  /// @brief Protects the list of ring buffers, the flush counters and the start/stop transitions
+  pthread_mutex_t lock;
+  /// @brief Signalled to wake the background thread before its flush interval passed
+  pthread_cond_t wake;
+  /// @brief Signalled after the background thread completed a pass over all ring buffers
+  pthread_cond_t flushed;
+  /// @brief The ring buffers of all threads that logged
+  struct PblLogRing *rings;
+  /// @brief Whether records are accepted
+  _Atomic(bool) running;
+  /// @brief Whether the background thread exists (also while it is being stopped)
+  bool thread_active;
+  /// @brief Whether the background thread exits after its next pass, which is only set once no producer is writing
+  bool thread_stop;
+  /// @brief The background thread
+  pthread_t thread;
+  /// @brief The configuration passed to 'PblLogStart'
+  PblIOStream_T *stream;
+  _Atomic(size_t) ring_size;
+  _Atomic(int) overflow;
+  size_t batch_size;
+  unsigned int flush_interval_ms;
+  /// @brief The batch buffer of the background thread
+  char *batch;
+  /// @brief The amount of requested and completed flushes, which 'PblLogFlush' waits on
+  uint64_t flush_requested;
+  uint64_t flush_completed;
+  /// @brief The counters of the ring buffers that were already freed
+  uint64_t retired_logged;
+  uint64_t retired_dropped;
+  /// @brief The amount of records dropped while the logger was not running
+  _Atomic(uint64_t) dropped_not_running;
+  /// @brief The amount of bytes and batches written by the background thread
+  _Atomic(uint64_t) bytes_written;
+  _Atomic(uint64_t) batches_written;
+};
+
+/// @brief The global logger
+static struct PblLogger PBL_LOGGER = {.lock = PTHREAD_MUTEX_INITIALIZER,
+                                      .wake = PTHREAD_COND_INITIALIZER,
+                                      .flushed = PTHREAD_COND_INITIALIZER,
+                                      .rings = NULL,
+                                      .running = false,
+                                      .thread_active = false,
+                                      .thread_stop = false,
+                                      .ring_size = PBL_LOG_DEFAULT_RING_SIZE,
+                                      .overflow = PBL_LOG_OVERFLOW_DROP};
+
+/// @brief The ring buffer of the current thread, which is NULL until the thread logs for the first time
+static _Thread_local struct PblLogRing *PBL_LOG_THREAD_RING = NULL;
+
+/// @brief The key, whose destructor marks the ring buffer of an exiting thread as closed
+static pthread_key_t PBL_LOG_THREAD_KEY;
+static pthread_once_t PBL_LOG_THREAD_KEY_ONCE = PTHREAD_ONCE_INIT;
+
+/// @brief Marks the ring buffer of the exiting thread as closed, so the background thread frees it once it is drained
+static void PblCloseThreadLogRing(void *ring) {
+  PBL_LOG_THREAD_RING = NULL;
+  atomic_store_explicit(&((struct PblLogRing *) ring)->closed, true, memory_order_release);
+}
+
+static void PblCreateLogThreadKey(void) { pthread_key_create(&PBL_LOG_THREAD_KEY, PblCloseThreadLogRing); }
+
+/// @brief Gets the ring buffer of the current thread, and creates it if the thread logs for the first time
+static struct PblLogRing *PblGetThreadLogRing(void) {
+  struct PblLogRing *ring = PBL_LOG_THREAD_RING;
+  if (ring != NULL) return ring;
+  pthread_once(&PBL_LOG_THREAD_KEY_ONCE, PblCreateLogThreadKey);
+
+  size_t requested = atomic_load_explicit(&PBL_LOGGER.ring_size, memory_order_relaxed);
+  size_t capacity = PBL_LOG_MIN_RING_SIZE;
+  while (capacity < requested) capacity <<= 1;
+
+  // The ring buffers are freed manually by the background thread, which is not known to the garbage collector
+  ring = PblMallocUncollectable(sizeof(struct PblLogRing));
+  ring->data = PblMallocUncollectable(capacity);
+  ring->capacity = capacity;
+  ring->cached_tail = 0;
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  atomic_init(&ring->records_logged, 0);
+  atomic_init(&ring->records_dropped, 0);
+  atomic_init(&ring->nudged, false);
+  atomic_init(&ring->closed, false);
+  atomic_init(&ring->writing, false);
+
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  ring->next = PBL_LOGGER.rings;
+  PBL_LOGGER.rings = ring;
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+
+  pthread_setspecific(PBL_LOG_THREAD_KEY, ring);
+  PBL_LOG_THREAD_RING = ring;
+  return ring;
+}
+
+/// @brief Increments a counter that is only written by a single thread, which avoids a locked read-modify-write
+static inline void PblIncrementOwnedCounter(_Atomic(uint64_t) *counter) {
+  atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+/// @brief Wakes the background thread without locking, where a missed wake-up only delays the drain until the
+/// flush interval passed
+static inline void PblWakeLogFlusher(void) { pthread_cond_signal(&PBL_LOGGER.wake); }
+
+/// @brief Ensures the ring buffer has space for 'len' more bytes, while applying the overflow policy
+/// @return True if the space is available, false if the record has to be dropped
+static bool PblReserveLogRing(struct PblLogRing *ring, size_t len) {
+  if (len > ring->capacity) return false;
+
+  size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  if (head + len - ring->cached_tail <= ring->capacity) return true;
+  ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  if (head + len - ring->cached_tail <= ring->capacity) return true;
+
+  PblWakeLogFlusher();
+  if (atomic_load_explicit(&PBL_LOGGER.overflow, memory_order_relaxed) == PBL_LOG_OVERFLOW_DROP) return false;
+
+  // Backpressure: waiting for the background thread to drain the buffer
+  while (head + len - ring->cached_tail > ring->capacity) {
+    if (!atomic_load_explicit(&PBL_LOGGER.running, memory_order_relaxed)) return false;
+    PblWakeLogFlusher();
+    sched_yield();
+    ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  }
+  return true;
+}
+
+/// @brief Copies the bytes into the ring buffer at the passed position, wrapping around at the end of the buffer
+static void PblCopyIntoLogRing(struct PblLogRing *ring, size_t pos, const char *src, size_t len) {
+  size_t offset = pos & (ring->capacity - 1);
+  size_t first = len < ring->capacity - offset ? len : ring->capacity - offset;
+  memcpy(ring->data + offset, src, first);
+  if (first < len) memcpy(ring->data, src + first, len - first);
+}
+
+/// @brief Publishes the record that was written from the current head up to 'end'
+static void PblCommitLogRecord(struct PblLogRing *ring, size_t end) {
+  atomic_store_explicit(&ring->head, end, memory_order_release);
+  PblIncrementOwnedCounter(&ring->records_logged);
+  atomic_store_explicit(&ring->writing, false, memory_order_release);
+
+  // Waking the background thread early once the buffer is half full, so the buffer rarely overflows
+  size_t used = end - ring->cached_tail;
+  if (used > ring->capacity / 2 && !atomic_load_explicit(&ring->nudged, memory_order_relaxed)) {
+    atomic_store_explicit(&ring->nudged, true, memory_order_relaxed);
+    PblWakeLogFlusher();
+  }
+}
+
+/// @brief Counts the accepted record as dropped, as it did not fit into the ring buffer
+static void PblDropLogRecord(struct PblLogRing *ring) {
+  PblIncrementOwnedCounter(&ring->records_dropped);
+  atomic_store_explicit(&ring->writing, false, memory_order_release);
+}
+
+/// @brief Gets the ring buffer for a new record, or counts the record as dropped if the logger is not running. The
+/// record must be finished using 'PblCommitLogRecord' or 'PblDropLogRecord'
+static struct PblLogRing *PblBeginLogRecord(void) {
+  if (atomic_load_explicit(&PBL_LOGGER.running, memory_order_acquire)) {
+    struct PblLogRing *ring = PblGetThreadLogRing();
+    // Announcing the record before checking again, where both accesses are sequentially consistent, so either
+    // 'PblLogStop' waits for the record or the record sees that the logger is stopping
+    atomic_store(&ring->writing, true);
+    if (atomic_load(&PBL_LOGGER.running)) return ring;
+    atomic_store_explicit(&ring->writing, false, memory_order_release);
+  }
+  atomic_fetch_add_explicit(&PBL_LOGGER.dropped_not_running, 1, memory_order_relaxed);
+  return NULL;
+}
+
+// ---- End of Ring Buffers -------------------------------------------------------------------------------------------
+
+// ---- Background Thread ---------------------------------------------------------------------------------------------
+
+/// @brief Writes the batch onto the stream
+static void PblWriteLogBatch(const char *batch, size_t len) {
+  size_t written = PblStreamWrite(PBL_LOGGER.stream, batch, len);
+  atomic_fetch_add_explicit(&PBL_LOGGER.bytes_written, written, memory_order_relaxed);
+  atomic_fetch_add_explicit(&PBL_LOGGER.batches_written, 1, memory_order_relaxed);
+}
+
+/// @brief Moves all published records of the ring buffers into the batch, which is written every time it is full
+/// @note The list is only modified at its head by other threads, so it can be walked without holding the lock
+static void PblDrainLogRings(struct PblLogRing *rings) {
+  size_t used = 0;
+  for (struct PblLogRing *ring = rings; ring != NULL; ring = ring->next) {
+    atomic_store_explicit(&ring->nudged, false, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    while (tail != head) {
+      size_t offset = tail & (ring->capacity - 1);
+      size_t amount = head - tail;
+      if (amount > ring->capacity - offset) amount = ring->capacity - offset;
+      if (amount > PBL_LOGGER.batch_size - used) amount = PBL_LOGGER.batch_size - used;
+
+      memcpy(PBL_LOGGER.batch + used, ring->data + offset, amount);
+      used += amount;
+      tail += amount;
+      // Releasing the space to the producer as soon as it was copied
+      atomic_store_explicit(&ring->tail, tail, memory_order_release);
+
+      if (used == PBL_LOGGER.batch_size) {
+        PblWriteLogBatch(PBL_LOGGER.batch, used);
+        used = 0;
+      }
+    }
+  }
+
+  if (used > 0) PblWriteLogBatch(PBL_LOGGER.batch, used);
+  PblStreamFlush(PBL_LOGGER.stream);
+}
+
+/// @brief Frees the ring buffers of exited threads that were drained entirely
+/// @note Requires the lock of the logger to be held
+static void PblRetireClosedLogRings(void) {
+  struct PblLogRing **link = &PBL_LOGGER.rings;
+  while (*link != NULL) {
+    struct PblLogRing *ring = *link;
+    bool drained = atomic_load_explicit(&ring->tail, memory_order_relaxed) ==
+                   atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (!atomic_load_explicit(&ring->closed, memory_order_acquire) || !drained) {
+      link = &ring->next;
+      continue;
+    }
+
+    *link = ring->next;
+    PBL_LOGGER.retired_logged += atomic_load_explicit(&ring->records_logged, memory_order_relaxed);
+    PBL_LOGGER.retired_dropped += atomic_load_explicit(&ring->records_dropped, memory_order_relaxed);
+    PblFree(ring->data);
+    PblFree(ring);
+  }
+}
+
+/// @brief Gets the absolute time the flush interval passes from now on
+static struct timespec PblGetLogWakeTime(void) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += PBL_LOGGER.flush_interval_ms / 1000;
+  deadline.tv_nsec += (long) (PBL_LOGGER.flush_interval_ms % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  return deadline;
+}
+
+/// @brief The main function of the background thread, which drains all ring buffers every flush interval, when a
+/// producer wakes it or when a flush is requested
+/// @note This never allocates using the garbage collector, as the thread is not registered with it
+static void *PblRunLogFlusher(__attribute__((unused)) void *arg) {
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  while (true) {
+    bool stop = PBL_LOGGER.thread_stop;
+    uint64_t requested = PBL_LOGGER.flush_requested;
+    struct PblLogRing *rings = PBL_LOGGER.rings;
+    pthread_mutex_unlock(&PBL_LOGGER.lock);
+
+    PblDrainLogRings(rings);
+
+    pthread_mutex_lock(&PBL_LOGGER.lock);
+    PblRetireClosedLogRings();
+    PBL_LOGGER.flush_completed = requested;
+    pthread_cond_broadcast(&PBL_LOGGER.flushed);
+
+    // The pass after stopping wrote the remaining records
+    if (stop) break;
+    if (PBL_LOGGER.flush_requested == requested && !PBL_LOGGER.thread_stop) {
+      struct timespec deadline = PblGetLogWakeTime();
+      pthread_cond_timedwait(&PBL_LOGGER.wake, &PBL_LOGGER.lock, &deadline);
+    }
+  }
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+  return NULL;
+}
+
+// ---- End of Background Thread --------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+bool PblLogStart_Base(PblIOStream_T *stream, size_t ring_size, size_t batch_size, unsigned int flush_interval_ms,
+                      enum PblLogOverflowPolicy overflow) {
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  if (PBL_LOGGER.thread_active) {
+    pthread_mutex_unlock(&PBL_LOGGER.lock);
+    return false;
+  }
+
+  PBL_LOGGER.stream = stream;
+  PBL_LOGGER.batch_size = batch_size;
+  PBL_LOGGER.flush_interval_ms = flush_interval_ms;
+  PBL_LOGGER.thread_stop = false;
+  // Allocated here, as the background thread may not allocate using the garbage collector
+  PBL_LOGGER.batch = PblMallocUncollectable(batch_size);
+  atomic_store_explicit(&PBL_LOGGER.ring_size, ring_size, memory_order_relaxed);
+  atomic_store_explicit(&PBL_LOGGER.overflow, overflow, memory_order_relaxed);
+  atomic_store_explicit(&PBL_LOGGER.running, true, memory_order_release);
+
+  if (pthread_create(&PBL_LOGGER.thread, NULL, PblRunLogFlusher, NULL) != 0) {
+    atomic_store_explicit(&PBL_LOGGER.running, false, memory_order_release);
+    PblFree(PBL_LOGGER.batch);
+    PBL_LOGGER.batch = NULL;
+    pthread_mutex_unlock(&PBL_LOGGER.lock);
+    return false;
+  }
+  PBL_LOGGER.thread_active = true;
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+  return true;
+}
+
+__attribute__((unused)) bool PblLogStart_Overhead(struct PblLogStart_Args in) {
+  // Validate the pointer for safety measures
+  PblIOStream_T *stream = in.stream != NULL ? PblValPtr((void *) in.stream) : PblStderr();
+  size_t ring_size = in.ring_size != 0 ? in.ring_size : PBL_LOG_DEFAULT_RING_SIZE;
+  size_t batch_size = in.batch_size != 0 ? in.batch_size : PBL_LOG_DEFAULT_BATCH_SIZE;
+  unsigned int flush_interval_ms = in.flush_interval_ms != 0 ? in.flush_interval_ms : PBL_LOG_DEFAULT_FLUSH_INTERVAL_MS;
+  return PblLogStart_Base(stream, ring_size, batch_size, flush_interval_ms, in.overflow);
+}
+
+bool PblLogStop(void) {
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  if (!atomic_load_explicit(&PBL_LOGGER.running, memory_order_relaxed)) {
+    pthread_mutex_unlock(&PBL_LOGGER.lock);
+    return false;
+  }
+  // Rejecting new records first, and then waiting for the records that were accepted before, so the last pass of the
+  // background thread includes every accepted record. Producers blocked by a full ring buffer give up once they see
+  // that the logger is stopping
+  atomic_store(&PBL_LOGGER.running, false);
+  for (struct PblLogRing *ring = PBL_LOGGER.rings; ring != NULL; ring = ring->next) {
+    while (atomic_load_explicit(&ring->writing, memory_order_acquire)) sched_yield();
+  }
+  PBL_LOGGER.thread_stop = true;
+  pthread_cond_signal(&PBL_LOGGER.wake);
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+
+  // The background thread writes the remaining records before it exits
+  pthread_join(PBL_LOGGER.thread, NULL);
+
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  PblFree(PBL_LOGGER.batch);
+  PBL_LOGGER.batch = NULL;
+  PBL_LOGGER.thread_active = false;
+  // Releasing flushes that were requested after the last pass of the background thread
+  pthread_cond_broadcast(&PBL_LOGGER.flushed);
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+  return true;
+}
+
+bool PblLogFlush(void) {
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  if (!atomic_load_explicit(&PBL_LOGGER.running, memory_order_relaxed)) {
+    pthread_mutex_unlock(&PBL_LOGGER.lock);
+    return false;
+  }
+
+  // Waiting for a pass that started after this request, which includes all records logged before it
+  uint64_t ticket = ++PBL_LOGGER.flush_requested;
+  pthread_cond_signal(&PBL_LOGGER.wake);
+  while (PBL_LOGGER.flush_completed < ticket && PBL_LOGGER.thread_active)
+    pthread_cond_wait(&PBL_LOGGER.flushed, &PBL_LOGGER.lock);
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+  return true;
+}
+
+PblLogStats_T PblLogGetStats(void) {
+  pthread_mutex_lock(&PBL_LOGGER.lock);
+  PblLogStats_T stats = {
+    .records_logged = PBL_LOGGER.retired_logged,
+    .records_dropped =
+      PBL_LOGGER.retired_dropped + atomic_load_explicit(&PBL_LOGGER.dropped_not_running, memory_order_relaxed),
+    .bytes_written = atomic_load_explicit(&PBL_LOGGER.bytes_written, memory_order_relaxed),
+    .batches_written = atomic_load_explicit(&PBL_LOGGER.batches_written, memory_order_relaxed)};
+  for (struct PblLogRing *ring = PBL_LOGGER.rings; ring != NULL; ring = ring->next) {
+    stats.records_logged += atomic_load_explicit(&ring->records_logged, memory_order_relaxed);
+    stats.records_dropped += atomic_load_explicit(&ring->records_dropped, memory_order_relaxed);
+  }
+  pthread_mutex_unlock(&PBL_LOGGER.lock);
+  return stats;
+}
+
+bool PblLogBytes(const char *ptr, size_t len) {
+  // Validate the pointer for safety measures
+  ptr = PblValPtr((void *) ptr);
+
+  struct PblLogRing *ring = PblBeginLogRecord();
+  if (ring == NULL) return false;
+  if (!PblReserveLogRing(ring, len + 1)) {
+    PblDropLogRecord(ring);
+    return false;
+  }
+
+  size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  PblCopyIntoLogRing(ring, head, ptr, len);
+  PblCopyIntoLogRing(ring, head + len, "\n", 1);
+  PblCommitLogRecord(ring, head + len + 1);
+  return true;
+}
+
+bool PblLog(PblString_T *record) {
+  // Validate the pointer for safety measures
+  record = PblValPtr((void *) record);
+  return PblLogBytes(PblGetStringBytes(record), record->actual.len->actual);
+}
+
+bool PblLogArgs(const PblPrintArg_T *args, size_t amount) {
+  // Validate the pointer for safety measures
+  if (amount > 0) args = PblValPtr((void *) args);
+
+  struct PblLogRing *ring = PblBeginLogRecord();
+  if (ring == NULL) return false;
+
+  // Reserving the max. length, so the numbers can be formatted directly into the ring buffer in a single pass
+  size_t max_len = 1;
+  for (size_t i = 0; i < amount; i++)
+    max_len += args[i].type == PBL_PRINT_ARG_BYTES ? args[i].len : PBL_PRINT_MAX_NUMBER_LEN;
+  if (!PblReserveLogRing(ring, max_len)) {
+    PblDropLogRecord(ring);
+    return false;
+  }
+
+  size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  size_t pos = head;
+  char number[PBL_PRINT_MAX_NUMBER_LEN];
+  for (size_t i = 0; i < amount; i++) {
+    if (args[i].type == PBL_PRINT_ARG_BYTES) {
+      PblCopyIntoLogRing(ring, pos, args[i].ptr, args[i].len);
+      pos += args[i].len;
+    } else {
+      size_t len = PblFormatPrintArgNumber(&args[i], number);
+      PblCopyIntoLogRing(ring, pos, number, len);
+      pos += len;
+    }
+  }
+  PblCopyIntoLogRing(ring, pos, "\n", 1);
+  PblCommitLogRecord(ring, pos + 1);
+  return true;
+}
+
+// ---- End of Function Definitions -----------------------------------------------------------------------------------
@@ -0,0 +1,176 @@
+/// @file pbl-mmap.c
+/// @brief Read-only memory-mapped files, which expose the content of a file without copying it into the heap
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/io/pbl-mmap.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// POSIX memory mapping
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ---- Helper Functions ----------------------------------------------------------------------------------------------
+
+/// @brief Applies the 'PBL_MAP_ADVICE_*' flags to the passed mapping. Failures are ignored, as the advice is only a
+/// hint for the kernel
+static void PblApplyMapAdvice(void *addr, size_t len, unsigned int advice) {
+  if (advice & PBL_MAP_ADVICE_SEQUENTIAL) madvise(addr, len, MADV_SEQUENTIAL);
+  if (advice & PBL_MAP_ADVICE_WILLNEED) madvise(addr, len, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+  if (advice & PBL_MAP_ADVICE_HUGEPAGE) madvise(addr, len, MADV_HUGEPAGE);
+#endif
+}
+
+/// @brief Gets the page size, which every mapping offset has to be aligned to
+static size_t PblGetPageSize(void) {
+  static size_t page_size = 0;
+  if (page_size == 0) page_size = (size_t) sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+// ---- End of Helper Functions ---------------------------------------------------------------------------------------
+
+// ---- Functions Definitions -----------------------------------------------------------------------------------------
+
+PblMappedFile_T *PblMapFile_Base(PblString_T *path, unsigned int advice, bool chunked) {
+  int fd;
+  do {
+    fd = open(PblGetStringBytes(path), O_RDONLY | O_CLOEXEC);
+  } while (fd == -1 && errno == EINTR);
+  if (fd == -1) return NULL;
+
+  struct stat info;
+  if (fstat(fd, &info) == -1) {
+    int error = errno;
+    close(fd);
+    errno = error;
+    return NULL;
+  }
+
+  PBL_DEFINE_VAR(file, PblMappedFile_T);
+  file->actual.fd = fd;
+  file->actual.size = (size_t) info.st_size;
+  file->actual.advice = advice;
+
+  // Empty files can not be mapped, and chunked files are only mapped by their iterator
+  if (!chunked && file->actual.size > 0) {
+    void *data = mmap(NULL, file->actual.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      int error = errno;
+      close(fd);
+      errno = error;
+      return NULL;
+    }
+    PblApplyMapAdvice(data, file->actual.size, advice);
+    file->actual.data = data;
+  }
+  return file;
+}
+
+__attribute__((unused)) PblMappedFile_T *PblMapFile_Overhead(struct PblMapFile_Args in) {
+  // Validate the pointer for safety measures
+  PblString_T *path = PBL_VAL_REQ_ARG(in.path);
+  return PblMapFile_Base(path, in.advice, in.chunked);
+}
+
+PblStringView_T PblGetMappedFileView(PblMappedFile_T *file) {
+  // Validate the pointer for safety measures
+  file = PblValPtr((void *) file);
+
+  if (file->actual.data == NULL) return PblStringView_T_DefDefault;
+  return PblGetStringViewOfBytes(file->actual.data, file->actual.size);
+}
+
+bool PblUnmapFile(PblMappedFile_T *file) {
+  // Validate the pointer for safety measures
+  file = PblValPtr((void *) file);
+
+  bool success = true;
+  if (file->actual.data != NULL) {
+    success = munmap((void *) file->actual.data, file->actual.size) == 0;
+    file->actual.data = NULL;
+  }
+  if (file->actual.fd != -1) {
+    success = close(file->actual.fd) == 0 && success;
+    file->actual.fd = -1;
+  }
+  return success;
+}
+
+PblMappedChunkIter_T PblGetMappedChunkIter(PblMappedFile_T *file, size_t chunk_size, bool split_at_newline) {
+  // Validate the pointer for safety measures
+  file = PblValPtr((void *) file);
+
+  size_t page_size = PblGetPageSize();
+  size_t aligned_size = chunk_size < page_size ? page_size : (chunk_size + page_size - 1) / page_size * page_size;
+  return (PblMappedChunkIter_T){.file = file,
+                                .chunk_size = aligned_size,
+                                .split_at_newline = split_at_newline,
+                                .offset = 0,
+                                .window = NULL,
+                                .window_len = 0};
+}
+
+bool PblMappedChunkIterNext(PblMappedChunkIter_T *iter, PblStringView_T *chunk) {
+  // Validate the pointer for safety measures
+  iter = PblValPtr((void *) iter);
+  chunk = PblValPtr((void *) chunk);
+
+  // Releasing the previous chunk
+  PblMappedChunkIterClose(iter);
+
+  PblMappedFile_T *file = iter->file;
+  if (iter->offset >= file->actual.size) return false;
+
+  const char *start;
+  size_t len = file->actual.size - iter->offset < iter->chunk_size ? file->actual.size - iter->offset
+                                                                   : iter->chunk_size;
+  if (file->actual.data != NULL) {
+    // The file is already mapped as a whole, so the chunks are only slices of it
+    start = file->actual.data + iter->offset;
+  } else {
+    // Mapping offsets have to be aligned to the page size, so the window may start a little before the chunk
+    size_t window_offset = iter->offset - iter->offset % PblGetPageSize();
+    size_t window_len = iter->offset - window_offset + len;
+    void *window = mmap(NULL, window_len, PROT_READ, MAP_PRIVATE, file->actual.fd, (off_t) window_offset);
+    if (window == MAP_FAILED) return false;
+    PblApplyMapAdvice(window, window_len, file->actual.advice);
+
+    iter->window = window;
+    iter->window_len = window_len;
+    start = (const char *) window + (iter->offset - window_offset);
+  }
+
+  // Ending the chunk after its last newline, unless it is the last chunk of the file
+  if (iter->split_at_newline && iter->offset + len < file->actual.size) {
+    // Searching backwards, which usually only has to check the bytes of a single line
+    size_t end = len;
+    while (end > 0 && start[end - 1] != '\n') end--;
+    if (end > 0) len = end;
+  }
+
+  *chunk = PblGetStringViewOfBytes(start, len);
+  iter->offset += len;
+  return true;
+}
+
+void PblMappedChunkIterClose(PblMappedChunkIter_T *iter) {
+  // Validate the pointer for safety measures
+  iter = PblValPtr((void *) iter);
+
+  if (iter->window != NULL) {
+    munmap(iter->window, iter->window_len);
+    iter->window = NULL;
+    iter->window_len = 0;
+  }
+}
+
+// ---- End of Functions Definitions ----------------------------------------------------------------------------------
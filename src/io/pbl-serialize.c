@@ -0,0 +1,666 @@
+/// @file pbl-serialize.c
+/// @brief Compact binary serialisation of Pbl values, which is driven by type descriptors and uses varints for all
+/// integers and length prefixes
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/io/pbl-serialize.h>
+
+// General Required Header Inclusion
+#include <libpbl/mem/pbl-mem.h>
+
+// Limits of the decoded integers and the lock of the type registry
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/// @brief The size of the stack buffer values are encoded into before they are written onto a stream
+#define PBL_SERIAL_WRITE_BUFFER_SIZE 4096
+
+/// @brief The initial size of the buffer of 'PblSerializeToBytes'
+#define PBL_SERIAL_INITIAL_BYTES_SIZE 256
+
+/// @brief The max. amount of bytes of an encoded 64-bit varint
+#define PBL_SERIAL_MAX_VARINT_LEN 10
+
+/// @brief The amount of bytes read from a stream at once when decoding strings, as the length prefix of a stream can
+/// not be checked against the remaining input before reading
+#define PBL_SERIAL_STREAM_CHUNK_SIZE (64 * 1024)
+
+// ---- Built-in Types ------------------------------------------------------------------------------------------------
+
+/// @brief Initialiser of the descriptor of a built-in type
+#define PBL_SERIAL_BUILTIN_TYPE(pbl_type, type_name, serial_kind)                                                      \
+  {                                                                                                                    \
+    .type = {.actual_size = sizeof(pbl_type), .usable_size = pbl_type##_Size, .type_template = NULL,                   \
+             .name = (type_name), .user_defined = false, .definable = true},                                           \
+    .kind = (serial_kind), .fields = NULL, .fields_len = 0                                                             \
+  }
+
+const PblSerialType_T PBL_SERIAL_TYPE_BOOL = PBL_SERIAL_BUILTIN_TYPE(PblBool_T, "bool", PBL_SERIAL_BOOL);
+const PblSerialType_T PBL_SERIAL_TYPE_CHAR = PBL_SERIAL_BUILTIN_TYPE(PblChar_T, "char", PBL_SERIAL_CHAR);
+const PblSerialType_T PBL_SERIAL_TYPE_UCHAR = PBL_SERIAL_BUILTIN_TYPE(PblUChar_T, "uchar", PBL_SERIAL_UCHAR);
+const PblSerialType_T PBL_SERIAL_TYPE_SHORT = PBL_SERIAL_BUILTIN_TYPE(PblShort_T, "short", PBL_SERIAL_SHORT);
+const PblSerialType_T PBL_SERIAL_TYPE_USHORT = PBL_SERIAL_BUILTIN_TYPE(PblUShort_T, "ushort", PBL_SERIAL_USHORT);
+const PblSerialType_T PBL_SERIAL_TYPE_INT = PBL_SERIAL_BUILTIN_TYPE(PblInt_T, "int", PBL_SERIAL_INT);
+const PblSerialType_T PBL_SERIAL_TYPE_UINT = PBL_SERIAL_BUILTIN_TYPE(PblUInt_T, "uint", PBL_SERIAL_UINT);
+const PblSerialType_T PBL_SERIAL_TYPE_LONG = PBL_SERIAL_BUILTIN_TYPE(PblLong_T, "long", PBL_SERIAL_LONG);
+const PblSerialType_T PBL_SERIAL_TYPE_ULONG = PBL_SERIAL_BUILTIN_TYPE(PblULong_T, "ulong", PBL_SERIAL_ULONG);
+const PblSerialType_T PBL_SERIAL_TYPE_LONG_LONG =
+  PBL_SERIAL_BUILTIN_TYPE(PblLongLong_T, "longlong", PBL_SERIAL_LONG_LONG);
+const PblSerialType_T PBL_SERIAL_TYPE_ULONG_LONG =
+  PBL_SERIAL_BUILTIN_TYPE(PblULongLong_T, "ulonglong", PBL_SERIAL_ULONG_LONG);
+const PblSerialType_T PBL_SERIAL_TYPE_SIZE = PBL_SERIAL_BUILTIN_TYPE(PblSize_T, "size", PBL_SERIAL_SIZE);
+const PblSerialType_T PBL_SERIAL_TYPE_FLOAT = PBL_SERIAL_BUILTIN_TYPE(PblFloat_T, "float", PBL_SERIAL_FLOAT);
+const PblSerialType_T PBL_SERIAL_TYPE_DOUBLE = PBL_SERIAL_BUILTIN_TYPE(PblDouble_T, "double", PBL_SERIAL_DOUBLE);
+const PblSerialType_T PBL_SERIAL_TYPE_STRING = PBL_SERIAL_BUILTIN_TYPE(PblString_T, "string", PBL_SERIAL_STRING);
+const PblSerialType_T PBL_SERIAL_TYPE_STRING_VIEW =
+  PBL_SERIAL_BUILTIN_TYPE(PblStringView_T, "string_view", PBL_SERIAL_STRING_VIEW);
+const PblSerialType_T PBL_SERIAL_TYPE_ANY = PBL_SERIAL_BUILTIN_TYPE(PblAny_T, "any", PBL_SERIAL_ANY);
+
+/// @brief The amount of built-in types at the start of the registry
+#define PBL_SERIAL_BUILTIN_TYPES_LEN 17
+
+/// @brief The types 'PblAny_T' values can be decoded as, where new entries are published by incrementing the length
+static const PblSerialType_T *PBL_SERIAL_REGISTRY[PBL_SERIAL_MAX_REGISTERED_TYPES] = {
+  &PBL_SERIAL_TYPE_BOOL,   &PBL_SERIAL_TYPE_CHAR,      &PBL_SERIAL_TYPE_UCHAR,       &PBL_SERIAL_TYPE_SHORT,
+  &PBL_SERIAL_TYPE_USHORT, &PBL_SERIAL_TYPE_INT,       &PBL_SERIAL_TYPE_UINT,        &PBL_SERIAL_TYPE_LONG,
+  &PBL_SERIAL_TYPE_ULONG,  &PBL_SERIAL_TYPE_LONG_LONG, &PBL_SERIAL_TYPE_ULONG_LONG,  &PBL_SERIAL_TYPE_SIZE,
+  &PBL_SERIAL_TYPE_FLOAT,  &PBL_SERIAL_TYPE_DOUBLE,    &PBL_SERIAL_TYPE_STRING,      &PBL_SERIAL_TYPE_STRING_VIEW,
+  &PBL_SERIAL_TYPE_ANY};
+static _Atomic(size_t) PBL_SERIAL_REGISTRY_LEN = PBL_SERIAL_BUILTIN_TYPES_LEN;
+static pthread_mutex_t PBL_SERIAL_REGISTRY_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/// @brief Searches the registered type with the passed name
+static const PblSerialType_T *PblFindSerialTypeByName(const char *name, size_t name_len) {
+  size_t len = atomic_load_explicit(&PBL_SERIAL_REGISTRY_LEN, memory_order_acquire);
+  for (size_t i = 0; i < len; i++) {
+    const char *candidate = PBL_SERIAL_REGISTRY[i]->type.name;
+    if (strncmp(candidate, name, name_len) == 0 && candidate[name_len] == '\0') return PBL_SERIAL_REGISTRY[i];
+  }
+  return NULL;
+}
+
+/// @brief Searches the registered type of a 'PblAny_T' value, which is either the descriptor itself or a type with the
+/// same name
+static const PblSerialType_T *PblFindSerialTypeOfAny(const PblType_T *type) {
+  size_t len = atomic_load_explicit(&PBL_SERIAL_REGISTRY_LEN, memory_order_acquire);
+  for (size_t i = 0; i < len; i++) {
+    if (&PBL_SERIAL_REGISTRY[i]->type == type) return PBL_SERIAL_REGISTRY[i];
+  }
+  return type->name != NULL ? PblFindSerialTypeByName(type->name, strlen(type->name)) : NULL;
+}
+
+// ---- End of Built-in Types -----------------------------------------------------------------------------------------
+
+// ---- Encoding ------------------------------------------------------------------------------------------------------
+
+/// @brief The output of the encoder, which is either a stack buffer that is written onto a stream whenever it is full,
+/// or a growing heap buffer
+struct PblSerialWriter {
+  char *data;
+  size_t len;
+  size_t capacity;
+  /// @brief The stream the buffer is written to - NULL if the heap buffer is used
+  PblIOStream_T *stream;
+  /// @brief Whether writing onto the stream failed or the value can not be encoded
+  bool failed;
+};
+
+/// @brief Writes the buffered bytes onto the stream
+static void PblFlushSerialWriter(struct PblSerialWriter *writer) {
+  if (writer->len > 0 && PblStreamWrite(writer->stream, writer->data, writer->len) != writer->len) {
+    writer->failed = true;
+  }
+  writer->len = 0;
+}
+
+/// @brief Ensures there is space for 'len' more bytes in the buffer
+/// @return False if the bytes are larger than the stack buffer, meaning they have to be written directly
+static bool PblReserveSerialWriter(struct PblSerialWriter *writer, size_t len) {
+  if (writer->capacity - writer->len >= len) return true;
+  if (writer->stream != NULL) {
+    PblFlushSerialWriter(writer);
+    return len <= writer->capacity;
+  }
+
+  size_t capacity = writer->capacity * 2;
+  while (capacity - writer->len < len) capacity *= 2;
+  writer->data = PblRealloc(writer->data, capacity);
+  writer->capacity = capacity;
+  return true;
+}
+
+static void PblWriteSerialBytes(struct PblSerialWriter *writer, const void *src, size_t len) {
+  if (len == 0) return;
+  if (!PblReserveSerialWriter(writer, len)) {
+    if (PblStreamWrite(writer->stream, src, len) != len) writer->failed = true;
+    return;
+  }
+  memcpy(writer->data + writer->len, src, len);
+  writer->len += len;
+}
+
+static void PblWriteSerialVarint(struct PblSerialWriter *writer, uint64_t val) {
+  PblReserveSerialWriter(writer, PBL_SERIAL_MAX_VARINT_LEN);
+  unsigned char *out = (unsigned char *) writer->data + writer->len;
+  size_t len = 0;
+  while (val >= 0x80) {
+    out[len++] = (unsigned char) (val | 0x80);
+    val >>= 7;
+  }
+  out[len++] = (unsigned char) val;
+  writer->len += len;
+}
+
+/// @brief Writes the signed integer as zigzag-encoded varint, so small negative values stay small
+static inline void PblWriteSerialSigned(struct PblSerialWriter *writer, int64_t val) {
+  PblWriteSerialVarint(writer, ((uint64_t) val << 1) ^ (uint64_t) (val >> 63));
+}
+
+/// @brief Writes the value in little-endian byte order
+static void PblWriteSerialFixed(struct PblSerialWriter *writer, uint64_t val, size_t len) {
+  unsigned char bytes[8];
+  for (size_t i = 0; i < len; i++) bytes[i] = (unsigned char) (val >> (8 * i));
+  PblWriteSerialBytes(writer, bytes, len);
+}
+
+static void PblEncodeSerialValue(struct PblSerialWriter *writer, const PblSerialType_T *type, const void *value,
+                                 size_t depth) {
+  if (writer->failed) return;
+  if (depth > PBL_SERIAL_MAX_DEPTH) {
+    writer->failed = true;
+    return;
+  }
+
+  switch (type->kind) {
+    case PBL_SERIAL_BOOL:
+      PblWriteSerialBytes(writer, ((const PblBool_T *) value)->actual ? "\1" : "\0", 1);
+      break;
+    case PBL_SERIAL_CHAR:
+      PblWriteSerialSigned(writer, ((const PblChar_T *) value)->actual);
+      break;
+    case PBL_SERIAL_UCHAR:
+      PblWriteSerialVarint(writer, ((const PblUChar_T *) value)->actual);
+      break;
+    case PBL_SERIAL_SHORT:
+      PblWriteSerialSigned(writer, ((const PblShort_T *) value)->actual);
+      break;
+    case PBL_SERIAL_USHORT:
+      PblWriteSerialVarint(writer, ((const PblUShort_T *) value)->actual);
+      break;
+    case PBL_SERIAL_INT:
+      PblWriteSerialSigned(writer, ((const PblInt_T *) value)->actual);
+      break;
+    case PBL_SERIAL_UINT:
+      PblWriteSerialVarint(writer, ((const PblUInt_T *) value)->actual);
+      break;
+    case PBL_SERIAL_LONG:
+      PblWriteSerialSigned(writer, ((const PblLong_T *) value)->actual);
+      break;
+    case PBL_SERIAL_ULONG:
+      PblWriteSerialVarint(writer, ((const PblULong_T *) value)->actual);
+      break;
+    case PBL_SERIAL_LONG_LONG:
+      PblWriteSerialSigned(writer, ((const PblLongLong_T *) value)->actual);
+      break;
+    case PBL_SERIAL_ULONG_LONG:
+      PblWriteSerialVarint(writer, ((const PblULongLong_T *) value)->actual);
+      break;
+    case PBL_SERIAL_SIZE:
+      PblWriteSerialVarint(writer, ((const PblSize_T *) value)->actual);
+      break;
+    case PBL_SERIAL_FLOAT: {
+      uint32_t bits;
+      memcpy(&bits, &((const PblFloat_T *) value)->actual, sizeof(bits));
+      PblWriteSerialFixed(writer, bits, sizeof(bits));
+      break;
+    }
+    case PBL_SERIAL_DOUBLE: {
+      uint64_t bits;
+      memcpy(&bits, &((const PblDouble_T *) value)->actual, sizeof(bits));
+      PblWriteSerialFixed(writer, bits, sizeof(bits));
+      break;
+    }
+    case PBL_SERIAL_STRING: {
+      PblString_T *str = (PblString_T *) value;
+      size_t len = str->actual.len->actual;
+      PblWriteSerialVarint(writer, len);
+      PblWriteSerialBytes(writer, PblGetStringBytes(str), len);
+      break;
+    }
+    case PBL_SERIAL_STRING_VIEW: {
+      const PblStringView_T *view = value;
+      PblWriteSerialVarint(writer, view->actual.len);
+      PblWriteSerialBytes(writer, view->actual.ptr, view->actual.len);
+      break;
+    }
+    case PBL_SERIAL_ANY: {
+      const PblAny_T *any = value;
+      if (any->actual.val == NULL || any->actual.type == NULL) {
+        PblWriteSerialVarint(writer, 0);
+        break;
+      }
+      const PblSerialType_T *val_type = PblFindSerialTypeOfAny(any->actual.type);
+      if (val_type == NULL) {
+        writer->failed = true;
+        break;
+      }
+      size_t name_len = strlen(val_type->type.name);
+      PblWriteSerialVarint(writer, name_len);
+      PblWriteSerialBytes(writer, val_type->type.name, name_len);
+      PblEncodeSerialValue(writer, val_type, any->actual.val, depth + 1);
+      break;
+    }
+    case PBL_SERIAL_STRUCT:
+      for (size_t i = 0; i < type->fields_len; i++) {
+        const PblSerialField_T *field = &type->fields[i];
+        const void *child = *(const void *const *) ((const char *) value + field->offset);
+        if (child == NULL) continue;
+        PblWriteSerialVarint(writer, i + 1);
+        PblEncodeSerialValue(writer, field->type, child, depth + 1);
+      }
+      PblWriteSerialVarint(writer, 0);
+      break;
+  }
+}
+
+// ---- End of Encoding -----------------------------------------------------------------------------------------------
+
+// ---- Decoding ------------------------------------------------------------------------------------------------------
+
+/// @brief The input of the decoder, which is either a byte buffer or a stream that is read on demand
+struct PblSerialReader {
+  const char *data;
+  size_t len;
+  size_t pos;
+  /// @brief The stream that is read from - NULL if the byte buffer is used
+  PblIOStream_T *stream;
+  /// @brief The arena the decoded values are allocated in - NULL if the garbage collector is used
+  PblArena_T *arena;
+  enum PblSerialError error;
+};
+
+/// @brief Records the first error and returns NULL for the decoded value
+static void *PblFailSerialReader(struct PblSerialReader *reader, enum PblSerialError error) {
+  if (reader->error == PBL_SERIAL_OK) reader->error = error;
+  return NULL;
+}
+
+/// @brief Allocates zeroed memory for a decoded value, which may contain references
+static inline void *PblAllocSerialValue(struct PblSerialReader *reader, size_t size) {
+  return reader->arena != NULL ? PblArenaAlloc(reader->arena, size) : PblMalloc(size);
+}
+
+/// @brief Allocates memory for decoded bytes, which never contain references
+static inline char *PblAllocSerialBytes(struct PblSerialReader *reader, size_t size) {
+  return reader->arena != NULL ? PblArenaAlloc(reader->arena, size) : PblMallocAtomic(size);
+}
+
+static bool PblReadSerialBytes(struct PblSerialReader *reader, void *dst, size_t len) {
+  if (len == 0) return true;
+  if (reader->stream != NULL) {
+    if (PblStreamRead(reader->stream, dst, len) == len) return true;
+  } else if (reader->len - reader->pos >= len) {
+    memcpy(dst, reader->data + reader->pos, len);
+    reader->pos += len;
+    return true;
+  }
+  PblFailSerialReader(reader, PBL_SERIAL_ERR_TRUNCATED);
+  return false;
+}
+
+static bool PblReadSerialVarint(struct PblSerialReader *reader, uint64_t *out) {
+  uint64_t val = 0;
+  for (unsigned int i = 0; i < PBL_SERIAL_MAX_VARINT_LEN; i++) {
+    unsigned char byte;
+    if (reader->stream == NULL && reader->pos < reader->len) {
+      byte = (unsigned char) reader->data[reader->pos++];
+    } else if (!PblReadSerialBytes(reader, &byte, 1)) {
+      return false;
+    }
+
+    // The last byte of a 64-bit varint may only contain a single bit
+    if (i == PBL_SERIAL_MAX_VARINT_LEN - 1 && byte > 1) break;
+    val |= (uint64_t) (byte & 0x7f) << (7 * i);
+    if (byte < 0x80) {
+      *out = val;
+      return true;
+    }
+  }
+  PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+  return false;
+}
+
+static bool PblReadSerialSigned(struct PblSerialReader *reader, int64_t *out) {
+  uint64_t val;
+  if (!PblReadSerialVarint(reader, &val)) return false;
+  *out = (int64_t) (val >> 1) ^ -(int64_t) (val & 1);
+  return true;
+}
+
+static bool PblReadSerialFixed(struct PblSerialReader *reader, uint64_t *out, size_t len) {
+  unsigned char bytes[8];
+  if (!PblReadSerialBytes(reader, bytes, len)) return false;
+  uint64_t val = 0;
+  for (size_t i = 0; i < len; i++) val |= (uint64_t) bytes[i] << (8 * i);
+  *out = val;
+  return true;
+}
+
+/// @brief Reads a length prefix, which is rejected if it is obviously larger than the remaining input
+static bool PblReadSerialLength(struct PblSerialReader *reader, size_t *out) {
+  uint64_t len;
+  if (!PblReadSerialVarint(reader, &len)) return false;
+  // The length plus the null-terminator still has to fit into the 'unsigned int' lengths of a string
+  if (len >= UINT_MAX) {
+    PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+    return false;
+  }
+  if (reader->stream == NULL && len > reader->len - reader->pos) {
+    PblFailSerialReader(reader, PBL_SERIAL_ERR_TRUNCATED);
+    return false;
+  }
+  *out = (size_t) len;
+  return true;
+}
+
+/// @brief Reads 'len' bytes into newly allocated and null-terminated memory, or returns NULL if the input is truncated
+/// @note Streams are read in chunks, so that the buffer only grows as bytes arrive and a forged length prefix can not
+/// allocate more memory than the stream actually contains
+static char *PblReadSerialLengthBytes(struct PblSerialReader *reader, size_t len) {
+  if (reader->stream == NULL || len <= PBL_SERIAL_STREAM_CHUNK_SIZE) {
+    char *bytes = PblAllocSerialBytes(reader, len + 1);
+    if (!PblReadSerialBytes(reader, bytes, len)) return NULL;
+    bytes[len] = '\0';
+    return bytes;
+  }
+
+  size_t allocated = PBL_SERIAL_STREAM_CHUNK_SIZE;
+  size_t read = 0;
+  char *buffer = PblMallocAtomic(allocated);
+  while (read < len) {
+    if (read == allocated) {
+      allocated = allocated > len / 2 ? len : allocated * 2;
+      buffer = PblRealloc(buffer, allocated);
+    }
+    size_t chunk = allocated - read < len - read ? allocated - read : len - read;
+    if (!PblReadSerialBytes(reader, buffer + read, chunk)) {
+      PblFree(buffer);
+      return NULL;
+    }
+    read += chunk;
+  }
+
+  char *bytes;
+  if (reader->arena != NULL) {
+    bytes = PblArenaAlloc(reader->arena, len + 1);
+    memcpy(bytes, buffer, len);
+    PblFree(buffer);
+  } else {
+    bytes = PblRealloc(buffer, len + 1);
+  }
+  bytes[len] = '\0';
+  return bytes;
+}
+
+/// @brief Allocates a decoded value of the passed Pbl type, which is a numeric type with a single '.actual' value
+#define PBL_SERIAL_DECODED_VALUE(pbl_type, c_val)                                                                      \
+  ({                                                                                                                   \
+    pbl_type *pbl_decoded = PblAllocSerialValue(reader, sizeof(pbl_type));                                             \
+    *pbl_decoded = pbl_type##_DefDefault;                                                                              \
+    pbl_decoded->actual = (c_val);                                                                                     \
+    pbl_decoded->meta.type = (PblType_T *) &type->type;                                                                \
+    (void *) pbl_decoded;                                                                                              \
+  })
+
+/// @brief Decodes a signed integer, which is rejected if it is out of the range of the C type
+#define PBL_SERIAL_DECODE_SIGNED(pbl_type, c_type, min, max)                                                           \
+  {                                                                                                                    \
+    int64_t val;                                                                                                       \
+    if (!PblReadSerialSigned(reader, &val)) return NULL;                                                               \
+    if (val < (min) || val > (max)) return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);                        \
+    return PBL_SERIAL_DECODED_VALUE(pbl_type, (c_type) val);                                                           \
+  }
+
+/// @brief Decodes an unsigned integer, which is rejected if it is out of the range of the C type
+#define PBL_SERIAL_DECODE_UNSIGNED(pbl_type, c_type, max)                                                              \
+  {                                                                                                                    \
+    uint64_t val;                                                                                                      \
+    if (!PblReadSerialVarint(reader, &val)) return NULL;                                                               \
+    if (val > (max)) return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);                                       \
+    return PBL_SERIAL_DECODED_VALUE(pbl_type, (c_type) val);                                                           \
+  }
+
+static void *PblDecodeSerialValue(struct PblSerialReader *reader, const PblSerialType_T *type, size_t depth);
+
+/// @brief Decodes a string, whose content is copied into both 'str' and 'c_str'
+static void *PblDecodeSerialString(struct PblSerialReader *reader, const PblSerialType_T *type) {
+  size_t len;
+  if (!PblReadSerialLength(reader, &len)) return NULL;
+  char *bytes = PblReadSerialLengthBytes(reader, len);
+  if (bytes == NULL) return NULL;
+
+  PblString_T *str = PblAllocSerialValue(reader, sizeof(PblString_T));
+  *str = PblString_T_DefDefault;
+  str->meta.type = (PblType_T *) &type->type;
+  str->actual.len = PblAllocSerialValue(reader, sizeof(PblUInt_T));
+  *str->actual.len = PblUInt_T_DefDefault;
+  str->actual.len->actual = (unsigned int) len;
+  str->actual.allocated_len = PblAllocSerialValue(reader, sizeof(PblUInt_T));
+  *str->actual.allocated_len = PblUInt_T_DefDefault;
+  str->actual.allocated_len->actual = (unsigned int) len + 1;
+  str->actual.str = PblAllocSerialValue(reader, (len + 1) * sizeof(PblChar_T));
+  for (size_t i = 0; i <= len; i++) {
+    PBL_ASSIGN_TO_VAR(str->actual.str[i], PblChar_T, (signed char) bytes[i]);
+  }
+  str->actual.c_str = bytes;
+  return str;
+}
+
+/// @brief Decodes a string view, which points directly into the input if it is a byte buffer
+static void *PblDecodeSerialStringView(struct PblSerialReader *reader, const PblSerialType_T *type) {
+  size_t len;
+  if (!PblReadSerialLength(reader, &len)) return NULL;
+
+  const char *ptr;
+  if (reader->stream == NULL) {
+    ptr = reader->data + reader->pos;
+    reader->pos += len;
+  } else {
+    char *bytes = PblReadSerialLengthBytes(reader, len);
+    if (bytes == NULL) return NULL;
+    ptr = bytes;
+  }
+
+  PblStringView_T *view = PblAllocSerialValue(reader, sizeof(PblStringView_T));
+  *view = PblStringView_T_DefDefault;
+  view->meta.type = (PblType_T *) &type->type;
+  view->actual.ptr = ptr;
+  view->actual.len = len;
+  return view;
+}
+
+static void *PblDecodeSerialAny(struct PblSerialReader *reader, const PblSerialType_T *type, size_t depth) {
+  size_t name_len;
+  if (!PblReadSerialLength(reader, &name_len)) return NULL;
+
+  PblAny_T *any = PblAllocSerialValue(reader, sizeof(PblAny_T));
+  *any = PblAny_T_DefDefault;
+  any->meta.type = (PblType_T *) &type->type;
+  if (name_len == 0) return any;
+
+  char name[256];
+  if (name_len >= sizeof(name)) return PblFailSerialReader(reader, PBL_SERIAL_ERR_UNKNOWN_TYPE);
+  if (!PblReadSerialBytes(reader, name, name_len)) return NULL;
+  const PblSerialType_T *val_type = PblFindSerialTypeByName(name, name_len);
+  if (val_type == NULL) return PblFailSerialReader(reader, PBL_SERIAL_ERR_UNKNOWN_TYPE);
+
+  any->actual.val = PblDecodeSerialValue(reader, val_type, depth + 1);
+  if (any->actual.val == NULL) return NULL;
+  any->actual.type = (PblType_T *) &val_type->type;
+  any->actual.byte_size = PBL_SERIAL_DECODED_VALUE(PblSize_T, val_type->type.actual_size);
+  any->actual.byte_size->meta.type = (PblType_T *) &PBL_SERIAL_TYPE_SIZE.type;
+  return any;
+}
+
+static void *PblDecodeSerialStruct(struct PblSerialReader *reader, const PblSerialType_T *type, size_t depth) {
+  PblVarMetaData_T *value = PblAllocSerialValue(reader, type->type.actual_size);
+  value->defined = true;
+  value->type = (PblType_T *) &type->type;
+
+  while (true) {
+    uint64_t number;
+    if (!PblReadSerialVarint(reader, &number)) return NULL;
+    if (number == 0) return value;
+    if (number > type->fields_len) return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+
+    const PblSerialField_T *field = &type->fields[number - 1];
+    void *child = PblDecodeSerialValue(reader, field->type, depth + 1);
+    if (child == NULL) return NULL;
+    *(void **) ((char *) value + field->offset) = child;
+  }
+}
+
+static void *PblDecodeSerialValue(struct PblSerialReader *reader, const PblSerialType_T *type, size_t depth) {
+  if (depth > PBL_SERIAL_MAX_DEPTH) return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+
+  switch (type->kind) {
+    case PBL_SERIAL_BOOL: {
+      unsigned char byte;
+      if (!PblReadSerialBytes(reader, &byte, 1)) return NULL;
+      if (byte > 1) return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+      return PBL_SERIAL_DECODED_VALUE(PblBool_T, byte == 1);
+    }
+    case PBL_SERIAL_CHAR:
+      PBL_SERIAL_DECODE_SIGNED(PblChar_T, signed char, SCHAR_MIN, SCHAR_MAX)
+    case PBL_SERIAL_UCHAR:
+      PBL_SERIAL_DECODE_UNSIGNED(PblUChar_T, unsigned char, UCHAR_MAX)
+    case PBL_SERIAL_SHORT:
+      PBL_SERIAL_DECODE_SIGNED(PblShort_T, signed short, SHRT_MIN, SHRT_MAX)
+    case PBL_SERIAL_USHORT:
+      PBL_SERIAL_DECODE_UNSIGNED(PblUShort_T, unsigned short, USHRT_MAX)
+    case PBL_SERIAL_INT:
+      PBL_SERIAL_DECODE_SIGNED(PblInt_T, signed int, INT_MIN, INT_MAX)
+    case PBL_SERIAL_UINT:
+      PBL_SERIAL_DECODE_UNSIGNED(PblUInt_T, unsigned int, UINT_MAX)
+    case PBL_SERIAL_LONG:
+      PBL_SERIAL_DECODE_SIGNED(PblLong_T, signed long, LONG_MIN, LONG_MAX)
+    case PBL_SERIAL_ULONG:
+      PBL_SERIAL_DECODE_UNSIGNED(PblULong_T, unsigned long, ULONG_MAX)
+    case PBL_SERIAL_LONG_LONG:
+      PBL_SERIAL_DECODE_SIGNED(PblLongLong_T, signed long long, LLONG_MIN, LLONG_MAX)
+    case PBL_SERIAL_ULONG_LONG:
+      PBL_SERIAL_DECODE_UNSIGNED(PblULongLong_T, unsigned long long, ULLONG_MAX)
+    case PBL_SERIAL_SIZE:
+      PBL_SERIAL_DECODE_UNSIGNED(PblSize_T, size_t, SIZE_MAX)
+    case PBL_SERIAL_FLOAT: {
+      uint64_t bits;
+      if (!PblReadSerialFixed(reader, &bits, sizeof(float))) return NULL;
+      uint32_t narrow = (uint32_t) bits;
+      float val;
+      memcpy(&val, &narrow, sizeof(val));
+      return PBL_SERIAL_DECODED_VALUE(PblFloat_T, val);
+    }
+    case PBL_SERIAL_DOUBLE: {
+      uint64_t bits;
+      if (!PblReadSerialFixed(reader, &bits, sizeof(double))) return NULL;
+      double val;
+      memcpy(&val, &bits, sizeof(val));
+      return PBL_SERIAL_DECODED_VALUE(PblDouble_T, val);
+    }
+    case PBL_SERIAL_STRING:
+      return PblDecodeSerialString(reader, type);
+    case PBL_SERIAL_STRING_VIEW:
+      return PblDecodeSerialStringView(reader, type);
+    case PBL_SERIAL_ANY:
+      return PblDecodeSerialAny(reader, type, depth);
+    case PBL_SERIAL_STRUCT:
+      return PblDecodeSerialStruct(reader, type, depth);
+  }
+  return PblFailSerialReader(reader, PBL_SERIAL_ERR_INVALID);
+}
+
+// ---- End of Decoding -----------------------------------------------------------------------------------------------
+
+// ---- Functions Implementation --------------------------------------------------------------------------------------
+
+bool PblSerialRegisterType(const PblSerialType_T *type) {
+  // Validate the pointer for safety measures
+  type = PblValPtr((void *) type);
+
+  pthread_mutex_lock(&PBL_SERIAL_REGISTRY_LOCK);
+  const PblSerialType_T *existing = PblFindSerialTypeByName(type->type.name, strlen(type->type.name));
+  bool success = existing == type;
+  size_t len = atomic_load_explicit(&PBL_SERIAL_REGISTRY_LEN, memory_order_relaxed);
+  if (existing == NULL && len < PBL_SERIAL_MAX_REGISTERED_TYPES) {
+    PBL_SERIAL_REGISTRY[len] = type;
+    atomic_store_explicit(&PBL_SERIAL_REGISTRY_LEN, len + 1, memory_order_release);
+    success = true;
+  }
+  pthread_mutex_unlock(&PBL_SERIAL_REGISTRY_LOCK);
+  return success;
+}
+
+bool PblSerialize(PblIOStream_T *stream, const PblSerialType_T *type, const void *value) {
+  // Validate the pointer for safety measures
+  stream = PblValPtr((void *) stream);
+  type = PblValPtr((void *) type);
+  value = PblValPtr((void *) value);
+
+  char buffer[PBL_SERIAL_WRITE_BUFFER_SIZE];
+  struct PblSerialWriter writer = {
+    .data = buffer, .len = 0, .capacity = sizeof(buffer), .stream = stream, .failed = false};
+  PblEncodeSerialValue(&writer, type, value, 0);
+  if (!writer.failed) PblFlushSerialWriter(&writer);
+  return !writer.failed;
+}
+
+char *PblSerializeToBytes(const PblSerialType_T *type, const void *value, size_t *len) {
+  // Validate the pointer for safety measures
+  type = PblValPtr((void *) type);
+  value = PblValPtr((void *) value);
+  len = PblValPtr((void *) len);
+
+  struct PblSerialWriter writer = {.data = PblMallocAtomic(PBL_SERIAL_INITIAL_BYTES_SIZE),
+                                   .len = 0,
+                                   .capacity = PBL_SERIAL_INITIAL_BYTES_SIZE,
+                                   .stream = NULL,
+                                   .failed = false};
+  PblEncodeSerialValue(&writer, type, value, 0);
+  if (writer.failed) {
+    PblFree(writer.data);
+    *len = 0;
+    return NULL;
+  }
+  *len = writer.len;
+  return writer.data;
+}
+
+__attribute__((unused)) void *PblDeserialize_Overhead(struct PblDeserialize_Args in) {
+  // Validate the pointer for safety measures
+  PblIOStream_T *stream = PBL_VAL_REQ_ARG(in.stream);
+  const PblSerialType_T *type = PBL_VAL_REQ_ARG(in.type);
+
+  struct PblSerialReader reader = {.stream = stream, .arena = in.arena, .error = PBL_SERIAL_OK};
+  void *value = PblDecodeSerialValue(&reader, type, 0);
+  if (in.error != NULL) *in.error = reader.error;
+  return value;
+}
+
+__attribute__((unused)) void *PblDeserializeBytes_Overhead(struct PblDeserializeBytes_Args in) {
+  // Validate the pointer for safety measures
+  const void *data = PBL_VAL_REQ_ARG(in.data);
+  const PblSerialType_T *type = PBL_VAL_REQ_ARG(in.type);
+
+  struct PblSerialReader reader = {
+    .data = data, .len = in.len, .pos = 0, .stream = NULL, .arena = in.arena, .error = PBL_SERIAL_OK};
+  void *value = PblDecodeSerialValue(&reader, type, 0);
+  if (in.consumed != NULL) *in.consumed = value != NULL ? reader.pos : 0;
+  if (in.error != NULL) *in.error = reader.error;
+  return value;
+}
+
+// ---- End of Functions Implementation -------------------------------------------------------------------------------
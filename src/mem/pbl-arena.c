@@ -0,0 +1,128 @@
+/// @file pbl-arena.c
+/// @brief Arena allocator, which hands out memory from large blocks using a bump pointer and releases all of it at once
+/// @author Luna-Klatzer
+/// @date 2026-10-19
+/// @copyright Copyright (c) 2021
+
+// Parent Header for this file
+#include <libpbl/mem/pbl-arena.h>
+
+// ---- Arena Blocks --------------------------------------------------------------------------------------------------
+
+struct PblArenaBlock {
+  /// @brief The next (older) block of the arena
+  struct PblArenaBlock *next;
+  /// @brief The size of 'data' in bytes
+  size_t capacity;
+  /// @brief The amount of bytes of 'data' that were handed out
+  size_t used;
+  /// @brief The memory of the block
+  _Alignas(PBL_ARENA_ALIGNMENT) char data[];
+};
+
+/// @brief Rounds the size up to the alignment of the arena
+static inline size_t PblAlignArenaSize(size_t size) {
+  return (size + PBL_ARENA_ALIGNMENT - 1) & ~((size_t) PBL_ARENA_ALIGNMENT - 1);
+}
+
+/// @brief Allocates a new block and links it into the arena. Blocks for large allocations are linked behind the
+/// current block, so the remaining space of the current block is not wasted
+static struct PblArenaBlock *PblAddArenaBlock(PblArena_T *arena, size_t capacity, bool make_current) {
+  // Allocated using the garbage collector, so the references stored in the arena are scanned
+  struct PblArenaBlock *block = PblMalloc(sizeof(struct PblArenaBlock) + capacity);
+  block->capacity = capacity;
+  block->used = 0;
+
+  struct PblArenaBlock *current = arena->actual.blocks;
+  if (make_current || current == NULL) {
+    block->next = current;
+    arena->actual.blocks = block;
+  } else {
+    block->next = current->next;
+    current->next = block;
+  }
+  return block;
+}
+
+// ---- End of Arena Blocks -------------------------------------------------------------------------------------------
+
+// ---- Functions Implementation --------------------------------------------------------------------------------------
+
+PblArena_T *PblArenaCreate_Base(size_t block_size) {
+  PBL_DEFINE_VAR(arena, PblArena_T);
+  arena->actual.block_size = PblAlignArenaSize(block_size);
+  return arena;
+}
+
+__attribute__((unused)) PblArena_T *PblArenaCreate_Overhead(struct PblArenaCreate_Args in) {
+  return PblArenaCreate_Base(in.block_size != 0 ? in.block_size : PBL_ARENA_DEFAULT_BLOCK_SIZE);
+}
+
+void *PblArenaAlloc(PblArena_T *arena, size_t size) {
+  // Validate the pointer for safety measures
+  arena = PblValPtr((void *) arena);
+
+  size = PblAlignArenaSize(size != 0 ? size : 1);
+  arena->actual.allocated += size;
+
+  struct PblArenaBlock *block = arena->actual.blocks;
+  if (block == NULL || block->capacity - block->used < size) {
+    // Allocations larger than a quarter of a block get a block of their own
+    if (size > arena->actual.block_size / 4) {
+      block = PblAddArenaBlock(arena, size, false);
+    } else {
+      block = PblAddArenaBlock(arena, arena->actual.block_size, true);
+    }
+  }
+
+  void *ptr = block->data + block->used;
+  block->used += size;
+  return ptr;
+}
+
+char *PblArenaCopyBytes(PblArena_T *arena, const void *src, size_t len) {
+  char *copy = PblArenaAlloc(arena, len + 1);
+  if (len > 0) memcpy(copy, PblValPtr((void *) src), len);
+  return copy;
+}
+
+void PblArenaReset(PblArena_T *arena) {
+  // Validate the pointer for safety measures
+  arena = PblValPtr((void *) arena);
+
+  // Keeping the most recent regular block, as it is the one that would be allocated again right away
+  struct PblArenaBlock *keep = arena->actual.blocks;
+  while (keep != NULL && keep->capacity != arena->actual.block_size) keep = keep->next;
+
+  struct PblArenaBlock *block = arena->actual.blocks;
+  while (block != NULL) {
+    struct PblArenaBlock *next = block->next;
+    if (block != keep) PblFree(block);
+    block = next;
+  }
+
+  if (keep != NULL) {
+    // The memory is handed out zeroed, which the garbage collector only guarantees for new allocations
+    memset(keep->data, 0, keep->used);
+    keep->used = 0;
+    keep->next = NULL;
+  }
+  arena->actual.blocks = keep;
+  arena->actual.allocated = 0;
+}
+
+void PblArenaDestroy(PblArena_T *arena) {
+  // Validate the pointer for safety measures
+  arena = PblValPtr((void *) arena);
+
+  struct PblArenaBlock *block = arena->actual.blocks;
+  while (block != NULL) {
+    struct PblArenaBlock *next = block->next;
+    PblFree(block);
+    block = next;
+  }
+  *arena = PblArena_T_DeclDefault;
+  PblFree(arena);
+}
+
+// ---- End of Functions Implementation -------------------------------------------------------------------------------
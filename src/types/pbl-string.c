@@ -13,6 +13,9 @@
 #include <libpbl/types/pbl-types.h>
 #include <libpbl/mem/pbl-mem.h>
 
+// Atomics for the lock-free reads of the intern table
+#include <stdatomic.h>
+
 // ---- Functions Definitions -----------------------------------------------------------------------------------------
 
 PblUInt_T *PblGetLengthOfCString(const char *content) {
@@ -34,7 +37,8 @@ char *PblGetCCharArrayFromCharT(PblChar_T *char_arr, PblUInt_T *len) {
   char_arr = PblValPtr((void *) char_arr);
   len = PblValPtr((void *) len);
 
-  char *ret_arr = (char *) PblMalloc(sizeof(char) * len->actual);
+  // Allocating one more byte for the null char
+  char *ret_arr = (char *) PblMalloc(sizeof(char) * (len->actual + 1));
 
   for (int i = 0; i < len->actual; i++) {
     PblMemCpy(&(ret_arr[i]), &(char_arr[i].actual), sizeof(char));
@@ -48,11 +52,10 @@ char *PblGetCCharArrayFromString(PblString_T *str) {
   // Validate the pointer for safety measures
   str = PblValPtr((void *) str);
 
-  char *ret_arr = (char *) PblMalloc(sizeof(char) * str->actual.len->actual);
-
-  for (int i = 0; i < str->actual.len->actual; i++) {
-    PblMemCpy(&(ret_arr[i]), &(str->actual.str[i].actual), sizeof(char));
-  }
+  // Copying the contiguous byte copy including its null char in one go
+  unsigned int len = str->actual.len->actual;
+  char *ret_arr = (char *) PblMallocAtomic(sizeof(char) * (len + 1));
+  memcpy(ret_arr, PblGetStringBytes(str), len + 1);
   return ret_arr;
 }
 
@@ -72,29 +75,179 @@ PblChar_T *PblGetCharTArray(const char *content) {
   return pbl_chars;
 }
 
+/// @brief Aborts if the passed string is interned, as interned strings are shared and therefore immutable
+static inline void PblAssertStringIsMutable(PblString_T *str) {
+  if (str->actual.interned) {
+    PblAbortWithCriticalError(1, "Para: Attempted to write to an immutable interned string");
+  }
+}
+
+/// @brief Allocates a new string that is able to hold exactly 'len' bytes of content, of which only the null char is
+/// written. The content must be filled afterwards using 'PblCopyBytesIntoString'
+static PblString_T *PblAllocateStringOfLen(size_t len) {
+  PBL_DEFINE_VAR(str, PblString_T);
+
+  PblUInt_T *len_t = PblGetUIntT((unsigned int) len);
+  str->actual.allocated_len = PblGetMinimumArrayLen(len_t);
+  str->actual.len = len_t;
+  str->actual.str = PblAllocateStringContentT(len_t);
+  str->actual.c_str = PblMallocAtomic(str->actual.allocated_len->actual * sizeof(char));
+
+  // Adding null character
+  PBL_ASSIGN_TO_VAR(str->actual.str[len], PblChar_T, '\0');
+  str->actual.c_str[len] = '\0';
+  return str;
+}
+
+/// @brief Copies the passed bytes into both 'str' and 'c_str' of the string starting at the passed offset. This avoids
+/// creating a temporary PblChar_T array, which 'PblWriteCharArrayToStringT' requires
+/// @note The string must have enough space - this does not resize or change the length, but resets the cached hash and
+/// encoding
+static void PblCopyBytesIntoString(PblString_T *str, size_t offset, const char *bytes, size_t len) {
+  if (len == 0) return;
+
+  memcpy(str->actual.c_str + offset, bytes, len);
+  for (size_t i = 0; i < len; i++) {
+    PBL_ASSIGN_TO_VAR(str->actual.str[offset + i], PblChar_T, (signed char) bytes[i]);
+  }
+  str->actual.hash_cached = false;
+  str->actual.utf8_state = PBL_STRING_UTF8_UNKNOWN;
+}
+
 PblString_T *PblGetStringT(const char *content) {
   // Validate the pointer for safety measures
   content = PblValPtr((void *) content);
 
-  // Converting the char array into the corresponding PblChar_T type
-  PblUInt_T *len = PblGetLengthOfCString(content);
+  // Copying the bytes directly, which avoids converting the content into a temporary PblChar_T array first
+  size_t len = strlen(content);
+  PblString_T *str = PblAllocateStringOfLen(len);
+  PblCopyBytesIntoString(str, 0, content, len);
+  return str;
+}
+
+/// @brief Writes the PblChar_T content of the string into its byte copy 'c_str', and allocates it if it does not exist
+/// yet (e.g. the string was assembled manually)
+static void PblSyncStringBytes(PblString_T *str) {
+  if (str->actual.c_str == NULL)
+    str->actual.c_str = PblMallocAtomic(str->actual.allocated_len->actual * sizeof(char));
+
+  unsigned int len = str->actual.len->actual;
+  for (unsigned int i = 0; i < len; i++) str->actual.c_str[i] = (char) str->actual.str[i].actual;
+  str->actual.c_str[len] = '\0';
+}
 
-  return PblCreateStringT(PblGetCharTArray(content), len);
+PblVoid_T PblStringContentChanged(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  PblAssertStringIsMutable(str);
+  PblSyncStringBytes(str);
+  // The content changed, meaning the hash and the encoding have to be re-calculated
+  str->actual.hash_cached = false;
+  str->actual.utf8_state = PBL_STRING_UTF8_UNKNOWN;
+  return PblVoid_T_DeclDefault;
+}
+
+const char *PblGetStringBytes(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  if (str->actual.c_str == NULL) PblSyncStringBytes(str);
+  return str->actual.c_str;
 }
 
 PblBool_T *PblCompareStringT(PblString_T *str_1, PblString_T *str_2) {
+  return PblGetBoolT(PblStringEquals(str_1, str_2));
+}
+
+bool PblStringEquals(PblString_T *str_1, PblString_T *str_2) {
   // Validate the pointer for safety measures
   str_1 = PblValPtr((void *) str_1);
   str_2 = PblValPtr((void *) str_2);
 
-  // Don't bother with comparison if the lengths are the same
-  if (str_1->actual.len->actual != str_2->actual.len->actual)
-    return PblGetBoolT(false);
-  for (int i = 0; i < str_1->actual.len->actual; i++) {
-    if (str_1->actual.str[i].actual != str_2->actual.str[i].actual)
-      return PblGetBoolT(false);
+  if (str_1 == str_2) return true;
+  // Interned strings are canonical, meaning two different interned instances can never be equal
+  if (str_1->actual.interned && str_2->actual.interned) return false;
+
+  // Don't bother with comparison if the lengths are not the same
+  unsigned int len = str_1->actual.len->actual;
+  if (len != str_2->actual.len->actual) return false;
+
+  // Differing hashes guarantee differing content - only use them though if they are already available
+  if (str_1->actual.hash_cached && str_2->actual.hash_cached && str_1->actual.hash != str_2->actual.hash)
+    return false;
+
+  // memcmp is vectorised by the C library, which is by far faster than comparing char by char
+  return memcmp(PblGetStringBytes(str_1), PblGetStringBytes(str_2), len) == 0;
+}
+
+int PblStringCompareOrder(PblString_T *str_1, PblString_T *str_2) {
+  // Validate the pointer for safety measures
+  str_1 = PblValPtr((void *) str_1);
+  str_2 = PblValPtr((void *) str_2);
+
+  if (str_1 == str_2) return 0;
+
+  unsigned int len_1 = str_1->actual.len->actual;
+  unsigned int len_2 = str_2->actual.len->actual;
+
+  // memcmp compares as unsigned char, which gives the expected byte-wise order for UTF-8 as well
+  int result = memcmp(PblGetStringBytes(str_1), PblGetStringBytes(str_2), len_1 < len_2 ? len_1 : len_2);
+  if (result != 0) return result;
+
+  // The common part is equal, meaning the shorter string is ordered first
+  return len_1 < len_2 ? -1 : (len_1 > len_2 ? 1 : 0);
+}
+
+uint64_t PblHashBytes(const void *data, size_t len) {
+  const uint64_t m = 0xc6a4a7935bd1e995ULL;
+  const int r = 47;
+  const unsigned char *bytes = (const unsigned char *) data;
+  uint64_t h = 0x9e3779b97f4a7c15ULL ^ (len * m);
+
+  // Processing 8 bytes at a time - memcpy is used to avoid unaligned reads
+  size_t blocks = len / 8;
+  for (size_t i = 0; i < blocks; i++) {
+    uint64_t k;
+    memcpy(&k, bytes + i * 8, sizeof(uint64_t));
+
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+
+    h ^= k;
+    h *= m;
+  }
+
+  // Processing the remaining tail bytes
+  const unsigned char *tail = bytes + blocks * 8;
+  switch (len & 7) {
+    case 7: h ^= (uint64_t) tail[6] << 48; // fall through
+    case 6: h ^= (uint64_t) tail[5] << 40; // fall through
+    case 5: h ^= (uint64_t) tail[4] << 32; // fall through
+    case 4: h ^= (uint64_t) tail[3] << 24; // fall through
+    case 3: h ^= (uint64_t) tail[2] << 16; // fall through
+    case 2: h ^= (uint64_t) tail[1] << 8;  // fall through
+    case 1:
+      h ^= (uint64_t) tail[0];
+      h *= m;
   }
-  return PblGetBoolT(true);
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+  return h;
+}
+
+uint64_t PblGetStringHash(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  if (!str->actual.hash_cached) {
+    str->actual.hash = PblHashBytes(PblGetStringBytes(str), str->actual.len->actual);
+    str->actual.hash_cached = true;
+  }
+  return str->actual.hash;
 }
 
 PblUInt_T *PblGetMinimumArrayLen(PblUInt_T *len) {
@@ -128,13 +281,26 @@ PblVoid_T PblResizeStringT(PblString_T *str, PblUInt_T *len) {
   str = PblValPtr((void *) str);
   len = PblValPtr((void *) len);
 
+  PblAssertStringIsMutable(str);
   PblSize_T *byte_size = PblGetAllocSizeStringT(len);
+  unsigned int old_len = str->actual.len->actual;
 
   // Reallocating the memory with the new length - includes space for '\0' byte
   str->actual.str = PblRealloc(str->actual.str, byte_size->actual);
   // Calculating the size based on the allocation - the allocated memory is split into PblChar_T types
   str->actual.allocated_len = PblGetUIntT(byte_size->actual / sizeof(PblChar_T));
+  // The byte copy always has the same amount of slots as 'str'
+  if (str->actual.c_str != NULL)
+    str->actual.c_str = PblRealloc(str->actual.c_str, str->actual.allocated_len->actual * sizeof(char));
+
+  // Null-filling the grown part, so that no uninitialised memory becomes part of the content, or terminating the
+  // truncated content
+  unsigned int fill_start = old_len < len->actual ? old_len : len->actual;
+  for (unsigned int i = fill_start; i <= len->actual; i++) {
+    PBL_ASSIGN_TO_VAR(str->actual.str[i], PblChar_T, '\0');
+  }
   str->actual.len->actual = len->actual;
+  PblStringContentChanged(str);
   return PblVoid_T_DeclDefault;
 }
 
@@ -144,6 +310,7 @@ PblVoid_T PblWriteStringToStringT(PblString_T *str, PblString_T *content, PblUIn
   content = PblValPtr((void *) content);
   len_to_write = PblValPtr((void *) len_to_write);
 
+  PblAssertStringIsMutable(str);
   PBL_CREATE_NEW_ARRAY(char_arr, PblChar_T, len_to_write->actual);
   for (int i = 0; i < len_to_write->actual; i++) {
     // Using MemCpy to properly copy the value, aka. to be certain it is copied properly
@@ -160,6 +327,8 @@ PblVoid_T PblWriteCharArrayToStringT(PblString_T *str, PblChar_T *content, PblUI
   content = PblValPtr((void *) content);
   len_to_write = PblValPtr((void *) len_to_write);
 
+  PblAssertStringIsMutable(str);
+
   // Don't bother writing when the length to write is 0
   if (len_to_write->actual == 0)
     return PblVoid_T_DeclDefault;
@@ -169,14 +338,24 @@ PblVoid_T PblWriteCharArrayToStringT(PblString_T *str, PblChar_T *content, PblUI
   if (required_size->actual > str->actual.allocated_len->actual)
     PblResizeStringT(str, len_to_write);
 
+  if (str->actual.c_str == NULL)
+    str->actual.c_str = PblMallocAtomic(str->actual.allocated_len->actual * sizeof(char));
+
   int i = 0;
-  for (; i < len_to_write->actual; i++)
+  for (; i < len_to_write->actual; i++) {
     // Copying from the source string to the destination block of memory
     PblMemCpy(&(str->actual.str[i]), &(content[i]), sizeof(PblChar_T));
+    str->actual.c_str[i] = (char) content[i].actual;
+  }
   // Adding null character
   str->actual.str[i].actual = '\0';
+  str->actual.c_str[i] = '\0';
   // Resetting length
   str->actual.len->actual = len_to_write->actual;
+  // The content changed, meaning the hash and the encoding have to be re-calculated. The byte copy was already written
+  // above, so this does not go through 'PblStringContentChanged'
+  str->actual.hash_cached = false;
+  str->actual.utf8_state = PBL_STRING_UTF8_UNKNOWN;
 
   // Updating meta data
   str->meta.defined = true;
@@ -194,9 +373,11 @@ PblString_T *PblCreateStringT(PblChar_T *content, PblUInt_T *len) {
   str->actual.allocated_len = PblGetMinimumArrayLen(len);
   str->actual.len = len;
   str->actual.str = PblAllocateStringContentT(len);
+  str->actual.c_str = PblMallocAtomic(str->actual.allocated_len->actual * sizeof(char));
 
   // Safe writing null char to the beginning
   str->actual.str[0].actual = '\0';
+  str->actual.c_str[0] = '\0';
 
   PblWriteCharArrayToStringT(str, content, len);
 
@@ -219,7 +400,8 @@ PblVoid_T PblDeallocateStringT(PblString_T *lvalue) {
   // Validate the pointer for safety measures
   lvalue = PblValPtr((void *) lvalue);
 
-  if (lvalue->meta.defined) {
+  // Interned strings are shared and owned by the intern table
+  if (lvalue->meta.defined && !lvalue->actual.interned) {
     // Writing \0 onto the entire space of memory
     PBL_CREATE_NEW_ARRAY(nullify, PblChar_T, lvalue->actual.len->actual);
     for (int i = 0; i < lvalue->actual.len->actual; i++)
@@ -235,6 +417,10 @@ PblVoid_T PblDeallocateStringT(PblString_T *lvalue) {
       PblFree(lvalue->actual.str);
       lvalue->actual.str = NULL;
     }
+    if (lvalue->actual.c_str != NULL) {
+      PblFree(lvalue->actual.c_str);
+      lvalue->actual.c_str = NULL;
+    }
     if (lvalue->actual.len != NULL) {
       PblFree(lvalue->actual.len);
       lvalue->actual.len = NULL;
@@ -246,6 +432,1140 @@ PblVoid_T PblDeallocateStringT(PblString_T *lvalue) {
   return PblVoid_T_DeclDefault;
 }
 
+/// @brief Initial amount of slots in the intern table - always a power of two
+#define PBL_INTERN_TABLE_INITIAL_CAPACITY 256
+
+/// @brief Open-addressing (linear probing) hash table of the canonical strings. A table is never modified after it was
+/// replaced by a bigger one, so readers that still hold the old table can continue probing it safely.
+struct PblInternTable {
+  /// @brief The amount of slots - always a power of two
+  size_t capacity;
+  /// @brief The amount of used slots
+  size_t count;
+  /// @brief The slots, where NULL marks an empty slot. Slots are only written once (NULL -> string)
+  _Atomic(PblString_T *) *slots;
+};
+
+/// @brief The currently active intern table. The table is allocated using the garbage collector, meaning replaced
+/// tables are freed as soon as no reader references them anymore
+static _Atomic(struct PblInternTable *) PBL_INTERN_TABLE = NULL;
+/// @brief Lock for inserting new strings - only taken by writers
+static atomic_flag PBL_INTERN_TABLE_LOCK = ATOMIC_FLAG_INIT;
+
+/// @brief Allocates a new empty intern table with the passed capacity
+static struct PblInternTable *PblCreateInternTable(size_t capacity) {
+  struct PblInternTable *table = PblMalloc(sizeof(struct PblInternTable));
+  table->capacity = capacity;
+  table->count = 0;
+  table->slots = PblMalloc(capacity * sizeof(_Atomic(PblString_T *)));
+  for (size_t i = 0; i < capacity; i++) atomic_init(&table->slots[i], NULL);
+  return table;
+}
+
+/// @brief Probes the table for the passed content. Lock-free and safe to call concurrently with inserts
+/// @return The canonical string or NULL if the content was not interned yet
+static PblString_T *PblLookupInternTable(struct PblInternTable *table, const char *bytes, unsigned int len,
+                                         uint64_t hash) {
+  size_t mask = table->capacity - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    PblString_T *entry = atomic_load_explicit(&table->slots[i], memory_order_acquire);
+    if (entry == NULL) return NULL;
+    if (entry->actual.hash == hash && entry->actual.len->actual == len && memcmp(entry->actual.c_str, bytes, len) == 0)
+      return entry;
+  }
+}
+
+/// @brief Stores the passed string into the first free slot of its probe sequence
+/// @note Requires 'PBL_INTERN_TABLE_LOCK' to be held
+static void PblStoreInInternTable(struct PblInternTable *table, PblString_T *str) {
+  size_t mask = table->capacity - 1;
+  size_t i = str->actual.hash & mask;
+  while (atomic_load_explicit(&table->slots[i], memory_order_relaxed) != NULL) i = (i + 1) & mask;
+
+  // Release ensures readers see the fully initialised string once they see the pointer
+  atomic_store_explicit(&table->slots[i], str, memory_order_release);
+  table->count++;
+}
+
+/// @brief Interns the passed content - both 'PblInternString' and 'PblInternCString' end up here
+static PblString_T *PblInternBytes(const char *bytes, unsigned int len, uint64_t hash) {
+  // Fast path: lock-free lookup
+  struct PblInternTable *table = atomic_load_explicit(&PBL_INTERN_TABLE, memory_order_acquire);
+  if (table != NULL) {
+    PblString_T *found = PblLookupInternTable(table, bytes, len, hash);
+    if (found != NULL) return found;
+  }
+
+  while (atomic_flag_test_and_set_explicit(&PBL_INTERN_TABLE_LOCK, memory_order_acquire)) {}
+
+  // Re-checking, since another writer might have inserted the content while waiting for the lock
+  table = atomic_load_explicit(&PBL_INTERN_TABLE, memory_order_relaxed);
+  if (table == NULL) {
+    table = PblCreateInternTable(PBL_INTERN_TABLE_INITIAL_CAPACITY);
+    atomic_store_explicit(&PBL_INTERN_TABLE, table, memory_order_release);
+  }
+  PblString_T *found = PblLookupInternTable(table, bytes, len, hash);
+  if (found != NULL) {
+    atomic_flag_clear_explicit(&PBL_INTERN_TABLE_LOCK, memory_order_release);
+    return found;
+  }
+
+  // Keeping the load factor at max. 0.5 to keep the probe sequences short
+  if ((table->count + 1) * 2 > table->capacity) {
+    struct PblInternTable *grown = PblCreateInternTable(table->capacity * 2);
+    for (size_t i = 0; i < table->capacity; i++) {
+      PblString_T *entry = atomic_load_explicit(&table->slots[i], memory_order_relaxed);
+      if (entry != NULL) PblStoreInInternTable(grown, entry);
+    }
+    atomic_store_explicit(&PBL_INTERN_TABLE, grown, memory_order_release);
+    table = grown;
+  }
+
+  // Creating the canonical immutable copy - the content may contain null chars, so it's copied with the exact length
+  PblString_T *canonical = PblAllocateStringOfLen(len);
+  PblCopyBytesIntoString(canonical, 0, bytes, len);
+  canonical->actual.hash = hash;
+  canonical->actual.hash_cached = true;
+  canonical->actual.interned = true;
+  PblStoreInInternTable(table, canonical);
+
+  atomic_flag_clear_explicit(&PBL_INTERN_TABLE_LOCK, memory_order_release);
+  return canonical;
+}
+
+PblString_T *PblInternString(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  if (str->actual.interned) return str;
+  return PblInternBytes(PblGetStringBytes(str), str->actual.len->actual, PblGetStringHash(str));
+}
+
+PblString_T *PblInternCString(const char *content) {
+  // Validate the pointer for safety measures
+  content = PblValPtr((void *) content);
+
+  size_t len = strlen(content);
+  return PblInternBytes(content, (unsigned int) len, PblHashBytes(content, len));
+}
+
 // TODO! Add copy string function
 
 // ---- End of Function Definitions -----------------------------------------------------------------------------------
+
+// ---- Search Functions ----------------------------------------------------------------------------------------------
+
+/// @brief Signature of the byte-level search implementations, which are selected on runtime based on the CPU
+typedef size_t (*PblByteSearchFunc_T)(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len);
+
+/// @brief Finds the first occurrence of the needle using memchr (vectorised by the C library) for the first byte
+static size_t PblFindBytesScalar(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  const char *pos = haystack;
+  const char *end = haystack + (haystack_len - needle_len) + 1;
+  while (pos < end && (pos = memchr(pos, needle[0], end - pos)) != NULL) {
+    if (memcmp(pos + 1, needle + 1, needle_len - 1) == 0) return pos - haystack;
+    pos++;
+  }
+  return PBL_STRING_NOT_FOUND;
+}
+
+/// @brief Finds the last occurrence of the needle by checking first and last byte before comparing the content
+static size_t PblFindLastBytesScalar(const char *haystack, size_t haystack_len, const char *needle,
+                                     size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  for (size_t i = haystack_len - needle_len + 1; i-- > 0;) {
+    if (haystack[i] == needle[0] && haystack[i + needle_len - 1] == needle[needle_len - 1] &&
+        memcmp(haystack + i, needle, needle_len) == 0)
+      return i;
+  }
+  return PBL_STRING_NOT_FOUND;
+}
+
+/// @brief Finds the first byte contained in the char set using a 256-bit lookup table
+static size_t PblFindAnyOfBytesScalar(const char *haystack, size_t haystack_len, const char *char_set,
+                                      size_t char_set_len) {
+  uint64_t table[4] = {0};
+  for (size_t i = 0; i < char_set_len; i++) {
+    unsigned char c = (unsigned char) char_set[i];
+    table[c >> 6] |= (uint64_t) 1 << (c & 63);
+  }
+  for (size_t i = 0; i < haystack_len; i++) {
+    unsigned char c = (unsigned char) haystack[i];
+    if (table[c >> 6] & ((uint64_t) 1 << (c & 63))) return i;
+  }
+  return PBL_STRING_NOT_FOUND;
+}
+
+/// @brief Needle of the Two-Way string matching (Crochemore-Perrin), which is preprocessed once and may then be
+/// searched for in any amount of haystacks
+struct PblTwoWayNeedle {
+  /// @brief The bytes of the needle
+  const unsigned char *bytes;
+  /// @brief The length of the needle
+  size_t len;
+  /// @brief Whether the needle is matched from the end of the haystack, meaning both are read backwards
+  bool reverse;
+  /// @brief The end of the left half of the critical factorisation
+  size_t ms;
+  /// @brief The period of the needle, or the shift after a mismatch of the left half if the needle is not periodic
+  size_t p;
+  /// @brief The amount of bytes that still match after shifting by the period - 0 if the needle is not periodic
+  size_t mem0;
+  /// @brief The bytes contained in the needle
+  uint64_t byte_set[4];
+  /// @brief The position of the last occurrence of every byte inside the needle plus one
+  size_t shift[256];
+};
+
+/// @brief Gets the byte at the passed index in search direction, which counts from the end of the bytes for reverse
+/// searches
+static inline unsigned char PblTwoWayByteAt(const unsigned char *bytes, size_t len, size_t i, bool reverse) {
+  return reverse ? bytes[len - 1 - i] : bytes[i];
+}
+
+/// @brief Computes the maximal suffix of the needle for the passed byte order
+/// @return The end of the left half, while the period of the right half is written to 'period'
+static inline size_t PblTwoWayMaxSuffix(const unsigned char *n, size_t l, bool reverse, bool inverted,
+                                        size_t *period) {
+  size_t ip = (size_t) -1, jp = 0, k = 1, p = 1;
+  while (jp + k < l) {
+    unsigned char a = PblTwoWayByteAt(n, l, ip + k, reverse);
+    unsigned char b = PblTwoWayByteAt(n, l, jp + k, reverse);
+    if (a == b) {
+      if (k == p) {
+        jp += p;
+        k = 1;
+      } else k++;
+    } else if (inverted ? a < b : a > b) {
+      jp += k;
+      k = 1;
+      p = jp - ip;
+    } else {
+      ip = jp++;
+      k = p = 1;
+    }
+  }
+  *period = p;
+  return ip;
+}
+
+/// @brief Preprocesses the needle for 'PblFindBytesTwoWayPrepared'
+/// @param reverse Whether the last occurrence should be searched, which matches the needle from its end
+static inline void PblPrepareTwoWayNeedle(struct PblTwoWayNeedle *tw, const char *needle, size_t needle_len,
+                                          bool reverse) {
+  const unsigned char *n = (const unsigned char *) needle;
+  size_t l = needle_len;
+  tw->bytes = n;
+  tw->len = l;
+  tw->reverse = reverse;
+
+  // Byte set and shift table for the last byte of the current window
+  memset(tw->byte_set, 0, sizeof(tw->byte_set));
+  for (size_t i = 0; i < l; i++) {
+    unsigned char c = PblTwoWayByteAt(n, l, i, reverse);
+    tw->byte_set[c >> 6] |= (uint64_t) 1 << (c & 63);
+    tw->shift[c] = i + 1;
+  }
+
+  // Computing the maximal suffix for both orders, where the longer one is the critical factorisation
+  size_t p, p0;
+  size_t ms = PblTwoWayMaxSuffix(n, l, reverse, false, &p0);
+  size_t ip = PblTwoWayMaxSuffix(n, l, reverse, true, &p);
+  if (ip + 1 > ms + 1) ms = ip;
+  else p = p0;
+
+  // Periodic needle?
+  bool periodic = true;
+  for (size_t i = 0; i < ms + 1 && periodic; i++)
+    periodic = PblTwoWayByteAt(n, l, i, reverse) == PblTwoWayByteAt(n, l, i + p, reverse);
+  if (!periodic) {
+    tw->mem0 = 0;
+    p = (ms > l - ms - 1 ? ms : l - ms - 1) + 1;
+  } else tw->mem0 = l - p;
+  tw->ms = ms;
+  tw->p = p;
+}
+
+/// @brief Searches the preprocessed needle in the passed direction, which is inlined for both directions, so the byte
+/// accesses do not have to check it
+static inline __attribute__((always_inline)) size_t PblSearchTwoWayNeedle(const struct PblTwoWayNeedle *tw,
+                                                                          const char *haystack, size_t haystack_len,
+                                                                          bool reverse) {
+  const unsigned char *h = (const unsigned char *) haystack;
+  const unsigned char *n = tw->bytes;
+  const size_t l = tw->len, ms = tw->ms, p = tw->p, mem0 = tw->mem0;
+  size_t pos = 0, mem = 0, k;
+
+  for (;;) {
+    // The remaining haystack is shorter than the needle
+    if (haystack_len - pos < l) return PBL_STRING_NOT_FOUND;
+
+    // Checking the last byte of the window first and skipping using the shift table on a mismatch
+    unsigned char c = PblTwoWayByteAt(h, haystack_len, pos + l - 1, reverse);
+    if (tw->byte_set[c >> 6] & ((uint64_t) 1 << (c & 63))) {
+      k = l - tw->shift[c];
+      if (k) {
+        if (k < mem) k = mem;
+        pos += k;
+        mem = 0;
+        continue;
+      }
+    } else {
+      pos += l;
+      mem = 0;
+      continue;
+    }
+
+    // Comparing the right half
+    for (k = (ms + 1 > mem ? ms + 1 : mem);
+         k < l && PblTwoWayByteAt(n, l, k, reverse) == PblTwoWayByteAt(h, haystack_len, pos + k, reverse); k++) {}
+    if (k < l) {
+      pos += k - ms;
+      mem = 0;
+      continue;
+    }
+    // Comparing the left half
+    for (k = ms + 1;
+         k > mem && PblTwoWayByteAt(n, l, k - 1, reverse) == PblTwoWayByteAt(h, haystack_len, pos + k - 1, reverse);
+         k--) {}
+    if (k <= mem) return reverse ? haystack_len - pos - l : pos;
+    pos += p;
+    mem = mem0;
+  }
+}
+
+/// @brief Searches the preprocessed needle, which runs in linear time and constant space independent of the input. Used
+/// for long needles, where the worst case of the SIMD filter (many first/last byte hits) would be quadratic
+/// @return The index of the first occurrence, or of the last occurrence if the needle was prepared as 'reverse'
+static size_t PblFindBytesTwoWayPrepared(const struct PblTwoWayNeedle *tw, const char *haystack, size_t haystack_len) {
+  return tw->reverse ? PblSearchTwoWayNeedle(tw, haystack, haystack_len, true)
+                     : PblSearchTwoWayNeedle(tw, haystack, haystack_len, false);
+}
+
+/// @brief Finds the first occurrence of the needle using the Two-Way string matching
+static size_t PblFindBytesTwoWay(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  struct PblTwoWayNeedle tw;
+  PblPrepareTwoWayNeedle(&tw, needle, needle_len, false);
+  return PblFindBytesTwoWayPrepared(&tw, haystack, haystack_len);
+}
+
+/// @brief Finds the last occurrence of the needle using the Two-Way string matching on the reversed needle and haystack
+static size_t PblFindLastBytesTwoWay(const char *haystack, size_t haystack_len, const char *needle,
+                                     size_t needle_len) {
+  struct PblTwoWayNeedle tw;
+  PblPrepareTwoWayNeedle(&tw, needle, needle_len, true);
+  return PblFindBytesTwoWayPrepared(&tw, haystack, haystack_len);
+}
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#include <immintrin.h>
+
+/// @brief SIMD first/last-byte filter (SSE2): 16 candidate positions are checked at once by comparing the first byte of
+/// the needle with the window start and the last byte with the window end. Only positions where both match are
+/// compared using memcmp.
+/// @note Requires a needle length of at least 2
+static size_t PblFindBytesSse2(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+  size_t i = 0;
+  for (; i + needle_len - 1 + 16 <= haystack_len; i += 16) {
+    __m128i block_first = _mm_loadu_si128((const __m128i *) (haystack + i));
+    __m128i block_last = _mm_loadu_si128((const __m128i *) (haystack + i + needle_len - 1));
+    unsigned int mask = (unsigned int) _mm_movemask_epi8(
+      _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+    while (mask != 0) {
+      unsigned int bit = (unsigned int) __builtin_ctz(mask);
+      if (memcmp(haystack + i + bit + 1, needle + 1, needle_len - 2) == 0) return i + bit;
+      mask &= mask - 1;
+    }
+  }
+
+  // Remaining positions that do not fill an entire block
+  size_t rest = PblFindBytesScalar(haystack + i, haystack_len - i, needle, needle_len);
+  return rest == PBL_STRING_NOT_FOUND ? rest : i + rest;
+}
+
+/// @brief Reverse SIMD first/last-byte filter (SSE2) - see 'PblFindBytesSse2'
+static size_t PblFindLastBytesSse2(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+  // The amount of candidate positions that were not checked yet - always [0, candidates)
+  size_t candidates = haystack_len - needle_len + 1;
+  for (; candidates >= 16; candidates -= 16) {
+    size_t i = candidates - 16;
+    __m128i block_first = _mm_loadu_si128((const __m128i *) (haystack + i));
+    __m128i block_last = _mm_loadu_si128((const __m128i *) (haystack + i + needle_len - 1));
+    unsigned int mask = (unsigned int) _mm_movemask_epi8(
+      _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+    while (mask != 0) {
+      unsigned int bit = 31 - (unsigned int) __builtin_clz(mask);
+      if (memcmp(haystack + i + bit + 1, needle + 1, needle_len - 2) == 0) return i + bit;
+      mask &= ~(1u << bit);
+    }
+  }
+  return PblFindLastBytesScalar(haystack, candidates + needle_len - 1, needle, needle_len);
+}
+
+/// @brief Finds the first byte of the char set by comparing 16 bytes at once against every char of the set
+/// @note Only used for char sets with at max. 16 chars, larger sets use the lookup table
+static size_t PblFindAnyOfBytesSse2(const char *haystack, size_t haystack_len, const char *char_set,
+                                    size_t char_set_len) {
+  if (char_set_len > 16) return PblFindAnyOfBytesScalar(haystack, haystack_len, char_set, char_set_len);
+
+  __m128i set[16];
+  for (size_t c = 0; c < char_set_len; c++) set[c] = _mm_set1_epi8(char_set[c]);
+
+  size_t i = 0;
+  for (; i + 16 <= haystack_len; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *) (haystack + i));
+    __m128i hits = _mm_setzero_si128();
+    for (size_t c = 0; c < char_set_len; c++) hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, set[c]));
+    unsigned int mask = (unsigned int) _mm_movemask_epi8(hits);
+    if (mask != 0) return i + (unsigned int) __builtin_ctz(mask);
+  }
+
+  size_t rest = PblFindAnyOfBytesScalar(haystack + i, haystack_len - i, char_set, char_set_len);
+  return rest == PBL_STRING_NOT_FOUND ? rest : i + rest;
+}
+
+/// @brief SIMD first/last-byte filter (AVX2) - see 'PblFindBytesSse2'
+__attribute__((target("avx2"))) static size_t PblFindBytesAvx2(const char *haystack, size_t haystack_len,
+                                                                const char *needle, size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  const __m256i first = _mm256_set1_epi8(needle[0]);
+  const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+  size_t i = 0;
+  for (; i + needle_len - 1 + 32 <= haystack_len; i += 32) {
+    __m256i block_first = _mm256_loadu_si256((const __m256i *) (haystack + i));
+    __m256i block_last = _mm256_loadu_si256((const __m256i *) (haystack + i + needle_len - 1));
+    unsigned int mask = (unsigned int) _mm256_movemask_epi8(
+      _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+    while (mask != 0) {
+      unsigned int bit = (unsigned int) __builtin_ctz(mask);
+      if (memcmp(haystack + i + bit + 1, needle + 1, needle_len - 2) == 0) return i + bit;
+      mask &= mask - 1;
+    }
+  }
+
+  size_t rest = PblFindBytesSse2(haystack + i, haystack_len - i, needle, needle_len);
+  return rest == PBL_STRING_NOT_FOUND ? rest : i + rest;
+}
+
+/// @brief Reverse SIMD first/last-byte filter (AVX2) - see 'PblFindBytesSse2'
+__attribute__((target("avx2"))) static size_t PblFindLastBytesAvx2(const char *haystack, size_t haystack_len,
+                                                                    const char *needle, size_t needle_len) {
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+
+  const __m256i first = _mm256_set1_epi8(needle[0]);
+  const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+  size_t candidates = haystack_len - needle_len + 1;
+  for (; candidates >= 32; candidates -= 32) {
+    size_t i = candidates - 32;
+    __m256i block_first = _mm256_loadu_si256((const __m256i *) (haystack + i));
+    __m256i block_last = _mm256_loadu_si256((const __m256i *) (haystack + i + needle_len - 1));
+    unsigned int mask = (unsigned int) _mm256_movemask_epi8(
+      _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+    while (mask != 0) {
+      unsigned int bit = 31 - (unsigned int) __builtin_clz(mask);
+      if (memcmp(haystack + i + bit + 1, needle + 1, needle_len - 2) == 0) return i + bit;
+      mask &= ~(1u << bit);
+    }
+  }
+  return PblFindLastBytesSse2(haystack, candidates + needle_len - 1, needle, needle_len);
+}
+
+/// @brief Finds the first byte of the char set using AVX2 - see 'PblFindAnyOfBytesSse2'
+__attribute__((target("avx2"))) static size_t PblFindAnyOfBytesAvx2(const char *haystack, size_t haystack_len,
+                                                                     const char *char_set, size_t char_set_len) {
+  if (char_set_len > 16) return PblFindAnyOfBytesScalar(haystack, haystack_len, char_set, char_set_len);
+
+  __m256i set[16];
+  for (size_t c = 0; c < char_set_len; c++) set[c] = _mm256_set1_epi8(char_set[c]);
+
+  size_t i = 0;
+  for (; i + 32 <= haystack_len; i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *) (haystack + i));
+    __m256i hits = _mm256_setzero_si256();
+    for (size_t c = 0; c < char_set_len; c++) hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, set[c]));
+    unsigned int mask = (unsigned int) _mm256_movemask_epi8(hits);
+    if (mask != 0) return i + (unsigned int) __builtin_ctz(mask);
+  }
+
+  size_t rest = PblFindAnyOfBytesSse2(haystack + i, haystack_len - i, char_set, char_set_len);
+  return rest == PBL_STRING_NOT_FOUND ? rest : i + rest;
+}
+
+/// @brief The implementations used by the search functions - SSE2 is always available on x86-64, and upgraded to AVX2
+/// on startup if the CPU supports it
+static PblByteSearchFunc_T PBL_FIND_BYTES_IMPL = PblFindBytesSse2;
+static PblByteSearchFunc_T PBL_FIND_LAST_BYTES_IMPL = PblFindLastBytesSse2;
+static PblByteSearchFunc_T PBL_FIND_ANY_OF_BYTES_IMPL = PblFindAnyOfBytesSse2;
+
+__attribute__((unused))
+__attribute__((constructor))
+__attribute__((deprecated("Compiler-Only Function - User Call Invalid!")))
+static void PBL_CONSTRUCTOR_STRING_SEARCH_INIT(void) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    PBL_FIND_BYTES_IMPL = PblFindBytesAvx2;
+    PBL_FIND_LAST_BYTES_IMPL = PblFindLastBytesAvx2;
+    PBL_FIND_ANY_OF_BYTES_IMPL = PblFindAnyOfBytesAvx2;
+  }
+}
+#else
+/// @brief The implementations used by the search functions - no SIMD implementation is available for this target, so
+/// the scalar ones are used, which still rely on the (usually vectorised) memchr and memcmp of the C library
+static PblByteSearchFunc_T PBL_FIND_BYTES_IMPL = PblFindBytesScalar;
+static PblByteSearchFunc_T PBL_FIND_LAST_BYTES_IMPL = PblFindLastBytesScalar;
+static PblByteSearchFunc_T PBL_FIND_ANY_OF_BYTES_IMPL = PblFindAnyOfBytesScalar;
+#endif
+
+/// @brief Finds the first occurrence of the needle inside the haystack bytes by picking the best-fitting algorithm
+static size_t PblFindBytes(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  if (needle_len == 0) return 0;
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+  if (needle_len == 1) {
+    const char *pos = memchr(haystack, needle[0], haystack_len);
+    return pos != NULL ? (size_t) (pos - haystack) : PBL_STRING_NOT_FOUND;
+  }
+  if (needle_len > PBL_STRING_TWO_WAY_THRESHOLD)
+    return PblFindBytesTwoWay(haystack, haystack_len, needle, needle_len);
+  return PBL_FIND_BYTES_IMPL(haystack, haystack_len, needle, needle_len);
+}
+
+/// @brief Finds the last occurrence of the needle inside the haystack bytes
+static size_t PblFindLastBytes(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len) {
+  if (needle_len == 0) return haystack_len;
+  if (needle_len > haystack_len) return PBL_STRING_NOT_FOUND;
+  if (needle_len == 1) {
+    for (size_t i = haystack_len; i-- > 0;)
+      if (haystack[i] == needle[0]) return i;
+    return PBL_STRING_NOT_FOUND;
+  }
+  if (needle_len > PBL_STRING_TWO_WAY_THRESHOLD)
+    return PblFindLastBytesTwoWay(haystack, haystack_len, needle, needle_len);
+  return PBL_FIND_LAST_BYTES_IMPL(haystack, haystack_len, needle, needle_len);
+}
+
+/// @brief Finds the first byte of the haystack bytes that is contained in the char set
+static size_t PblFindAnyOfBytes(const char *haystack, size_t haystack_len, const char *char_set,
+                                size_t char_set_len) {
+  if (char_set_len == 0) return PBL_STRING_NOT_FOUND;
+  if (char_set_len == 1) {
+    const char *pos = memchr(haystack, char_set[0], haystack_len);
+    return pos != NULL ? (size_t) (pos - haystack) : PBL_STRING_NOT_FOUND;
+  }
+  return PBL_FIND_ANY_OF_BYTES_IMPL(haystack, haystack_len, char_set, char_set_len);
+}
+
+size_t PblStringFind(PblString_T *haystack, PblString_T *needle) {
+  // Validate the pointer for safety measures
+  haystack = PblValPtr((void *) haystack);
+  needle = PblValPtr((void *) needle);
+
+  return PblFindBytes(PblGetStringBytes(haystack), haystack->actual.len->actual, PblGetStringBytes(needle),
+                      needle->actual.len->actual);
+}
+
+size_t PblStringFindLast(PblString_T *haystack, PblString_T *needle) {
+  // Validate the pointer for safety measures
+  haystack = PblValPtr((void *) haystack);
+  needle = PblValPtr((void *) needle);
+
+  return PblFindLastBytes(PblGetStringBytes(haystack), haystack->actual.len->actual, PblGetStringBytes(needle),
+                          needle->actual.len->actual);
+}
+
+bool PblStringContains(PblString_T *haystack, PblString_T *needle) {
+  return PblStringFind(haystack, needle) != PBL_STRING_NOT_FOUND;
+}
+
+size_t PblStringCount(PblString_T *haystack, PblString_T *needle) {
+  // Validate the pointer for safety measures
+  haystack = PblValPtr((void *) haystack);
+  needle = PblValPtr((void *) needle);
+
+  const char *bytes = PblGetStringBytes(haystack);
+  size_t len = haystack->actual.len->actual;
+  size_t needle_len = needle->actual.len->actual;
+  if (needle_len == 0) return len + 1;
+
+  size_t count = 0;
+  size_t offset = 0;
+  size_t found;
+  if (needle_len > PBL_STRING_TWO_WAY_THRESHOLD) {
+    // Preprocessing the needle only once for all occurrences
+    struct PblTwoWayNeedle tw;
+    PblPrepareTwoWayNeedle(&tw, PblGetStringBytes(needle), needle_len, false);
+    while ((found = PblFindBytesTwoWayPrepared(&tw, bytes + offset, len - offset)) != PBL_STRING_NOT_FOUND) {
+      count++;
+      offset += found + needle_len;
+    }
+    return count;
+  }
+  while ((found = PblFindBytes(bytes + offset, len - offset, PblGetStringBytes(needle), needle_len)) !=
+         PBL_STRING_NOT_FOUND) {
+    count++;
+    offset += found + needle_len;
+  }
+  return count;
+}
+
+size_t PblStringFindAnyOf(PblString_T *haystack, PblString_T *char_set) {
+  // Validate the pointer for safety measures
+  haystack = PblValPtr((void *) haystack);
+  char_set = PblValPtr((void *) char_set);
+
+  return PblFindAnyOfBytes(PblGetStringBytes(haystack), haystack->actual.len->actual, PblGetStringBytes(char_set),
+                           char_set->actual.len->actual);
+}
+
+// ---- End of Search Functions ---------------------------------------------------------------------------------------
+
+// ---- String Views and Splitting ------------------------------------------------------------------------------------
+
+/// @brief The bytes that are treated as whitespace by 'PBL_STRING_SPLIT_WHITESPACE'
+static const char PBL_WHITESPACE_BYTES[] = " \t\n\v\f\r";
+/// @brief The amount of bytes in 'PBL_WHITESPACE_BYTES' (without the null char)
+#define PBL_WHITESPACE_BYTES_LEN (sizeof(PBL_WHITESPACE_BYTES) - 1)
+
+/// @brief Returns whether the passed byte is contained in 'PBL_WHITESPACE_BYTES'
+static inline bool PblIsWhitespaceByte(char byte) {
+  return byte == ' ' || (byte >= '\t' && byte <= '\r');
+}
+
+PblStringView_T PblGetStringViewT(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  return PblGetStringViewOfBytes(PblGetStringBytes(str), str->actual.len->actual);
+}
+
+PblStringView_T PblGetStringViewOfBytes(const char *ptr, size_t len) {
+  return PBL_TYPE_DEFINITION_DEFAULT_STRUCT_CONSTRUCTOR(PblStringView_T, .ptr = ptr, .len = len);
+}
+
+PblStringView_T PblGetStringViewOfCString(const char *content) {
+  // Validate the pointer for safety measures
+  content = PblValPtr((void *) content);
+
+  return PblGetStringViewOfBytes(content, strlen(content));
+}
+
+bool PblStringViewEquals(PblStringView_T view_1, PblStringView_T view_2) {
+  if (view_1.actual.len != view_2.actual.len) return false;
+  if (view_1.actual.len == 0 || view_1.actual.ptr == view_2.actual.ptr) return true;
+  return memcmp(view_1.actual.ptr, view_2.actual.ptr, view_1.actual.len) == 0;
+}
+
+PblString_T *PblGetStringTFromView(PblStringView_T view) {
+  PblString_T *str = PblAllocateStringOfLen(view.actual.len);
+  PblCopyBytesIntoString(str, 0, view.actual.ptr, view.actual.len);
+  return str;
+}
+
+/// @brief Creates a new split iterator with the passed mode
+static PblStringSplitIter_T PblCreateSplitIter(enum PblStringSplitMode mode, PblStringView_T source,
+                                               PblStringView_T separator) {
+  return (PblStringSplitIter_T){.mode = mode, .source = source, .separator = separator, .pos = 0, .done = false};
+}
+
+PblStringSplitIter_T PblStringSplit(PblStringView_T source, PblStringView_T separator) {
+  return PblCreateSplitIter(PBL_STRING_SPLIT_SEPARATOR, source, separator);
+}
+
+PblStringSplitIter_T PblStringSplitWhitespace(PblStringView_T source) {
+  return PblCreateSplitIter(PBL_STRING_SPLIT_WHITESPACE, source, PblStringView_T_DefDefault);
+}
+
+PblStringSplitIter_T PblStringSplitAnyOf(PblStringView_T source, PblStringView_T char_set) {
+  return PblCreateSplitIter(PBL_STRING_SPLIT_ANY_OF, source, char_set);
+}
+
+bool PblStringSplitNext(PblStringSplitIter_T *iter, PblStringView_T *token) {
+  // Validate the pointer for safety measures
+  iter = PblValPtr((void *) iter);
+  token = PblValPtr((void *) token);
+
+  if (iter->done) return false;
+
+  const char *bytes = iter->source.actual.ptr;
+  size_t len = iter->source.actual.len;
+  size_t start = iter->pos;
+
+  if (iter->mode == PBL_STRING_SPLIT_WHITESPACE) {
+    // Skipping the leading whitespace - if only whitespace is left, there are no more tokens
+    while (start < len && PblIsWhitespaceByte(bytes[start])) start++;
+    if (start >= len) {
+      iter->done = true;
+      return false;
+    }
+
+    size_t found = PblFindAnyOfBytes(bytes + start, len - start, PBL_WHITESPACE_BYTES, PBL_WHITESPACE_BYTES_LEN);
+    size_t token_len = found != PBL_STRING_NOT_FOUND ? found : len - start;
+    *token = PblGetStringViewOfBytes(bytes + start, token_len);
+    iter->pos = start + token_len;
+    return true;
+  }
+
+  const char *sep = iter->separator.actual.ptr;
+  size_t sep_len = iter->separator.actual.len;
+  size_t found = PBL_STRING_NOT_FOUND;
+  if (start < len && sep_len > 0) {
+    found = iter->mode == PBL_STRING_SPLIT_SEPARATOR ? PblFindBytes(bytes + start, len - start, sep, sep_len)
+                                                     : PblFindAnyOfBytes(bytes + start, len - start, sep, sep_len);
+  }
+
+  // No separator left, meaning the rest of the source is the last token
+  if (found == PBL_STRING_NOT_FOUND) {
+    *token = PblGetStringViewOfBytes(bytes + start, len - start);
+    iter->done = true;
+    return true;
+  }
+
+  *token = PblGetStringViewOfBytes(bytes + start, found);
+  iter->pos = start + found + (iter->mode == PBL_STRING_SPLIT_SEPARATOR ? sep_len : 1);
+  return true;
+}
+
+PblString_T *PblStringJoin(PblString_T **parts, size_t amount, PblString_T *separator) {
+  // Validate the pointer for safety measures
+  separator = PblValPtr((void *) separator);
+  if (amount > 0) parts = PblValPtr((void *) parts);
+
+  // Calculating the total length first, so the content only has to be allocated once
+  size_t sep_len = separator->actual.len->actual;
+  size_t total_len = amount > 0 ? sep_len * (amount - 1) : 0;
+  for (size_t i = 0; i < amount; i++) total_len += ((PblString_T *) PblValPtr((void *) parts[i]))->actual.len->actual;
+
+  PblString_T *str = PblAllocateStringOfLen(total_len);
+  const char *sep_bytes = PblGetStringBytes(separator);
+  size_t offset = 0;
+  for (size_t i = 0; i < amount; i++) {
+    if (i > 0) {
+      PblCopyBytesIntoString(str, offset, sep_bytes, sep_len);
+      offset += sep_len;
+    }
+    size_t part_len = parts[i]->actual.len->actual;
+    PblCopyBytesIntoString(str, offset, PblGetStringBytes(parts[i]), part_len);
+    offset += part_len;
+  }
+  return str;
+}
+
+PblString_T *PblStringJoinViews(PblStringView_T *parts, size_t amount, PblStringView_T separator) {
+  // Validate the pointer for safety measures
+  if (amount > 0) parts = PblValPtr((void *) parts);
+
+  // Calculating the total length first, so the content only has to be allocated once
+  size_t sep_len = separator.actual.len;
+  size_t total_len = amount > 0 ? sep_len * (amount - 1) : 0;
+  for (size_t i = 0; i < amount; i++) total_len += parts[i].actual.len;
+
+  PblString_T *str = PblAllocateStringOfLen(total_len);
+  size_t offset = 0;
+  for (size_t i = 0; i < amount; i++) {
+    if (i > 0) {
+      PblCopyBytesIntoString(str, offset, separator.actual.ptr, sep_len);
+      offset += sep_len;
+    }
+    PblCopyBytesIntoString(str, offset, parts[i].actual.ptr, parts[i].actual.len);
+    offset += parts[i].actual.len;
+  }
+  return str;
+}
+
+// ---- End of String Views and Splitting -----------------------------------------------------------------------------
+
+// ---- Unicode Functions ---------------------------------------------------------------------------------------------
+
+/// @brief Decodes the UTF-8 sequence at the start of the passed bytes
+/// @return The length of the sequence in bytes, or 0 if the bytes do not start with a valid sequence
+static inline size_t PblDecodeUtf8Sequence(const unsigned char *bytes, size_t len, uint32_t *codepoint) {
+  unsigned char lead = bytes[0];
+  if (lead < 0x80) {
+    *codepoint = lead;
+    return 1;
+  }
+
+  size_t seq_len;
+  uint32_t value;
+  uint32_t min_value;
+  if ((lead & 0xE0) == 0xC0) {
+    seq_len = 2;
+    value = lead & 0x1F;
+    min_value = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    seq_len = 3;
+    value = lead & 0x0F;
+    min_value = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    seq_len = 4;
+    value = lead & 0x07;
+    min_value = 0x10000;
+  } else {
+    return 0;
+  }
+  if (seq_len > len) return 0;
+
+  for (size_t i = 1; i < seq_len; i++) {
+    if ((bytes[i] & 0xC0) != 0x80) return 0;
+    value = (value << 6) | (bytes[i] & 0x3F);
+  }
+
+  // Overlong encodings, surrogates and codepoints outside the Unicode range are invalid
+  if (value < min_value || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) return 0;
+  *codepoint = value;
+  return seq_len;
+}
+
+/// @brief Validates UTF-8 by decoding sequence by sequence, while skipping 8 ASCII bytes at once where possible
+static bool PblValidateUtf8Scalar(const char *bytes, size_t len) {
+  const unsigned char *data = (const unsigned char *) bytes;
+  size_t i = 0;
+  while (i < len) {
+    if (i + 8 <= len) {
+      uint64_t block;
+      memcpy(&block, data + i, sizeof(uint64_t));
+      if ((block & 0x8080808080808080ULL) == 0) {
+        i += 8;
+        continue;
+      }
+    }
+
+    uint32_t codepoint;
+    size_t seq_len = PblDecodeUtf8Sequence(data + i, len - i, &codepoint);
+    if (seq_len == 0) return false;
+    i += seq_len;
+  }
+  return true;
+}
+
+/// @brief Checks whether the passed bytes are ASCII-only, 8 bytes at a time
+static bool PblIsAsciiBytes(const char *bytes, size_t len) {
+  uint64_t combined = 0;
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint64_t block;
+    memcpy(&block, bytes + i, sizeof(uint64_t));
+    combined |= block;
+  }
+  for (; i < len; i++) combined |= (unsigned char) bytes[i];
+  return (combined & 0x8080808080808080ULL) == 0;
+}
+
+/// @brief Signature of the UTF-8 validation implementations, which are selected on runtime based on the CPU
+typedef bool (*PblUtf8ValidateFunc_T)(const char *bytes, size_t len);
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#include <immintrin.h>
+
+// Error bits of the lookup algorithm (Keiser, Lemire: "Validating UTF-8 In Less Than One Instruction Per Byte"). Every
+// pair of adjacent bytes is classified using three 16-entry tables (high nibble of the first byte, low nibble of the
+// first byte and high nibble of the second byte). A pair is invalid if the bits of all three lookups overlap.
+#define PBL_UTF8_TOO_SHORT (1 << 0)
+#define PBL_UTF8_TOO_LONG (1 << 1)
+#define PBL_UTF8_OVERLONG_3 (1 << 2)
+#define PBL_UTF8_TOO_LARGE (1 << 3)
+#define PBL_UTF8_SURROGATE (1 << 4)
+#define PBL_UTF8_OVERLONG_2 (1 << 5)
+#define PBL_UTF8_TOO_LARGE_1000 (1 << 6)
+#define PBL_UTF8_OVERLONG_4 (1 << 6)
+#define PBL_UTF8_TWO_CONTS (1 << 7)
+#define PBL_UTF8_CARRY (PBL_UTF8_TOO_SHORT | PBL_UTF8_TOO_LONG | PBL_UTF8_TWO_CONTS)
+
+/// @brief Lookup by the high nibble of the first byte of a pair
+#define PBL_UTF8_BYTE_1_HIGH_TABLE                                                                                     \
+  PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG,    \
+    PBL_UTF8_TOO_LONG, PBL_UTF8_TOO_LONG, PBL_UTF8_TWO_CONTS, PBL_UTF8_TWO_CONTS, PBL_UTF8_TWO_CONTS,                  \
+    PBL_UTF8_TWO_CONTS, PBL_UTF8_TOO_SHORT | PBL_UTF8_OVERLONG_2, PBL_UTF8_TOO_SHORT,                                  \
+    PBL_UTF8_TOO_SHORT | PBL_UTF8_OVERLONG_3 | PBL_UTF8_SURROGATE,                                                     \
+    PBL_UTF8_TOO_SHORT | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000 | PBL_UTF8_OVERLONG_4
+
+/// @brief Lookup by the low nibble of the first byte of a pair
+#define PBL_UTF8_BYTE_1_LOW_TABLE                                                                                      \
+  PBL_UTF8_CARRY | PBL_UTF8_OVERLONG_3 | PBL_UTF8_OVERLONG_2 | PBL_UTF8_OVERLONG_4,                                    \
+    PBL_UTF8_CARRY | PBL_UTF8_OVERLONG_2, PBL_UTF8_CARRY, PBL_UTF8_CARRY, PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE,         \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000 | PBL_UTF8_SURROGATE,                                \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000,                                                     \
+    PBL_UTF8_CARRY | PBL_UTF8_TOO_LARGE | PBL_UTF8_TOO_LARGE_1000
+
+/// @brief Lookup by the high nibble of the second byte of a pair
+#define PBL_UTF8_BYTE_2_HIGH_TABLE                                                                                     \
+  PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT,                  \
+    PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT,                                                        \
+    PBL_UTF8_TOO_LONG | PBL_UTF8_OVERLONG_2 | PBL_UTF8_TWO_CONTS | PBL_UTF8_OVERLONG_3 | PBL_UTF8_TOO_LARGE_1000 |     \
+      PBL_UTF8_OVERLONG_4,                                                                                             \
+    PBL_UTF8_TOO_LONG | PBL_UTF8_OVERLONG_2 | PBL_UTF8_TWO_CONTS | PBL_UTF8_OVERLONG_3 | PBL_UTF8_TOO_LARGE,           \
+    PBL_UTF8_TOO_LONG | PBL_UTF8_OVERLONG_2 | PBL_UTF8_TWO_CONTS | PBL_UTF8_SURROGATE | PBL_UTF8_TOO_LARGE,            \
+    PBL_UTF8_TOO_LONG | PBL_UTF8_OVERLONG_2 | PBL_UTF8_TWO_CONTS | PBL_UTF8_SURROGATE | PBL_UTF8_TOO_LARGE,            \
+    PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT, PBL_UTF8_TOO_SHORT
+
+/// @brief Checks one block of 16 bytes, where 'prev_input' is the previous block (required for sequences spanning both)
+/// @return The error bits - any non-zero byte means the input is invalid
+__attribute__((target("ssse3"))) static inline __m128i PblCheckUtf8BlockSsse3(__m128i input, __m128i prev_input) {
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+  const __m128i byte_1_high_table = _mm_setr_epi8(PBL_UTF8_BYTE_1_HIGH_TABLE);
+  const __m128i byte_1_low_table = _mm_setr_epi8(PBL_UTF8_BYTE_1_LOW_TABLE);
+  const __m128i byte_2_high_table = _mm_setr_epi8(PBL_UTF8_BYTE_2_HIGH_TABLE);
+
+  // The input shifted by one, two and three bytes, where the missing bytes are taken from the previous block
+  __m128i prev_1 = _mm_alignr_epi8(input, prev_input, 15);
+  __m128i prev_2 = _mm_alignr_epi8(input, prev_input, 14);
+  __m128i prev_3 = _mm_alignr_epi8(input, prev_input, 13);
+
+  __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev_1, 4), low_nibble));
+  __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev_1, low_nibble));
+  __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+  __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+  // Third and fourth bytes of a sequence must be continuations, which the pair lookup above can not detect
+  __m128i is_third_byte = _mm_subs_epu8(prev_2, _mm_set1_epi8((char) (0xE0 - 0x80)));
+  __m128i is_fourth_byte = _mm_subs_epu8(prev_3, _mm_set1_epi8((char) (0xF0 - 0x80)));
+  __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8((char) 0x80));
+  return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+/// @brief Returns non-zero bytes if the block ends with an incomplete sequence
+__attribute__((target("ssse3"))) static inline __m128i PblIsIncompleteUtf8Ssse3(__m128i input) {
+  const __m128i max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char) (0xF0 - 1),
+                                          (char) (0xE0 - 1), (char) (0xC0 - 1));
+  return _mm_subs_epu8(input, max_value);
+}
+
+/// @brief Validates UTF-8 using the lookup algorithm on 16 bytes at once (SSSE3)
+__attribute__((target("ssse3"))) static bool PblValidateUtf8Ssse3(const char *bytes, size_t len) {
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+
+  size_t i = 0;
+  char tail[16];
+  while (i < len) {
+    __m128i input;
+    if (i + 16 <= len) {
+      input = _mm_loadu_si128((const __m128i *) (bytes + i));
+    } else {
+      // The last block is padded with null chars, which are ASCII and therefore never hide an incomplete sequence
+      memset(tail, 0, sizeof(tail));
+      memcpy(tail, bytes + i, len - i);
+      input = _mm_loadu_si128((const __m128i *) tail);
+    }
+    i += 16;
+
+    if (_mm_movemask_epi8(input) == 0) {
+      // ASCII-only block: only a sequence that was left incomplete by the previous block can be an error
+      error = _mm_or_si128(error, prev_incomplete);
+    } else {
+      error = _mm_or_si128(error, PblCheckUtf8BlockSsse3(input, prev_input));
+      prev_incomplete = PblIsIncompleteUtf8Ssse3(input);
+    }
+    prev_input = input;
+  }
+  error = _mm_or_si128(error, prev_incomplete);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+/// @brief Checks one block of 32 bytes - see 'PblCheckUtf8BlockSsse3'
+__attribute__((target("avx2"))) static inline __m256i PblCheckUtf8BlockAvx2(__m256i input, __m256i prev_input) {
+  const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+  const __m256i byte_1_high_table = _mm256_setr_epi8(PBL_UTF8_BYTE_1_HIGH_TABLE, PBL_UTF8_BYTE_1_HIGH_TABLE);
+  const __m256i byte_1_low_table = _mm256_setr_epi8(PBL_UTF8_BYTE_1_LOW_TABLE, PBL_UTF8_BYTE_1_LOW_TABLE);
+  const __m256i byte_2_high_table = _mm256_setr_epi8(PBL_UTF8_BYTE_2_HIGH_TABLE, PBL_UTF8_BYTE_2_HIGH_TABLE);
+
+  // alignr works per 128-bit lane, so the lane boundary is bridged with the upper half of the previous block
+  __m256i bridge = _mm256_permute2x128_si256(prev_input, input, 0x21);
+  __m256i prev_1 = _mm256_alignr_epi8(input, bridge, 15);
+  __m256i prev_2 = _mm256_alignr_epi8(input, bridge, 14);
+  __m256i prev_3 = _mm256_alignr_epi8(input, bridge, 13);
+
+  __m256i byte_1_high =
+    _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev_1, 4), low_nibble));
+  __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev_1, low_nibble));
+  __m256i byte_2_high =
+    _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+  __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+  __m256i is_third_byte = _mm256_subs_epu8(prev_2, _mm256_set1_epi8((char) (0xE0 - 0x80)));
+  __m256i is_fourth_byte = _mm256_subs_epu8(prev_3, _mm256_set1_epi8((char) (0xF0 - 0x80)));
+  __m256i must_be_continuation =
+    _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8((char) 0x80));
+  return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+/// @brief Returns non-zero bytes if the block ends with an incomplete sequence
+__attribute__((target("avx2"))) static inline __m256i PblIsIncompleteUtf8Avx2(__m256i input) {
+  const __m256i max_value =
+    _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                     -1, -1, -1, -1, -1, (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+  return _mm256_subs_epu8(input, max_value);
+}
+
+/// @brief Validates UTF-8 using the lookup algorithm on 32 bytes at once (AVX2)
+__attribute__((target("avx2"))) static bool PblValidateUtf8Avx2(const char *bytes, size_t len) {
+  __m256i error = _mm256_setzero_si256();
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+
+  size_t i = 0;
+  char tail[32];
+  while (i < len) {
+    __m256i input;
+    if (i + 32 <= len) {
+      input = _mm256_loadu_si256((const __m256i *) (bytes + i));
+    } else {
+      memset(tail, 0, sizeof(tail));
+      memcpy(tail, bytes + i, len - i);
+      input = _mm256_loadu_si256((const __m256i *) tail);
+    }
+    i += 32;
+
+    if (_mm256_movemask_epi8(input) == 0) {
+      error = _mm256_or_si256(error, prev_incomplete);
+    } else {
+      error = _mm256_or_si256(error, PblCheckUtf8BlockAvx2(input, prev_input));
+      prev_incomplete = PblIsIncompleteUtf8Avx2(input);
+    }
+    prev_input = input;
+  }
+  error = _mm256_or_si256(error, prev_incomplete);
+  return _mm256_testz_si256(error, error) != 0;
+}
+
+/// @brief Counts the bytes that are not UTF-8 continuation bytes (10xxxxxx), 16 bytes at once (SSE2)
+static size_t PblCountUtf8LeadBytes(const char *bytes, size_t len) {
+  // Continuation bytes are exactly the bytes <= -65 (0xBF) when interpreted as signed
+  const __m128i max_continuation = _mm_set1_epi8(-65);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *) (bytes + i));
+    count += (size_t) __builtin_popcount((unsigned int) _mm_movemask_epi8(_mm_cmpgt_epi8(block, max_continuation)));
+  }
+  for (; i < len; i++) count += (signed char) bytes[i] > -65;
+  return count;
+}
+
+/// @brief The validation implementation - upgraded on startup to SSSE3 or AVX2 if the CPU supports it
+static PblUtf8ValidateFunc_T PBL_VALIDATE_UTF8_IMPL = PblValidateUtf8Scalar;
+
+__attribute__((unused))
+__attribute__((constructor))
+__attribute__((deprecated("Compiler-Only Function - User Call Invalid!")))
+static void PBL_CONSTRUCTOR_STRING_UTF8_INIT(void) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    PBL_VALIDATE_UTF8_IMPL = PblValidateUtf8Avx2;
+  } else if (__builtin_cpu_supports("ssse3")) {
+    PBL_VALIDATE_UTF8_IMPL = PblValidateUtf8Ssse3;
+  }
+}
+#else
+/// @brief Counts the bytes that are not UTF-8 continuation bytes (10xxxxxx)
+static size_t PblCountUtf8LeadBytes(const char *bytes, size_t len) {
+  size_t count = 0;
+  for (size_t i = 0; i < len; i++) count += (signed char) bytes[i] > -65;
+  return count;
+}
+
+/// @brief The validation implementation - no SIMD implementation is available for this target
+static PblUtf8ValidateFunc_T PBL_VALIDATE_UTF8_IMPL = PblValidateUtf8Scalar;
+#endif
+
+bool PblValidateUtf8(const char *bytes, size_t len) {
+  if (len == 0) return true;
+  // Validate the pointer for safety measures
+  bytes = PblValPtr((void *) bytes);
+
+  return PBL_VALIDATE_UTF8_IMPL(bytes, len);
+}
+
+/// @brief Classifies the content of the string and caches the result in 'utf8_state'
+static uint8_t PblGetStringUtf8State(PblString_T *str) {
+  if (str->actual.utf8_state == PBL_STRING_UTF8_UNKNOWN) {
+    const char *bytes = PblGetStringBytes(str);
+    size_t len = str->actual.len->actual;
+    if (PblIsAsciiBytes(bytes, len)) {
+      str->actual.utf8_state = PBL_STRING_UTF8_ASCII;
+    } else {
+      str->actual.utf8_state = PblValidateUtf8(bytes, len) ? PBL_STRING_UTF8_VALID : PBL_STRING_UTF8_INVALID;
+    }
+  }
+  return str->actual.utf8_state;
+}
+
+bool PblStringIsValidUtf8(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  return PblGetStringUtf8State(str) != PBL_STRING_UTF8_INVALID;
+}
+
+bool PblStringIsAscii(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  return PblGetStringUtf8State(str) == PBL_STRING_UTF8_ASCII;
+}
+
+size_t PblStringCodepointLen(PblString_T *str) {
+  // Validate the pointer for safety measures
+  str = PblValPtr((void *) str);
+
+  size_t len = str->actual.len->actual;
+  switch (PblGetStringUtf8State(str)) {
+    case PBL_STRING_UTF8_ASCII:
+      return len;
+    case PBL_STRING_UTF8_VALID:
+      // Every codepoint has exactly one byte that is not a continuation byte
+      return PblCountUtf8LeadBytes(PblGetStringBytes(str), len);
+    default: {
+      // Invalid content has to be decoded, so the count matches what the iterator yields
+      PblCodepointIter_T iter = PblStringCodepoints(PblGetStringViewT(str));
+      uint32_t codepoint;
+      size_t count = 0;
+      while (PblCodepointIterNext(&iter, &codepoint)) count++;
+      return count;
+    }
+  }
+}
+
+PblCodepointIter_T PblStringCodepoints(PblStringView_T source) {
+  return (PblCodepointIter_T){.source = source, .pos = 0};
+}
+
+bool PblCodepointIterNext(PblCodepointIter_T *iter, uint32_t *codepoint) {
+  // Validate the pointer for safety measures
+  iter = PblValPtr((void *) iter);
+  codepoint = PblValPtr((void *) codepoint);
+
+  if (iter->pos >= iter->source.actual.len) return false;
+
+  const unsigned char *bytes = (const unsigned char *) iter->source.actual.ptr + iter->pos;
+  size_t seq_len = PblDecodeUtf8Sequence(bytes, iter->source.actual.len - iter->pos, codepoint);
+  if (seq_len == 0) {
+    // Skipping only the first byte, so the decoding re-synchronises on the next valid sequence
+    *codepoint = PBL_UNICODE_REPLACEMENT_CHAR;
+    seq_len = 1;
+  }
+  iter->pos += seq_len;
+  return true;
+}
+
+// ---- End of Unicode Functions --------------------------------------------------------------------------------------
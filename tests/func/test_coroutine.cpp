@@ -0,0 +1,260 @@
+///
+/// Testing for the header pbl-coroutine.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/func/pbl-coroutine.h>
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncCount,, std::vector<int> *log, int id, int steps)
+
+PblInt_T *AsyncCount_Base(std::vector<int> *log, int id, int steps) {
+  for (int i = 0; i < steps; i++) {
+    log->push_back(id);
+    PblYield();
+  }
+  return PblGetIntT(id * 10);
+}
+
+PblInt_T *AsyncCount_Overhead(struct AsyncCount_Args in) { return AsyncCount_Base(in.log, in.id, in.steps); }
+
+TEST(CoroutineTest, YieldInterleaves) {
+  PblScheduler_T *scheduler = PblSchedulerCreate();
+  std::vector<int> log;
+  PblCoroutine_T *first = PblAsync(scheduler, AsyncCount, .log = &log, .id = 1, .steps = 3);
+  PblCoroutine_T *second = PblAsync(scheduler, AsyncCount, .log = &log, .id = 2, .steps = 3);
+  EXPECT_EQ(first->actual.state, PBL_COROUTINE_READY);
+  EXPECT_EQ(first->actual.descriptor, &AsyncCount_Descriptor);
+
+  PblSchedulerRun(scheduler);
+  EXPECT_EQ(log, std::vector<int>({1, 2, 1, 2, 1, 2}));
+  EXPECT_EQ(first->actual.state, PBL_COROUTINE_DONE);
+  EXPECT_EQ(first->actual.frame, nullptr);
+  EXPECT_EQ(((PblInt_T *) PblAwait(first))->actual, 10);
+  EXPECT_EQ(((PblInt_T *) PblAwait(second))->actual, 20);
+  EXPECT_EQ(PblCoroutineCurrent(), nullptr);
+  PblSchedulerDestroy(scheduler);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncOuter,, PblScheduler_T *scheduler, int depth)
+
+PblInt_T *AsyncOuter_Base(PblScheduler_T *scheduler, int depth) {
+  EXPECT_NE(PblCoroutineCurrent(), nullptr);
+  if (depth == 0) {
+    PblYield();
+    return PblGetIntT(0);
+  }
+
+  // Awaiting a coroutine suspends this one until the awaited one returned
+  PblCoroutine_T *inner = PblAsync(scheduler, AsyncOuter, .scheduler = scheduler, .depth = depth - 1);
+  auto *result = (PblInt_T *) PblAwait(inner);
+  EXPECT_EQ(inner->actual.state, PBL_COROUTINE_DONE);
+  return PblGetIntT(result->actual + 1);
+}
+
+PblInt_T *AsyncOuter_Overhead(struct AsyncOuter_Args in) { return AsyncOuter_Base(in.scheduler, in.depth); }
+
+TEST(CoroutineTest, AwaitNested) {
+  PblScheduler_T *scheduler = PblSchedulerCreate(.stack_size = 16 * 1024);
+  EXPECT_EQ(scheduler->actual.stack_size % sysconf(_SC_PAGESIZE), 0);
+
+  // Awaiting outside of a coroutine runs the scheduler until the coroutine is done
+  PblCoroutine_T *outer = PblAsync(scheduler, AsyncOuter, .scheduler = scheduler, .depth = 50);
+  auto *result = (PblInt_T *) PblAwait(outer);
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->actual, 50);
+  PblSchedulerDestroy(scheduler);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncTick,, long *counter)
+
+PblInt_T *AsyncTick_Base(long *counter) {
+  for (int i = 0; i < 3; i++) {
+    (*counter)++;
+    PblYield();
+  }
+  return nullptr;
+}
+
+PblInt_T *AsyncTick_Overhead(struct AsyncTick_Args in) { return AsyncTick_Base(in.counter); }
+
+TEST(CoroutineTest, ManyCoroutines) {
+  PblScheduler_T *scheduler = PblSchedulerCreate();
+  const int amount = 10000;
+  long counter = 0;
+
+  // Every coroutine is suspended at the same time, and the stacks are reused by the second round
+  for (int round = 0; round < 2; round++) {
+    std::vector<PblCoroutine_T *> coroutines;
+    for (int i = 0; i < amount; i++) coroutines.push_back(PblAsync(scheduler, AsyncTick, .counter = &counter));
+    PblSchedulerRun(scheduler);
+    for (PblCoroutine_T *coroutine : coroutines) ASSERT_EQ(coroutine->actual.state, PBL_COROUTINE_DONE);
+  }
+  EXPECT_EQ(counter, 2L * amount * 3);
+  PblSchedulerDestroy(scheduler);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblString_T *, AsyncReadSlice,, PblIOStream_T *stream, int64_t offset)
+
+PblString_T *AsyncReadSlice_Base(PblIOStream_T *stream, int64_t offset) {
+  char buffer[4];
+  int64_t read = PblAwaitRead(stream, buffer, sizeof(buffer), offset);
+  EXPECT_EQ(read, (int64_t) sizeof(buffer));
+  return PblGetStringT(std::string(buffer, sizeof(buffer)).c_str());
+}
+
+PblString_T *AsyncReadSlice_Overhead(struct AsyncReadSlice_Args in) {
+  return AsyncReadSlice_Base(in.stream, in.offset);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncWriteAll,, PblIOStream_T *stream, const char *content)
+
+PblInt_T *AsyncWriteAll_Base(PblIOStream_T *stream, const char *content) {
+  return PblGetIntT(PblAwaitWrite(stream, content, strlen(content), 0));
+}
+
+PblInt_T *AsyncWriteAll_Overhead(struct AsyncWriteAll_Args in) { return AsyncWriteAll_Base(in.stream, in.content); }
+
+TEST(CoroutineTest, AwaitStreamIO) {
+  char path[] = "/tmp/pbl-test-coroutine-XXXXXX";
+  close(mkstemp(path));
+  std::string content;
+  for (int i = 0; i < 100; i++) content += "#" + std::string(i < 10 ? "00" : "0") + std::to_string(i);
+  content = content.substr(0, 400);
+
+  PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.backend = PBL_ASYNC_IO_BACKEND_THREAD_POOL);
+  PblScheduler_T *scheduler = PblSchedulerCreate(.engine = engine);
+  PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path), .mode = PblGetStringT("r+"));
+
+  PblCoroutine_T *writer = PblAsync(scheduler, AsyncWriteAll, .stream = stream, .content = content.c_str());
+  EXPECT_EQ(((PblInt_T *) PblAwait(writer))->actual, (int) content.size());
+
+  // Every coroutine waits for its own read, which are in flight at the same time
+  std::vector<PblCoroutine_T *> readers;
+  for (int i = 0; i < 100; i++)
+    readers.push_back(PblAsync(scheduler, AsyncReadSlice, .stream = stream, .offset = i * 4));
+  PblSchedulerRun(scheduler);
+  for (int i = 0; i < 100; i++) {
+    auto *slice = (PblString_T *) readers[i]->actual.result;
+    ASSERT_NE(slice, nullptr);
+    EXPECT_EQ(std::string(PblGetStringBytes(slice)), content.substr(i * 4, 4));
+  }
+
+  PblSchedulerDestroy(scheduler);
+  PblAsyncIODestroyEngine(engine);
+  PblStreamClose(stream);
+  unlink(path);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncAwaitOther,, PblCoroutine_T **other)
+
+PblInt_T *AsyncAwaitOther_Base(PblCoroutine_T **other) {
+  PblAwait(*other);
+  ADD_FAILURE() << "The awaited coroutine can never finish";
+  return nullptr;
+}
+
+PblInt_T *AsyncAwaitOther_Overhead(struct AsyncAwaitOther_Args in) { return AsyncAwaitOther_Base(in.other); }
+
+TEST(CoroutineTest, DestroyCancelsUnfinished) {
+  PblScheduler_T *scheduler = PblSchedulerCreate();
+
+  // Both coroutines wait for each other, so the scheduler stops with both of them suspended
+  PblCoroutine_T *first = nullptr, *second = nullptr;
+  first = PblAsync(scheduler, AsyncAwaitOther, .other = &second);
+  second = PblAsync(scheduler, AsyncAwaitOther, .other = &first);
+  PblSchedulerRun(scheduler);
+  EXPECT_EQ(first->actual.state, PBL_COROUTINE_SUSPENDED);
+  EXPECT_EQ(second->actual.state, PBL_COROUTINE_SUSPENDED);
+
+  PblSchedulerDestroy(scheduler);
+  EXPECT_EQ(scheduler->actual.state, nullptr);
+  for (PblCoroutine_T *coroutine : {first, second}) {
+    EXPECT_EQ(coroutine->actual.state, PBL_COROUTINE_CANCELLED);
+    EXPECT_EQ(coroutine->actual.frame, nullptr);
+    EXPECT_EQ(coroutine->actual.scheduler, nullptr);
+    EXPECT_EQ(PblAwait(coroutine), nullptr);
+  }
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncAllocate,, int id, int rounds, std::atomic<int> *wrong)
+
+PblInt_T *AsyncAllocate_Base(int id, int rounds, std::atomic<int> *wrong) {
+  for (int i = 0; i < rounds; i++) {
+    // The value is only referenced by the suspended stack of the coroutine while the other thread collects
+    PblInt_T *value = PblGetIntT(id * 100000 + i);
+    for (int j = 0; j < 4; j++) PblGetStringT("garbage, which makes the collector run on this thread as well");
+    PblYield();
+    if (value->actual != id * 100000 + i) (*wrong)++;
+  }
+  return PblGetIntT(id);
+}
+
+PblInt_T *AsyncAllocate_Overhead(struct AsyncAllocate_Args in) {
+  return AsyncAllocate_Base(in.id, in.rounds, in.wrong);
+}
+
+TEST(CoroutineTest, CollectOnOtherThread) {
+  // Another thread collecting while this one switches stacks must neither deadlock nor miss a suspended stack
+  GC_allow_register_threads();
+  std::atomic<bool> stop{false};
+  std::atomic<long> collections{0};
+  std::thread collector([&]() {
+    struct GC_stack_base stack_base;
+    bool registered = GC_get_stack_base(&stack_base) == GC_SUCCESS && GC_register_my_thread(&stack_base) == GC_SUCCESS;
+    while (!stop) {
+      GC_gcollect();
+      collections++;
+    }
+    if (registered) GC_unregister_my_thread();
+  });
+
+  PblScheduler_T *scheduler = PblSchedulerCreate(.stack_size = 16 * 1024);
+  std::atomic<int> wrong{0};
+  std::vector<PblCoroutine_T *> coroutines;
+  for (int i = 0; i < 64; i++)
+    coroutines.push_back(PblAsync(scheduler, AsyncAllocate, .id = i, .rounds = 200, .wrong = &wrong));
+  PblSchedulerRun(scheduler);
+  stop = true;
+  collector.join();
+
+  EXPECT_EQ(wrong, 0);
+  EXPECT_GT(collections, 0);
+  for (int i = 0; i < 64; i++) {
+    ASSERT_EQ(coroutines[i]->actual.state, PBL_COROUTINE_DONE);
+    EXPECT_EQ(((PblInt_T *) coroutines[i]->actual.result)->actual, i);
+  }
+  PblSchedulerDestroy(scheduler);
+}
+
+PBL_CREATE_ASYNC_FUNC_OVERHEAD(PblInt_T *, AsyncRecurse,, int depth)
+
+PblInt_T *AsyncRecurse_Base(int depth) {
+  volatile char padding[1024];
+  padding[0] = (char) depth;
+  AsyncRecurse_Base(depth + 1);
+  return PblGetIntT(padding[0]);
+}
+
+PblInt_T *AsyncRecurse_Overhead(struct AsyncRecurse_Args in) { return AsyncRecurse_Base(in.depth); }
+
+TEST(CoroutineTest, GuardPageStopsOverflow) {
+  // Overflowing the stack of a coroutine faults on the guard page instead of overwriting the memory below
+  EXPECT_DEATH(
+    {
+      PblScheduler_T *scheduler = PblSchedulerCreate(.stack_size = 16 * 1024);
+      PblAsync(scheduler, AsyncRecurse, .depth = 0);
+      PblSchedulerRun(scheduler);
+    },
+    "");
+}
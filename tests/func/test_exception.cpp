@@ -5,6 +5,7 @@
 
 // Including the required GTest
 #include "gtest/gtest.h"
+#include <string>
 
 // Including the header to be tested
 #define PBL_DEBUG_VERBOSE
@@ -15,7 +16,8 @@ TEST(FunctionMetaTest, PblMetaFunctionCallCtxDefaults) {
   PBL_DECLARE_VAR(v_1, PblFunctionCallMetaData_T);
 
   EXPECT_EQ(PblFunctionCallMetaData_T_Size, sizeof(PblBool_T *) + sizeof(PblUInt_T *) + sizeof(PblBool_T *) +
-                                              2 * sizeof(PblFunctionCallMetaData_T *) + sizeof(nullptr));
+                                              2 * sizeof(PblFunctionCallMetaData_T *) + sizeof(nullptr) +
+                                              sizeof(const PblFunctionDescriptor_T *));
   EXPECT_EQ(v_1->meta.defined, false);
 
   PBL_DEFINE_VAR(v_2, PblFunctionCallMetaData_T);
@@ -27,14 +29,16 @@ TEST(FunctionMetaTest, PblMetaFunctionCallCtxDefaults) {
   EXPECT_TRUE(v_2->actual.arg_amount == nullptr);
   EXPECT_TRUE(v_2->actual.function_identifier == nullptr);
   EXPECT_EQ(PblFunctionCallMetaData_T_Size, sizeof(PblBool_T *) + sizeof(PblUInt_T *) + sizeof(PblBool_T *) +
-                                              2 * sizeof(PblFunctionCallMetaData_T *) + sizeof(nullptr));
+                                              2 * sizeof(PblFunctionCallMetaData_T *) + sizeof(nullptr) +
+                                              sizeof(const PblFunctionDescriptor_T *));
   EXPECT_TRUE(v_2->meta.defined);
 }
 
 TEST(ExceptionTest, PblExceptionDefaults) {
   PBL_DECLARE_VAR(v_1, PblException_T);
 
-  EXPECT_EQ(PblException_T_Size, 4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *));
+  EXPECT_EQ(PblException_T_Size, 4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *) +
+                                   sizeof(const PblRaiseSite_T *) + sizeof(PblExceptionClass_T *));
   EXPECT_EQ(v_1->meta.defined, false);
 
   PBL_DEFINE_VAR(v_2, PblException_T);
@@ -46,7 +50,8 @@ TEST(ExceptionTest, PblExceptionDefaults) {
   EXPECT_TRUE(v_2->actual.filename == nullptr);
   EXPECT_TRUE(v_2->actual.line_content == nullptr);
   EXPECT_TRUE(v_2->actual.line == nullptr);
-  EXPECT_EQ(PblException_T_Size, 4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *));
+  EXPECT_EQ(PblException_T_Size, 4 * sizeof(PblString_T *) + sizeof(PblUInt_T *) + 2 * sizeof(void *) +
+                                   sizeof(const PblRaiseSite_T *) + sizeof(PblExceptionClass_T *));
   EXPECT_EQ(v_2->meta.defined, true);
 }
 
@@ -101,18 +106,18 @@ TEST(ExceptionTest, OneNestCall) {
   EXPECT_TRUE(this_call_meta->actual.call_origin_ctx == nullptr);
   PblString_T *default_name = PblGetStringT("test");
   EXPECT_TRUE(
-    PblCompareStringT(((PblException_T *) this_call_meta->actual.exception)->actual.msg, default_name)->actual);
+    PblCompareStringT(PblGetExceptionMsg((PblException_T *) this_call_meta->actual.exception), default_name)->actual);
   PblString_T *default_msg = PblGetStringT("TestException");
   EXPECT_TRUE(
-    PblCompareStringT(((PblException_T *) this_call_meta->actual.exception)->actual.name, default_msg)->actual);
+    PblCompareStringT(PblGetExceptionName((PblException_T *) this_call_meta->actual.exception), default_msg)->actual);
   PblString_T *default_filename = PblGetStringT(__FILE__);
   EXPECT_TRUE(
-    PblCompareStringT(((PblException_T *) this_call_meta->actual.exception)->actual.filename, default_filename)
+    PblCompareStringT(PblGetExceptionFilename((PblException_T *) this_call_meta->actual.exception), default_filename)
       ->actual);
   PblString_T *default_line_content = PblGetStringT("raise exception");
-  EXPECT_TRUE(
-    PblCompareStringT(((PblException_T *) this_call_meta->actual.exception)->actual.line_content, default_line_content)
-      ->actual);
+  EXPECT_TRUE(PblCompareStringT(PblGetExceptionLineContent((PblException_T *) this_call_meta->actual.exception),
+                                default_line_content)
+                ->actual);
 }
 
 PblInt_T *TestFunction2(PblFunctionCallMetaData_T *this_call_meta) {
@@ -195,4 +200,288 @@ TEST(ExceptionTest, TryExceptCallWithContinuation) {
   EXPECT_TRUE(this_call_meta->actual.call_origin_ctx == nullptr);
   EXPECT_EQ(r_1->meta.defined, true);
   EXPECT_EQ(r_1->actual, 1);
-}
\ No newline at end of file
+}
+// Creating the overhead and struct type for a function, which is only declared to test its descriptor
+PBL_CREATE_FUNC_OVERHEAD(PblInt_T *, DescriptorTestFunction,, PblInt_T *a, PblString_T *b, PblBool_T *c)
+
+PBL_CREATE_FUNC_DESCRIPTOR(DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_1)
+PBL_CREATE_FUNC_DESCRIPTOR(DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_12)
+
+PBL_CREATE_FUNC_DESCRIPTOR(DescribedTestFunction, PblInt_T *a, PblInt_T *b)
+/// @brief Function where the second argument is optional, so it may be called with less arguments than it takes
+PblInt_T *DescribedTestFunction(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *a, PblInt_T *b = nullptr) {
+  return PblGetIntT(b != nullptr ? a->actual + b->actual : a->actual);
+}
+
+TEST(FunctionDescriptorTest, StaticDescriptors) {
+  EXPECT_STREQ(DescribedTestFunction_Descriptor.name, "DescribedTestFunction");
+  EXPECT_EQ(DescribedTestFunction_Descriptor.arg_amount, 2);
+  EXPECT_STREQ(DescribedTestFunction_Descriptor.filename, __FILE__);
+  EXPECT_GT(DescribedTestFunction_Descriptor.line, 0);
+  EXPECT_FALSE(DescribedTestFunction_Descriptor.is_call_site);
+  EXPECT_EQ(DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_1_Descriptor.arg_amount, 0);
+
+  // 'PBL_CREATE_FUNC_OVERHEAD' creates the descriptor as well
+  EXPECT_STREQ(DescriptorTestFunction_Descriptor.name, "DescriptorTestFunction");
+  EXPECT_EQ(DescriptorTestFunction_Descriptor.arg_amount, 3);
+
+  // The ids calculated on compile time and runtime are equal, and differ between functions
+  EXPECT_EQ(DescribedTestFunction_Descriptor.id, PblGetFunctionId("DescribedTestFunction"));
+  EXPECT_EQ(DescriptorTestFunction_Descriptor.id, PblGetFunctionId("DescriptorTestFunction"));
+  EXPECT_NE(DescribedTestFunction_Descriptor.id, DescriptorTestFunction_Descriptor.id);
+  EXPECT_NE(DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_1_Descriptor.id,
+            DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_12_Descriptor.id);
+  EXPECT_EQ(DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_12_Descriptor.id,
+            PblGetFunctionId("DescriptorTestFunctionWithAVeryLongNameThatExceedsTheHashedCharsOfTheId_12"));
+}
+
+TEST(FunctionDescriptorTest, CallCtxReferencesDescriptor) {
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  // The ctx references the descriptor of the function, while the amount of arguments is the amount passed
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(DescribedTestFunction, r_1, H3, PblGetBoolT(false), this_call_meta, PblGetIntT(2));
+  EXPECT_EQ(r_1->actual, 2);
+  EXPECT_EQ(unique_id_DescribedTestFunction_CALLCTX->actual.descriptor, &DescribedTestFunction_Descriptor);
+  EXPECT_EQ(unique_id_DescribedTestFunction_CALLCTX->actual.arg_amount->actual, 1);
+  EXPECT_TRUE(PblStringEquals(unique_id_DescribedTestFunction_CALLCTX->actual.function_identifier,
+                              PblGetStringT("DescribedTestFunction")));
+}
+
+TEST(FunctionDescriptorTest, CallSiteDescriptor) {
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  // Functions without a descriptor are described by the call site, which has the id of the function
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(TestFunction, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  const PblFunctionDescriptor_T *descriptor = unique_id_TestFunction_CALLCTX->actual.descriptor;
+  ASSERT_NE(descriptor, nullptr);
+  EXPECT_TRUE(descriptor->is_call_site);
+  EXPECT_STREQ(descriptor->name, "TestFunction");
+  EXPECT_EQ(descriptor->id, PblGetFunctionId("TestFunction"));
+  EXPECT_STREQ(descriptor->filename, __FILE__);
+  EXPECT_EQ(unique_id_TestFunction_CALLCTX->actual.arg_amount->actual, 0);
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(LazyValidate, PblInt_T *value)
+PblInt_T *LazyValidate(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  if (value->actual < 0) PBL_RAISE_LAZY("ValueError", "negative value");
+  return value;
+}
+
+TEST(ExceptionTest, LazyRaise) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+
+  // Expected exceptions inside a loop only record the static raise site
+  size_t failures = 0;
+  for (int i = -50; i < 50; i++) {
+    this_call_meta->actual.is_failure = PblGetBoolT(false);
+    PBL_DECLARE_VAR(r_1, PblInt_T);
+    PBL_BASE_CALL_AND_CATCH_EXCEPTION(LazyValidate, r_1, H3, PblGetBoolT(false), this_call_meta, PblGetIntT(i));
+    if (this_call_meta->actual.is_failure->actual) {
+      failures++;
+      EXPECT_EQ(r_1, nullptr);
+    } else {
+      EXPECT_EQ(r_1->actual, i);
+    }
+  }
+  EXPECT_EQ(failures, 50);
+
+  PblException_T *exc = this_call_meta->actual.exception;
+  ASSERT_NE(exc, nullptr);
+  ASSERT_NE(exc->actual.site, nullptr);
+  EXPECT_EQ(exc->actual.msg, nullptr);
+  EXPECT_EQ(exc->actual.name, nullptr);
+
+  // The properties are created on the first access and kept afterwards
+  PblString_T *msg = PblGetExceptionMsg(exc);
+  EXPECT_STREQ(PblGetStringBytes(msg), "negative value");
+  EXPECT_EQ(PblGetExceptionMsg(exc), msg);
+  EXPECT_EQ(PblGetExceptionName(exc), PblInternCString("ValueError"));
+  EXPECT_STREQ(PblGetStringBytes(PblGetExceptionFilename(exc)), __FILE__);
+  EXPECT_EQ(PblGetExceptionLine(exc)->actual, exc->actual.site->line);
+  EXPECT_STREQ(PblGetStringBytes(PblGetExceptionLineContent(exc)),
+               "PBL_RAISE_LAZY(\"ValueError\", \"negative value\")");
+
+  // Exceptions created with all properties are returned as they are
+  PblException_T *eager = PblGetExceptionT(PblGetStringT("msg"), PblInternCString("Eager"), nullptr, nullptr, nullptr,
+                                           nullptr, nullptr);
+  EXPECT_EQ(PblGetExceptionMsg(eager), eager->actual.msg);
+  EXPECT_EQ(PblGetExceptionLine(eager), nullptr);
+}
+
+TEST(ExceptionTest, FormatTraceback) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+  EXPECT_EQ(PblFormatTraceback(this_call_meta), nullptr);
+
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(TestFunction, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  PblString_T *traceback = PblFormatTraceback(this_call_meta);
+  ASSERT_NE(traceback, nullptr);
+
+  // The most recent call is listed last, followed by the raise location and the exception
+  std::string content = PblGetStringBytes(traceback);
+  EXPECT_EQ(content.find("Traceback (most recent call last):\n  in TestFunction (called at "), 0);
+  size_t outer = content.find("  in TestFunction ");
+  size_t inner = content.find("  in NestedTestFunction ");
+  ASSERT_NE(inner, std::string::npos);
+  EXPECT_LT(outer, inner);
+  EXPECT_NE(content.find(": raise exception\nTestException: test\n"), std::string::npos);
+}
+
+PBL_DEFINE_EXCEPTION_CLASS(LookupError, PblBaseException)
+PBL_DEFINE_EXCEPTION_CLASS(KeyError, LookupError)
+PBL_DEFINE_EXCEPTION_CLASS(IndexError, LookupError)
+PBL_DEFINE_EXCEPTION_CLASS(ArithmeticError, PblBaseException)
+
+TEST(ExceptionClassTest, Hierarchy) {
+  EXPECT_TRUE(PblIsExceptionSubclass(&KeyError, &KeyError));
+  EXPECT_TRUE(PblIsExceptionSubclass(&KeyError, &LookupError));
+  EXPECT_TRUE(PblIsExceptionSubclass(&KeyError, &PblBaseException));
+  EXPECT_FALSE(PblIsExceptionSubclass(&LookupError, &KeyError));
+  EXPECT_FALSE(PblIsExceptionSubclass(&KeyError, &IndexError));
+  EXPECT_FALSE(PblIsExceptionSubclass(&ArithmeticError, &LookupError));
+
+  // Classes are registered on their first use and get unique ids
+  EXPECT_NE(KeyError.id, 0);
+  EXPECT_NE(KeyError.id, IndexError.id);
+  EXPECT_EQ(KeyError.depth, 2);
+  EXPECT_EQ(KeyError.display[1], LookupError.id);
+  EXPECT_EQ(KeyError.display[0], PblBaseException.id);
+
+  // Exceptions without a class are instances of the root class
+  PblException_T *exc = PblGetExceptionT(PblGetStringT("msg"), PblInternCString("Plain"), nullptr, nullptr, nullptr,
+                                         nullptr, nullptr);
+  EXPECT_TRUE(PblIsExceptionInstance(exc, &PblBaseException));
+  EXPECT_FALSE(PblIsExceptionInstance(exc, &LookupError));
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(RaiseKeyError, PblInt_T *key)
+PblInt_T *RaiseKeyError(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *key) {
+  PBL_RAISE_CLASS(KeyError, "missing key");
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(CatchLookupError)
+PblInt_T *CatchLookupError(PblFunctionCallMetaData_T *this_call_meta) {
+  PBL_TRY_EXCEPT_BLOCK(
+    {
+      PBL_DECLARE_VAR(r_1, PblInt_T);
+      PBL_CALL_FUNC_IN_TRY_EXCEPT_BLOCK(RaiseKeyError, r_1, PblInt_T *, X1, Y2, PblGetIntT(1))
+      return r_1;
+    },
+    {
+      PBL_EXCEPT_CLASS_BLOCK(ArithmeticError, { return PblGetIntT(1); }, Y2)
+      PBL_EXCEPT_CLASS_BLOCK(LookupError, { return PblGetIntT(2); }, Y2)
+      PBL_EXCEPT_CLASS_BLOCK(PblBaseException, { return PblGetIntT(3); }, Y2)
+    },
+    Y2, this_call_meta, PblInt_T);
+  return PblGetIntT(0);
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(CatchIndexError)
+PblInt_T *CatchIndexError(PblFunctionCallMetaData_T *this_call_meta) {
+  PBL_TRY_EXCEPT_BLOCK(
+    {
+      PBL_DECLARE_VAR(r_1, PblInt_T);
+      PBL_CALL_FUNC_IN_TRY_EXCEPT_BLOCK(RaiseKeyError, r_1, PblInt_T *, X1, Y2, PblGetIntT(1))
+      return r_1;
+    },
+    {PBL_EXCEPT_CLASS_BLOCK(IndexError, { return PblGetIntT(1); }, Y2)},
+    Y2, this_call_meta, PblInt_T);
+  return PblGetIntT(0);
+}
+
+TEST(ExceptionClassTest, ExceptByClass) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  // The first clause whose class is a parent of the exception class handles it
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(CatchLookupError, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  EXPECT_FALSE(this_call_meta->actual.is_failure->actual);
+  ASSERT_NE(r_1, nullptr);
+  EXPECT_EQ(r_1->actual, 2);
+}
+
+TEST(ExceptionClassTest, UnhandledExceptionPropagates) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  // No clause matches, so the exception is passed on to the caller including its origin
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(CatchIndexError, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  EXPECT_EQ(r_1, nullptr);
+  ASSERT_TRUE(this_call_meta->actual.is_failure->actual);
+  PblException_T *exc = this_call_meta->actual.exception;
+  ASSERT_NE(exc, nullptr);
+  EXPECT_EQ(exc->actual.exc_class, &KeyError);
+  EXPECT_EQ(PblGetExceptionName(exc), PblInternCString("KeyError"));
+  EXPECT_TRUE(PblIsExceptionInstance(exc, &LookupError));
+
+  auto *origin = (PblFunctionCallMetaData_T *) this_call_meta->actual.failure_origin_ctx;
+  ASSERT_NE(origin, nullptr);
+  EXPECT_STREQ(PblGetStringBytes(origin->actual.function_identifier), "RaiseKeyError");
+}
+
+static const PblRaiseSite_T ReusedSite = {
+  .exc_class = &KeyError, .name = nullptr, .msg = "reused", .filename = nullptr, .line = 0, .line_content = nullptr};
+
+TEST(ExceptionPoolTest, RecycleDeallocatedExceptions) {
+  PblException_T *first = PblGetExceptionT(PblGetStringT("msg"), PblInternCString("Pooled"), nullptr, nullptr,
+                                           nullptr, nullptr, nullptr);
+  PblDeallocateExceptionT(first);
+  EXPECT_FALSE(first->meta.defined);
+
+  // The next exception reuses the deallocated one and is initialised completely
+  PblException_T *second = PblGetLazyExceptionT(&ReusedSite);
+  EXPECT_EQ(second, first);
+  EXPECT_TRUE(second->meta.defined);
+  EXPECT_EQ(second->actual.msg, nullptr);
+  EXPECT_EQ(second->actual.exc_class, &KeyError);
+  EXPECT_STREQ(PblGetStringBytes(PblGetExceptionMsg(second)), "reused");
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(RaiseOutOfMemory)
+PblInt_T *RaiseOutOfMemory(PblFunctionCallMetaData_T *this_call_meta) {
+  PBL_RAISE_PREALLOCATED(PblOutOfMemoryException);
+}
+
+TEST(ExceptionPoolTest, PreallocatedExceptions) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(RaiseOutOfMemory, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  ASSERT_TRUE(this_call_meta->actual.is_failure->actual);
+  PblException_T *exc = this_call_meta->actual.exception;
+  EXPECT_EQ(exc, &PblOutOfMemoryException);
+  EXPECT_TRUE(PblIsExceptionInstance(exc, &PblMemoryError));
+  EXPECT_EQ(PblGetExceptionName(exc), PblInternCString("PblMemoryError"));
+  EXPECT_STREQ(PblGetStringBytes(PblGetExceptionMsg(exc)), "Out of memory");
+
+  // Preallocated exceptions are shared between threads, so the lazy getters never write into them
+  EXPECT_EQ(exc->actual.name, nullptr);
+  EXPECT_EQ(exc->actual.msg, nullptr);
+  EXPECT_EQ(exc->actual.line, nullptr);
+
+  // Preallocated exceptions are shared, so they are never deallocated or recycled
+  PblDeallocateExceptionT(exc);
+  EXPECT_TRUE(PblOutOfMemoryException.meta.defined);
+  EXPECT_TRUE(PblNullAccessException.meta.defined);
+  EXPECT_TRUE(PblIsExceptionInstance(&PblNullAccessException, &PblNullAccessError));
+  EXPECT_FALSE(PblIsExceptionInstance(&PblNullAccessException, &PblMemoryError));
+
+  // The failure flag of a ctx may be shared with other ctxs, so raising replaces it instead of setting it
+  PblBool_T *no_failure = PblGetBoolT(false);
+  PblFunctionCallMetaData_T *ctx_1 =
+    PblGetMetaFunctionCallCtxT(nullptr, no_failure, PblGetUIntT(0), PblGetBoolT(false), nullptr, nullptr, nullptr);
+  PblFunctionCallMetaData_T *ctx_2 =
+    PblGetMetaFunctionCallCtxT(nullptr, no_failure, PblGetUIntT(0), PblGetBoolT(false), nullptr, nullptr, nullptr);
+  PblRaiseNewException(ctx_1, &PblNullAccessException);
+  EXPECT_TRUE(ctx_1->actual.is_failure->actual);
+  EXPECT_FALSE(ctx_2->actual.is_failure->actual);
+  EXPECT_FALSE(no_failure->actual);
+}
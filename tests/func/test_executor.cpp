@@ -0,0 +1,142 @@
+///
+/// Testing for the header pbl-executor.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <string>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/func/pbl-executor.h>
+
+PBL_CREATE_SPAWN_FUNC(PblInt_T *, ExecutorSquare, PblInt_T *i)
+PblInt_T *ExecutorSquare(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *i) {
+  EXPECT_TRUE(this_call_meta->actual.is_threaded->actual);
+  EXPECT_EQ(this_call_meta->actual.descriptor, &ExecutorSquare_Descriptor);
+  return PblGetIntT(i->actual * i->actual);
+}
+
+TEST(ExecutorTest, SpawnAndAwait) {
+  PblExecutor_T *executor = PblExecutorCreate(.threads = 4);
+  EXPECT_EQ(executor->actual.threads, 4);
+
+  const int amount = 1000;
+  PblFuture_T *futures[amount];
+  for (int i = 0; i < amount; i++) futures[i] = PblSpawn(executor, ExecutorSquare, PblGetIntT(i));
+
+  long long sum = 0, expected = 0;
+  for (int i = 0; i < amount; i++) {
+    auto *result = (PblInt_T *) PblFutureAwait(futures[i], nullptr);
+    ASSERT_NE(result, nullptr);
+    sum += result->actual;
+    expected += (long long) i * i;
+    EXPECT_TRUE(PblFutureIsDone(futures[i]));
+    EXPECT_FALSE(futures[i]->actual.ctx->actual.is_failure->actual);
+  }
+  EXPECT_EQ(sum, expected);
+
+  PblExecutorShutdown(executor);
+  EXPECT_EQ(executor->actual.state, nullptr);
+}
+
+PBL_CREATE_SPAWN_FUNC(PblString_T *, ExecutorGreeting)
+PblString_T *ExecutorGreeting(PblFunctionCallMetaData_T *this_call_meta) {
+  EXPECT_EQ(this_call_meta->actual.descriptor->arg_amount, 0);
+  return PblGetStringT("hello");
+}
+
+PBL_CREATE_SPAWN_FUNC(PblDouble_T *, ExecutorWeightedSum, PblInt_T *a, PblLongDouble_T *b, PblChar_T *c, PblInt_T *d)
+PblDouble_T *ExecutorWeightedSum(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *a, PblLongDouble_T *b,
+                                 PblChar_T *c, PblInt_T *d) {
+  return PblGetDoubleT((double) a->actual + (double) b->actual * 2 + c->actual * 3 + d->actual * 4);
+}
+
+TEST(ExecutorTest, TypedArguments) {
+  PblExecutor_T *executor = PblExecutorCreate(.threads = 2);
+  PblFuture_T *greeting = PblSpawn(executor, ExecutorGreeting);
+  PblFuture_T *sum = PblSpawn(executor, ExecutorWeightedSum, PblGetIntT(1), PblGetLongDoubleT(0.5L), PblGetCharT(2),
+                              PblGetIntT(3));
+
+  auto *greeting_result = (PblString_T *) PblFutureAwait(greeting, nullptr);
+  ASSERT_NE(greeting_result, nullptr);
+  EXPECT_STREQ(PblGetStringBytes(greeting_result), "hello");
+  auto *sum_result = (PblDouble_T *) PblFutureAwait(sum, nullptr);
+  ASSERT_NE(sum_result, nullptr);
+  EXPECT_EQ(sum_result->actual, 20.0);
+  PblExecutorShutdown(executor);
+}
+
+PBL_CREATE_SPAWN_FUNC(PblInt_T *, ExecutorFib, PblExecutor_T *executor, PblInt_T *n)
+PblInt_T *ExecutorFib(PblFunctionCallMetaData_T *this_call_meta, PblExecutor_T *executor, PblInt_T *n) {
+  if (n->actual < 2) return n;
+
+  // Spawning one half and computing the other, where the waiting worker runs other tasks until the future is done
+  PblFuture_T *future = PblSpawn(executor, ExecutorFib, executor, PblGetIntT(n->actual - 1));
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_CALL_FUNC_AND_CATCH(ExecutorFib, r_1, X1, executor, PblGetIntT(n->actual - 2));
+
+  PBL_DECLARE_VAR(r_2, PblInt_T);
+  PBL_AWAIT_AND_CATCH(future, r_2);
+  return PblGetIntT(r_1->actual + r_2->actual);
+}
+
+TEST(ExecutorTest, NestedSpawn) {
+  PblExecutor_T *executor = PblExecutorCreate(.threads = 3);
+  PblFuture_T *future = PblSpawn(executor, ExecutorFib, executor, PblGetIntT(18));
+
+  auto *result = (PblInt_T *) PblFutureAwait(future, nullptr);
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->actual, 2584);
+  PblExecutorShutdown(executor);
+}
+
+PBL_CREATE_SPAWN_FUNC(PblInt_T *, ExecutorRaise, PblInt_T *i)
+PblInt_T *ExecutorRaise(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *i) {
+  PblException_T *exception =
+    PblGetExceptionT(PblGetStringT("test"), PblInternCString("ExecutorException"), PblGetStringT(__FILE__),
+                     PblGetUIntT(__LINE__), PblGetStringT("raise exception"), nullptr, nullptr);
+  PBL_RAISE_EXCEPTION(exception, PblInt_T);
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(ExecutorAwaitRaise, PblExecutor_T *executor)
+PblInt_T *ExecutorAwaitRaise(PblFunctionCallMetaData_T *this_call_meta, PblExecutor_T *executor) {
+  PblFuture_T *future = PblSpawn(executor, ExecutorRaise, PblGetIntT(1));
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_AWAIT_AND_CATCH(future, r_1);
+  ADD_FAILURE() << "The exception of the spawned function was not passed on";
+  return r_1;
+}
+
+TEST(ExecutorTest, ExceptionPropagation) {
+  PblExecutor_T *executor = PblExecutorCreate(.threads = 2);
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(ExecutorAwaitRaise, r_1, H3, PblGetBoolT(false), this_call_meta, executor);
+  ASSERT_TRUE(this_call_meta->actual.is_failure->actual);
+  ASSERT_NE(this_call_meta->actual.exception, nullptr);
+  EXPECT_TRUE(
+    PblStringEquals(PblGetExceptionName(this_call_meta->actual.exception), PblInternCString("ExecutorException")));
+
+  // The origin is the ctx of the spawned function, which is linked to the ctx of the waiting function
+  auto *origin = (PblFunctionCallMetaData_T *) this_call_meta->actual.failure_origin_ctx;
+  ASSERT_NE(origin, nullptr);
+  EXPECT_EQ(origin->actual.descriptor, &ExecutorRaise_Descriptor);
+  EXPECT_TRUE(origin->actual.is_threaded->actual);
+  auto *waiting = (PblFunctionCallMetaData_T *) origin->actual.call_origin_ctx;
+  ASSERT_NE(waiting, nullptr);
+  EXPECT_EQ(waiting->actual.descriptor, &ExecutorAwaitRaise_Descriptor);
+
+  std::string traceback = PblGetStringBytes(PblFormatTraceback(this_call_meta));
+  size_t waiting_pos = traceback.find("\n  in ExecutorAwaitRaise (declared at ");
+  size_t raise_pos = traceback.find("\n  in ExecutorRaise (declared at ");
+  ASSERT_NE(waiting_pos, std::string::npos);
+  ASSERT_NE(raise_pos, std::string::npos);
+  EXPECT_LT(waiting_pos, raise_pos);
+
+  PblExecutorShutdown(executor);
+}
@@ -0,0 +1,215 @@
+///
+/// Testing for the header pbl-memoize.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/func/pbl-memoize.h>
+
+static std::atomic<int> resolve_calls{0};
+
+PBL_CREATE_FUNC_OVERHEAD(PblString_T *, MemoResolve,, PblString_T *key, PblInt_T *level, int scale)
+
+PblString_T *MemoResolve_Base(PblString_T *key, PblInt_T *level, int scale) {
+  resolve_calls++;
+  std::string result = std::string(PblGetStringBytes(key)) + "@" + std::to_string(level->actual * scale);
+  return PblGetStringT(result.c_str());
+}
+
+PblString_T *MemoResolve_Overhead(struct MemoResolve_Args in) {
+  // The default level is applied by the overhead, meaning a NULL level is a key of its own
+  if (in.level == NULL) in.level = PblGetIntT(1);
+  return MemoResolve_Base(in.key, in.level, in.scale);
+}
+
+PBL_MEMOIZE(PblString_T *, MemoResolve, 1024, key, level, scale)
+
+TEST(MemoizeTest, HitsSkipTheFunction) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoResolve));
+  resolve_calls = 0;
+
+  PblString_T *first = PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .level = PblGetIntT(2), .scale = 3);
+  EXPECT_STREQ(PblGetStringBytes(first), "db.host@6");
+  EXPECT_EQ(resolve_calls, 1);
+
+  // Distinct objects with equal values are the same key, which returns the cached result
+  for (int i = 0; i < 100; i++) {
+    PblString_T *again = PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .level = PblGetIntT(2), .scale = 3);
+    EXPECT_EQ(again, first);
+  }
+  EXPECT_EQ(resolve_calls, 1);
+
+  // Every field is part of the key
+  PblMemoized(MemoResolve, .key = PblGetStringT("db.port"), .level = PblGetIntT(2), .scale = 3);
+  PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .level = PblGetIntT(3), .scale = 3);
+  PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .level = PblGetIntT(2), .scale = 4);
+  PblString_T *defaulted = PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .scale = 3);
+  EXPECT_STREQ(PblGetStringBytes(defaulted), "db.host@3");
+  EXPECT_EQ(resolve_calls, 5);
+  EXPECT_EQ(PblMemoized(MemoResolve, .key = PblGetStringT("db.host"), .scale = 3), defaulted);
+  EXPECT_EQ(resolve_calls, 5);
+
+  PblMemoStats_T stats;
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoResolve), &stats);
+  EXPECT_EQ(stats.hits, 101);
+  EXPECT_EQ(stats.misses, 5);
+  EXPECT_EQ(stats.evictions, 0);
+  EXPECT_EQ(stats.size, 5);
+
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoResolve));
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoResolve), &stats);
+  EXPECT_EQ(stats.hits, 0);
+  EXPECT_EQ(stats.size, 0);
+}
+
+TEST(MemoizeTest, KeysAreCopied) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoResolve));
+  resolve_calls = 0;
+
+  // Writing to the string of the caller does not change the cached key
+  PblString_T *key = PblGetStringT("db.user");
+  PblString_T *first = PblMemoized(MemoResolve, .key = key, .level = PblGetIntT(1), .scale = 1);
+  PblWriteCharArrayToStringT(key, PblGetCharTArray("db.pass"), PblGetUIntT(7));
+  EXPECT_EQ(PblMemoized(MemoResolve, .key = PblGetStringT("db.user"), .level = PblGetIntT(1), .scale = 1), first);
+  EXPECT_EQ(resolve_calls, 1);
+  PblString_T *changed = PblMemoized(MemoResolve, .key = key, .level = PblGetIntT(1), .scale = 1);
+  EXPECT_STREQ(PblGetStringBytes(changed), "db.pass@1");
+  EXPECT_EQ(resolve_calls, 2);
+}
+
+static int square_calls = 0;
+
+PBL_CREATE_FUNC_OVERHEAD(PblDouble_T *, MemoSquare,, PblDouble_T *val)
+
+PblDouble_T *MemoSquare_Base(PblDouble_T *val) {
+  square_calls++;
+  return PblGetDoubleT(val->actual * val->actual);
+}
+
+PblDouble_T *MemoSquare_Overhead(struct MemoSquare_Args in) { return MemoSquare_Base(in.val); }
+
+PBL_MEMOIZE(PblDouble_T *, MemoSquare, 4, val)
+
+TEST(MemoizeTest, EvictsLeastRecentlyUsed) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoSquare));
+  square_calls = 0;
+
+  for (int i = 1; i <= 4; i++) PblMemoized(MemoSquare, .val = PblGetDoubleT(i));
+  EXPECT_EQ(square_calls, 4);
+
+  // Using 1 makes 2 the least recently used result, which is evicted by 5
+  PblMemoized(MemoSquare, .val = PblGetDoubleT(1));
+  EXPECT_EQ(PblMemoized(MemoSquare, .val = PblGetDoubleT(5))->actual, 25.0);
+  EXPECT_EQ(square_calls, 5);
+  PblMemoized(MemoSquare, .val = PblGetDoubleT(1));
+  PblMemoized(MemoSquare, .val = PblGetDoubleT(3));
+  EXPECT_EQ(square_calls, 5);
+  PblMemoized(MemoSquare, .val = PblGetDoubleT(2));
+  EXPECT_EQ(square_calls, 6);
+
+  PblMemoStats_T stats;
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoSquare), &stats);
+  EXPECT_EQ(stats.size, 4);
+  EXPECT_EQ(stats.evictions, 2);
+  EXPECT_EQ(stats.hits, 3);
+  EXPECT_EQ(stats.misses, 6);
+}
+
+static int scale_calls = 0;
+
+PBL_CREATE_FUNC_OVERHEAD(PblLongDouble_T *, MemoScale,, PblLongDouble_T *val, long double factor)
+
+PblLongDouble_T *MemoScale_Base(PblLongDouble_T *val, long double factor) {
+  scale_calls++;
+  return PblGetLongDoubleT(val->actual * factor);
+}
+
+PblLongDouble_T *MemoScale_Overhead(struct MemoScale_Args in) { return MemoScale_Base(in.val, in.factor); }
+
+PBL_MEMOIZE(PblLongDouble_T *, MemoScale, 16, val, factor)
+
+TEST(MemoizeTest, LongDoubleKeys) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoScale));
+  scale_calls = 0;
+
+  // Long doubles are compared by their full precision, where values rounding to the same double are different keys
+  long double base = 1.0L + LDBL_EPSILON;
+  PblLongDouble_T *first = PblMemoized(MemoScale, .val = PblGetLongDoubleT(base), .factor = 2.0L);
+  EXPECT_EQ(PblMemoized(MemoScale, .val = PblGetLongDoubleT(base), .factor = 2.0L), first);
+  EXPECT_EQ(scale_calls, 1);
+  PblMemoized(MemoScale, .val = PblGetLongDoubleT(1.0L), .factor = 2.0L);
+  PblMemoized(MemoScale, .val = PblGetLongDoubleT(base), .factor = 2.0L + LDBL_EPSILON * 2);
+  EXPECT_EQ(scale_calls, 3);
+}
+
+PBL_CREATE_FUNC_OVERHEAD(PblLongLong_T *, MemoFib,, int n)
+PBL_DECLARE_MEMOIZE(PblLongLong_T *, MemoFib)
+
+PblLongLong_T *MemoFib_Base(int n) {
+  if (n < 2) return PblGetLongLongT(n);
+
+  // The recursive calls are memoized as well, as the cache is not locked while the function runs
+  return PblGetLongLongT(PblMemoized(MemoFib, .n = n - 1)->actual + PblMemoized(MemoFib, .n = n - 2)->actual);
+}
+
+PblLongLong_T *MemoFib_Overhead(struct MemoFib_Args in) { return MemoFib_Base(in.n); }
+
+PBL_MEMOIZE(PblLongLong_T *, MemoFib, 256, n)
+
+TEST(MemoizeTest, RecursiveCalls) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoFib));
+  EXPECT_EQ(PblMemoized(MemoFib, .n = 90)->actual, 2880067194370816120LL);
+
+  PblMemoStats_T stats;
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoFib), &stats);
+  EXPECT_EQ(stats.misses, 91);
+  EXPECT_EQ(stats.size, 91);
+}
+
+static std::atomic<int> shared_calls{0};
+
+PBL_CREATE_FUNC_OVERHEAD(PblInt_T *, MemoShared,, PblUInt_T *id)
+
+PblInt_T *MemoShared_Base(PblUInt_T *id) {
+  shared_calls++;
+  return PblGetIntT((int) id->actual * 2);
+}
+
+PblInt_T *MemoShared_Overhead(struct MemoShared_Args in) { return MemoShared_Base(in.id); }
+
+PBL_MEMOIZE(PblInt_T *, MemoShared, 4096, id)
+
+TEST(MemoizeTest, SharedBetweenThreads) {
+  PblMemoClear(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoShared));
+  shared_calls = 0;
+  const unsigned int distinct = 500;
+  std::vector<std::thread> threads;
+  std::atomic<int> wrong{0};
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&, t]() {
+      for (unsigned int i = 0; i < 20000; i++) {
+        unsigned int id = (i * 7 + t) % distinct;
+        if (PblMemoized(MemoShared, .id = PblGetUIntT(id))->actual != (int) id * 2) wrong++;
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  EXPECT_EQ(wrong, 0);
+
+  // Threads missing the same key at the same time may both call the function, but only one result is kept
+  PblMemoStats_T stats;
+  PblMemoGetStats(&PBL_GET_FUNC_MEMO_CACHE_IDENTIFIER(MemoShared), &stats);
+  EXPECT_EQ(stats.size, distinct);
+  EXPECT_EQ(stats.evictions, 0);
+  EXPECT_EQ(stats.hits + stats.misses, 4 * 20000);
+  EXPECT_GE(shared_calls, (int) distinct);
+  EXPECT_EQ(stats.misses, (uint64_t) shared_calls);
+}
@@ -0,0 +1,212 @@
+///
+/// Testing for the header pbl-profile.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#define PBL_STACK_CALL_CTX
+#define PBL_PROFILE_CALLS
+#define PBL_TRACE_CALLS
+#include <libpbl/func/pbl-profile.h>
+
+PBL_CREATE_FUNC_DESCRIPTOR(ProfileLeaf, PblInt_T *value)
+PblInt_T *ProfileLeaf(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *value) {
+  if (value->actual < 0) PBL_RAISE_LAZY("ValueError", "negative value");
+  return value;
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(ProfileOuter)
+PblInt_T *ProfileOuter(PblFunctionCallMetaData_T *this_call_meta) {
+  int sum = 0;
+  for (int i = -1; i < 3; i++) {
+    PblInt_T *r_1;
+    PBL_CALL_FUNC(ProfileLeaf, r_1, X1, this_call_meta->actual.is_threaded, this_call_meta, PblGetIntT(i));
+    if (!unique_id_ProfileLeaf_CALLCTX->actual.is_failure->actual) sum += r_1->actual;
+  }
+  return PblGetIntT(sum);
+}
+
+PBL_CREATE_FUNC_DESCRIPTOR(ProfileRecurse, PblInt_T *depth)
+PblInt_T *ProfileRecurse(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *depth) {
+  if (depth->actual == 0) return depth;
+  PblInt_T *r_1;
+  PBL_CALL_FUNC(ProfileRecurse, r_1, X1, this_call_meta->actual.is_threaded, this_call_meta,
+                PblGetIntT(depth->actual - 1));
+  return r_1;
+}
+
+/// @brief Calls the function from outside a Pbl function, as it would be done by 'main'
+#define CALL_FROM_ROOT(func, var, args...)                                                                             \
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);                                                           \
+  this_call_meta->actual.is_failure = PblGetBoolT(false);                                                              \
+  this_call_meta->actual.is_threaded = PblGetBoolT(false);                                                             \
+  PBL_CALL_FUNC(func, var, X1, PblGetBoolT(false), this_call_meta, args)
+
+TEST(ProfileTest, CountsAndTimes) {
+  // The profile is kept for the entire program, so only the calls made by this test are compared
+  PblProfileStats_T outer_before = {0, 0, 0, 0};
+  PblProfileStats_T leaf_before = {0, 0, 0, 0};
+  PblProfileGetStats(ProfileOuter_Descriptor.id, &outer_before);
+  PblProfileGetStats(ProfileLeaf_Descriptor.id, &leaf_before);
+
+  PblInt_T *r_1;
+  CALL_FROM_ROOT(ProfileOuter, r_1, );
+  EXPECT_EQ(r_1->actual, 3);
+
+  PblProfileStats_T outer;
+  PblProfileStats_T leaf;
+  ASSERT_TRUE(PblProfileGetStats(ProfileOuter_Descriptor.id, &outer));
+  ASSERT_TRUE(PblProfileGetStats(PblGetFunctionId("ProfileLeaf"), &leaf));
+  EXPECT_EQ(outer.calls - outer_before.calls, 1);
+  EXPECT_EQ(outer.exceptions, 0);
+  EXPECT_EQ(leaf.calls - leaf_before.calls, 4);
+  EXPECT_EQ(leaf.exceptions - leaf_before.exceptions, 1);
+
+  // The time of the callees is part of the inclusive, but not of the exclusive time of the caller
+  EXPECT_LE(outer.exclusive_ns, outer.inclusive_ns);
+  EXPECT_LE(leaf.inclusive_ns, outer.inclusive_ns);
+  EXPECT_EQ(leaf.exclusive_ns, leaf.inclusive_ns);
+
+  PblProfileStats_T unknown;
+  EXPECT_FALSE(PblProfileGetStats(PblGetFunctionId("NeverCalled"), &unknown));
+  EXPECT_EQ(unknown.calls, 0);
+}
+
+TEST(ProfileTest, RecursionIsCountedOnce) {
+  PblProfileStats_T before = {0, 0, 0, 0};
+  PblProfileGetStats(ProfileRecurse_Descriptor.id, &before);
+
+  PblInt_T *r_1;
+  auto start = std::chrono::steady_clock::now();
+  CALL_FROM_ROOT(ProfileRecurse, r_1, PblGetIntT(199));
+  auto wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  EXPECT_EQ(r_1->actual, 0);
+
+  PblProfileStats_T stats;
+  ASSERT_TRUE(PblProfileGetStats(ProfileRecurse_Descriptor.id, &stats));
+  EXPECT_EQ(stats.calls - before.calls, 200);
+
+  // Only the outermost call is part of the inclusive time, otherwise it would be a multiple of the actual time
+  EXPECT_LE(stats.inclusive_ns - before.inclusive_ns, 2 * (uint64_t) wall_ns.count() + 10000);
+  EXPECT_LE(stats.exclusive_ns, stats.inclusive_ns + 1);
+}
+
+TEST(ProfileTest, ShortLivedThreads) {
+  PblProfileStats_T before = {0, 0, 0, 0};
+  PblProfileGetStats(ProfileOuter_Descriptor.id, &before);
+
+  // Every thread continues the call tree of the previous one, whose calls are still part of the profile
+  for (int i = 0; i < 50; i++) {
+    std::thread thread([]() {
+      PblInt_T *r_1;
+      CALL_FROM_ROOT(ProfileOuter, r_1, );
+      EXPECT_EQ(r_1->actual, 3);
+    });
+    thread.join();
+  }
+
+  PblProfileStats_T stats;
+  ASSERT_TRUE(PblProfileGetStats(ProfileOuter_Descriptor.id, &stats));
+  EXPECT_EQ(stats.calls - before.calls, 50);
+}
+
+TEST(ProfileTest, DumpCollapsed) {
+  PblInt_T *r_1;
+  CALL_FROM_ROOT(ProfileOuter, r_1, );
+  PblInt_T *r_2;
+  PBL_CALL_FUNC(ProfileRecurse, r_2, X2, PblGetBoolT(false), this_call_meta, PblGetIntT(2));
+
+  std::string path = testing::TempDir() + "pbl-profile.folded";
+  ASSERT_TRUE(PblProfileDumpCollapsed(path.c_str()));
+
+  std::ifstream file(path);
+  std::string line;
+  bool found_leaf = false;
+  bool found_recursion = false;
+  while (std::getline(file, line)) {
+    // Every line is a call path followed by the exclusive time
+    size_t space = line.rfind(' ');
+    ASSERT_NE(space, std::string::npos);
+    EXPECT_GT(std::stoull(line.substr(space + 1)), 0);
+    if (line.rfind("ProfileOuter;ProfileLeaf ", 0) == 0) found_leaf = true;
+    if (line.rfind("ProfileRecurse;ProfileRecurse;ProfileRecurse", 0) == 0) found_recursion = true;
+  }
+  EXPECT_TRUE(found_leaf);
+  EXPECT_TRUE(found_recursion);
+  std::remove(path.c_str());
+}
+
+/// @brief Counts the occurrences of the passed pattern
+static size_t CountOccurrences(const std::string &content, const std::string &pattern) {
+  size_t count = 0;
+  for (size_t pos = content.find(pattern); pos != std::string::npos; pos = content.find(pattern, pos + 1)) count++;
+  return count;
+}
+
+TEST(TraceTest, DumpTraceEvents) {
+  PblInt_T *r_1;
+  CALL_FROM_ROOT(ProfileOuter, r_1, );
+
+  // Calls of another thread using threaded call ctxs are shown on their own track
+  std::thread worker([]() {
+    PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+    this_call_meta->actual.is_failure = PblGetBoolT(false);
+    PblInt_T *r_2;
+    PBL_CALL_FUNC(ProfileRecurse, r_2, X1, PblGetBoolT(true), this_call_meta, PblGetIntT(3));
+    EXPECT_EQ(r_2->actual, 0);
+  });
+  worker.join();
+
+  std::string path = testing::TempDir() + "pbl-trace.json";
+  ASSERT_TRUE(PblTraceDump(path.c_str()));
+  std::ifstream file(path);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::remove(path.c_str());
+
+  EXPECT_EQ(content.find("{\"traceEvents\":["), 0);
+  EXPECT_NE(content.find("],\"displayTimeUnit\":\"ns\"}"), std::string::npos);
+  EXPECT_NE(content.find("{\"name\":\"ProfileOuter\",\"cat\":\"call\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(content.find("{\"name\":\"ProfileOuter\",\"cat\":\"call\",\"ph\":\"E\""), std::string::npos);
+  EXPECT_NE(content.find("{\"name\":\"ValueError\",\"cat\":\"exception\",\"ph\":\"i\",\"s\":\"t\""),
+            std::string::npos);
+  EXPECT_NE(content.find("\"args\":{\"name\":\"Pbl threaded ctx "), std::string::npos);
+
+  // No call is running while the trace is written, so every begin event has an end event
+  EXPECT_EQ(CountOccurrences(content, "\"ph\":\"B\""), CountOccurrences(content, "\"ph\":\"E\""));
+  EXPECT_GE(CountOccurrences(content, "\"ph\":\"M\""), 2);
+}
+
+TEST(TraceTest, DumpWhileRunning) {
+  // The ring of the worker is overwritten many times while the trace is written
+  std::atomic<bool> stop{false};
+  std::thread worker([&stop]() {
+    while (!stop) {
+      PblInt_T *r_1;
+      CALL_FROM_ROOT(ProfileOuter, r_1, );
+    }
+  });
+
+  std::string path = testing::TempDir() + "pbl-trace-running.json";
+  for (int i = 0; i < 20; i++) {
+    ASSERT_TRUE(PblTraceDump(path.c_str()));
+    std::ifstream file(path);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Events that may have been overwritten are left out, so every end event still belongs to a begin event
+    EXPECT_NE(content.find("],\"displayTimeUnit\":\"ns\"}"), std::string::npos);
+    EXPECT_GE(CountOccurrences(content, "\"ph\":\"B\""), CountOccurrences(content, "\"ph\":\"E\""));
+  }
+  stop = true;
+  worker.join();
+  std::remove(path.c_str());
+}
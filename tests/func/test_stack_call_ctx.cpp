@@ -0,0 +1,99 @@
+///
+/// Testing for the header pbl-function.h using call ctxs located in the stack
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <string>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#define PBL_STACK_CALL_CTX
+#include <libpbl/func/pbl-function.h>
+
+PblInt_T *StackCtxAdd(PblFunctionCallMetaData_T *this_call_meta, PblInt_T *a, PblInt_T *b) {
+  // The ctx lives in the stack frame of the caller and references the static descriptor of the call site
+  EXPECT_EQ(this_call_meta->meta.type, &PBL_STACK_CALL_CTX_TYPE);
+  EXPECT_STREQ(this_call_meta->actual.descriptor->name, "StackCtxAdd");
+  EXPECT_EQ(this_call_meta->actual.arg_amount->actual, 2);
+  EXPECT_FALSE(this_call_meta->actual.is_failure->actual);
+  EXPECT_EQ(this_call_meta->actual.function_identifier, nullptr);
+  return PblGetIntT(a->actual + b->actual);
+}
+
+PblInt_T *StackCtxSum(PblFunctionCallMetaData_T *this_call_meta) {
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_CALL_FUNC_AND_CATCH(StackCtxAdd, r_1, X1, PblGetIntT(2), PblGetIntT(3));
+  EXPECT_EQ(unique_id_StackCtxAdd_CALLCTX->actual.call_origin_ctx, this_call_meta);
+  return r_1;
+}
+
+TEST(StackCallCtxTest, CallWithoutFailure) {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(StackCtxSum, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  EXPECT_EQ(r_1->actual, 5);
+  EXPECT_FALSE(this_call_meta->actual.is_failure->actual);
+}
+
+PblInt_T *StackCtxRaise(PblFunctionCallMetaData_T *this_call_meta, PblUInt_T *i) {
+  PblException_T *exception =
+    PblGetExceptionT(PblGetStringT("test"), PblInternCString("TestException"), PblGetStringT(__FILE__),
+                     PblGetUIntT(__LINE__), PblGetStringT("raise exception"), nullptr, nullptr);
+  PBL_RAISE_EXCEPTION(exception, PblInt_T);
+}
+
+PblInt_T *StackCtxMiddle(PblFunctionCallMetaData_T *this_call_meta) {
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_CALL_FUNC_AND_CATCH(StackCtxRaise, r_1, X1, PblGetUIntT(1));
+  return r_1;
+}
+
+/// @brief Calls 'StackCtxMiddle', so that the stack frame holding the ctx of 'StackCtxRaise' is gone afterwards
+static PblFunctionCallMetaData_T *CallMiddle() {
+  PBL_DEFINE_VAR(this_call_meta, PblFunctionCallMetaData_T);
+  this_call_meta->actual.is_failure = PblGetBoolT(false);
+
+  PBL_DECLARE_VAR(r_1, PblInt_T);
+  PBL_BASE_CALL_AND_CATCH_EXCEPTION(StackCtxMiddle, r_1, H3, PblGetBoolT(false), this_call_meta, );
+  return this_call_meta;
+}
+
+TEST(StackCallCtxTest, PromotedTraceback) {
+  PblFunctionCallMetaData_T *top = CallMiddle();
+  ASSERT_TRUE(top->actual.is_failure->actual);
+  ASSERT_NE(top->actual.exception, nullptr);
+  EXPECT_TRUE(PblStringEquals(PblGetExceptionName(top->actual.exception), PblInternCString("TestException")));
+
+  // The escaping ctxs were promoted to the heap, so the traceback outlives the stack frames it was raised in
+  auto *origin = (PblFunctionCallMetaData_T *) top->actual.failure_origin_ctx;
+  ASSERT_NE(origin, nullptr);
+  EXPECT_NE(origin->meta.type, &PBL_STACK_CALL_CTX_TYPE);
+  EXPECT_TRUE(origin->actual.is_failure->actual);
+  EXPECT_EQ(origin->actual.failure_origin_ctx, origin);
+  EXPECT_EQ(origin->actual.exception, top->actual.exception);
+  EXPECT_STREQ(PblGetStringBytes(origin->actual.function_identifier), "StackCtxRaise");
+  EXPECT_EQ(origin->actual.arg_amount->actual, 1);
+
+  auto *middle = (PblFunctionCallMetaData_T *) origin->actual.call_origin_ctx;
+  ASSERT_NE(middle, nullptr);
+  EXPECT_NE(middle->meta.type, &PBL_STACK_CALL_CTX_TYPE);
+  EXPECT_STREQ(PblGetStringBytes(middle->actual.function_identifier), "StackCtxMiddle");
+  EXPECT_EQ(middle->actual.failure_origin_ctx, origin);
+  EXPECT_EQ(middle->actual.call_origin_ctx, top);
+
+  // Ctxs in the heap are returned as they are
+  EXPECT_EQ(PblPromoteCallCtx(middle), middle);
+
+  // The traceback is formatted from the promoted ctxs, and the top ctx without a descriptor is not listed
+  std::string traceback = PblGetStringBytes(PblFormatTraceback(top));
+  size_t middle_pos = traceback.find("\n  in StackCtxMiddle (called at ");
+  size_t raise_pos = traceback.find("\n  in StackCtxRaise (called at ");
+  ASSERT_NE(middle_pos, std::string::npos);
+  EXPECT_LT(middle_pos, raise_pos);
+  EXPECT_EQ(traceback.find("<unknown>"), std::string::npos);
+}
@@ -0,0 +1,134 @@
+///
+/// Testing for the header pbl-async-io.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/io/pbl-async-io.h>
+
+/// @brief Creates a new temporary file with the passed content and returns its path
+static std::string CreateTempFile(const std::string &content) {
+  char path[] = "/tmp/pbl-test-async-io-XXXXXX";
+  int fd = mkstemp(path);
+  EXPECT_EQ(write(fd, content.data(), content.size()), (ssize_t) content.size());
+  close(fd);
+  return path;
+}
+
+/// @brief Counts the completed operations and the transferred bytes
+static void CountCompletion(PblAsyncIOHandle_T *handle, void *user_data) {
+  auto *counters = (std::vector<int64_t> *) user_data;
+  (*counters)[0]++;
+  (*counters)[1] += handle->result;
+}
+
+/// @brief Reads many small files at the same time using the passed engine
+static void ReadManyFiles(PblAsyncIOEngine_T *engine) {
+  const int files = 200;
+  std::vector<std::string> paths;
+  std::vector<PblIOStream_T *> streams;
+  std::vector<std::vector<char>> buffers(files, std::vector<char>(64));
+  std::vector<PblAsyncIOHandle_T *> handles;
+  std::vector<int64_t> counters = {0, 0};
+  int64_t expected_bytes = 0;
+
+  for (int i = 0; i < files; i++) {
+    std::string content = "file " + std::to_string(i) + " content";
+    expected_bytes += (int64_t) content.size();
+    paths.push_back(CreateTempFile(content));
+    streams.push_back(PblStreamOpen(.path = PblGetStringT(paths.back().c_str())));
+    handles.push_back(PblAsyncRead(.engine = engine, .stream = streams.back(), .buffer = buffers[i].data(),
+                                   .len = buffers[i].size(), .callback = CountCompletion, .user_data = &counters));
+  }
+  EXPECT_EQ(PblAsyncIOPending(engine), files);
+  EXPECT_EQ(PblAsyncIOWait(engine, files), files);
+  EXPECT_EQ(PblAsyncIOPending(engine), 0);
+  EXPECT_EQ(counters[0], files);
+  EXPECT_EQ(counters[1], expected_bytes);
+
+  for (int i = 0; i < files; i++) {
+    std::string content = "file " + std::to_string(i) + " content";
+    ASSERT_TRUE(PblAsyncIOIsComplete(handles[i]));
+    ASSERT_EQ(handles[i]->result, (int64_t) content.size());
+    ASSERT_EQ(std::string(buffers[i].data(), (size_t) handles[i]->result), content);
+    PblStreamClose(streams[i]);
+    unlink(paths[i].c_str());
+  }
+}
+
+TEST(AsyncIOTest, ReadManyFilesIOUring) {
+  PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.queue_depth = 64, .backend = PBL_ASYNC_IO_BACKEND_IO_URING);
+  if (engine == nullptr) GTEST_SKIP() << "io_uring is not supported";
+  EXPECT_EQ(PblAsyncIOGetBackend(engine), PBL_ASYNC_IO_BACKEND_IO_URING);
+  EXPECT_STREQ(PblGetAsyncIOBackendName(PblAsyncIOGetBackend(engine)), "io_uring");
+  ReadManyFiles(engine);
+  PblAsyncIODestroyEngine(engine);
+}
+
+TEST(AsyncIOTest, ReadManyFilesThreadPool) {
+  PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.queue_depth = 64, .backend = PBL_ASYNC_IO_BACKEND_THREAD_POOL);
+  ASSERT_NE(engine, nullptr);
+  EXPECT_EQ(PblAsyncIOGetBackend(engine), PBL_ASYNC_IO_BACKEND_THREAD_POOL);
+  ReadManyFiles(engine);
+  PblAsyncIODestroyEngine(engine);
+}
+
+TEST(AsyncIOTest, WriteAndQueueDepth) {
+  for (auto backend : {PBL_ASYNC_IO_BACKEND_AUTO, PBL_ASYNC_IO_BACKEND_THREAD_POOL}) {
+    PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.queue_depth = 4, .threads = 2, .backend = backend);
+    ASSERT_NE(engine, nullptr);
+    std::string path = CreateTempFile("");
+    PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("r+"));
+
+    // Only 4 of the 32 writes may be in flight at the same time, the rest stays queued
+    const char *blocks = "ABCDEFGHIJKLMNOPQRSTUVWXYZ012345";
+    std::vector<PblAsyncIOHandle_T *> handles;
+    for (int i = 0; i < 32; i++) {
+      handles.push_back(PblAsyncWrite(.engine = engine, .stream = stream, .buffer = blocks + i, .len = 1, .offset = i));
+    }
+    EXPECT_EQ(PblAsyncIOSubmit(engine), 4);
+    EXPECT_EQ(PblAsyncIOPending(engine), 32);
+    // The writes may complete in any order, so every handle is waited for
+    for (PblAsyncIOHandle_T *handle : handles) EXPECT_EQ(PblAsyncIOWaitHandle(handle), 1);
+    EXPECT_EQ(PblAsyncIOPending(engine), 0);
+
+    char buffer[64] = {0};
+    PblAsyncIOHandle_T *read =
+      PblAsyncRead(.engine = engine, .stream = stream, .buffer = buffer, .len = sizeof(buffer));
+    EXPECT_FALSE(PblAsyncIOIsComplete(read));
+    EXPECT_EQ(PblAsyncIOWaitHandle(read), 32);
+    EXPECT_EQ(std::string(buffer), blocks);
+
+    PblAsyncIODestroyEngine(engine);
+    PblStreamClose(stream);
+    unlink(path.c_str());
+  }
+}
+
+TEST(AsyncIOTest, FailedOperation) {
+  for (auto backend : {PBL_ASYNC_IO_BACKEND_AUTO, PBL_ASYNC_IO_BACKEND_THREAD_POOL}) {
+    PblAsyncIOEngine_T *engine = PblAsyncIOCreateEngine(.backend = backend);
+    ASSERT_NE(engine, nullptr);
+    std::string path = CreateTempFile("content");
+    PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"));
+
+    // Reading from a stream that was only opened for writing
+    char buffer[16];
+    PblAsyncIOHandle_T *read =
+      PblAsyncRead(.engine = engine, .stream = stream, .buffer = buffer, .len = sizeof(buffer));
+    EXPECT_EQ(PblAsyncIOWaitHandle(read), -EBADF);
+
+    PblAsyncIODestroyEngine(engine);
+    PblStreamClose(stream);
+    unlink(path.c_str());
+  }
+}
@@ -5,6 +5,9 @@
 
 // Including the required GTest
 #include "gtest/gtest.h"
+#include <string>
+#include <vector>
+#include <unistd.h>
 
 // Including the header to be tested
 #define PBL_DEBUG_VERBOSE
@@ -28,7 +31,8 @@ TEST(IOStreamTest, ConversionCheck) {
   EXPECT_TRUE(PblCompareStringT(stream->actual.mode, mode)->actual);
   EXPECT_EQ(stream->actual.open->actual, true);
   EXPECT_EQ(stream->meta.defined, true);
-  EXPECT_EQ(PblStream_T_Size, sizeof(PblString_T *) + sizeof(PblUInt_T *) + sizeof(PblIOFile_T *) + sizeof(PblBool_T *));
+  EXPECT_EQ(PblStream_T_Size, sizeof(PblString_T *) + sizeof(PblUInt_T *) + sizeof(PblIOFile_T *) +
+                                sizeof(PblBool_T *) + sizeof(struct PblStreamBuffer *));
 }
 
 TEST(IOPrintTest, SimplePrint) {
@@ -57,3 +61,353 @@ TEST(IOPrintTest, SimplePrintWithSetStream) {
   // deallocating the string
   PblDeallocateStringT(str);
 }
+
+TEST(IOPrintTest, PrintWritesContentAndEndChar) {
+  FILE *file = tmpfile();
+  PblIOStream_T *stream = (PblIOStream_T *) PblMalloc(sizeof(PblIOStream_T));
+  *stream = PblStream_T_DefDefault;
+  stream->actual.file = PblGetIOFileT(file);
+
+  PblPrint(.out = PblGetStringT("hello"), .stream = stream, .end = PblGetCharT(' '));
+  PblPrint(.out = PblGetStringT("world"), .stream = stream);
+
+  char buffer[32] = {0};
+  rewind(file);
+  size_t read = fread(buffer, sizeof(char), sizeof(buffer) - 1, file);
+  EXPECT_EQ(read, 12);
+  EXPECT_STREQ(buffer, "hello world\n");
+  fclose(file);
+}
+
+TEST(IOStreamTest, SharedStandardStreams) {
+  PblIOStream_T *stdout_stream = PblStdout();
+
+  EXPECT_EQ(stdout_stream, PblStdout());
+  EXPECT_EQ(stdout_stream->actual.file->actual, stdout);
+  EXPECT_EQ(stdout_stream->actual.fd->actual, 1);
+  EXPECT_EQ(stdout_stream->actual.open->actual, true);
+  EXPECT_EQ(stdout_stream->actual.mode, PblInternCString("a"));
+  EXPECT_EQ(PblStderr()->actual.file->actual, stderr);
+  EXPECT_EQ(PblStdin()->actual.file->actual, stdin);
+  EXPECT_NE(PblStdin(), PblStderr());
+}
+
+/// @brief Path of an empty temporary file, which is removed once it goes out of scope - this also covers assertions
+/// that end a test early
+class TempFilePath {
+public:
+  TempFilePath() {
+    char path[] = "/tmp/pbl-test-io-XXXXXX";
+    close(mkstemp(path));
+    path_ = path;
+  }
+  ~TempFilePath() { unlink(path_.c_str()); }
+  TempFilePath(const TempFilePath &) = delete;
+  TempFilePath &operator=(const TempFilePath &) = delete;
+
+  const char *c_str() const { return path_.c_str(); }
+  operator const std::string &() const { return path_; }
+
+private:
+  std::string path_;
+};
+
+/// @brief Reads the entire content of the file at the passed path
+static std::string ReadFileContent(const std::string &path) {
+  std::string content;
+  FILE *file = fopen(path.c_str(), "r");
+  char buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, sizeof(char), sizeof(buffer), file)) > 0) content.append(buffer, read);
+  fclose(file);
+  return content;
+}
+
+TEST(IOBufferedStreamTest, WriteAndRead) {
+  TempFilePath path;
+
+  PblIOStream_T *out = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"),
+                                     .buffer_size = 16, .single_threaded = true);
+  ASSERT_NE(out, nullptr);
+  EXPECT_NE(out->actual.buffer, nullptr);
+  EXPECT_EQ(PblStreamWrite(out, "hello ", 6), 6);
+  // Nothing is written before the buffer is flushed
+  EXPECT_EQ(ReadFileContent(path), "");
+  // Larger than the buffer, which writes the pending bytes and this one directly
+  EXPECT_EQ(PblStreamWrite(out, "buffered world of streams", 25), 25);
+  EXPECT_EQ(ReadFileContent(path), "hello buffered world of streams");
+  PblPrint(.out = PblGetStringT("line"), .stream = out);
+  EXPECT_TRUE(PblStreamClose(out));
+  EXPECT_FALSE(out->actual.open->actual);
+  EXPECT_EQ(ReadFileContent(path), "hello buffered world of streamsline\n");
+
+  PblIOStream_T *in = PblStreamOpen(.path = PblGetStringT(path.c_str()), .buffer_size = 8);
+  ASSERT_NE(in, nullptr);
+  char buffer[64] = {0};
+  EXPECT_EQ(PblStreamRead(in, buffer, 5), 5);
+  EXPECT_STREQ(buffer, "hello");
+  EXPECT_EQ(PblStreamRead(in, buffer, sizeof(buffer) - 1), 31);
+  EXPECT_STREQ(buffer, " buffered world of streamsline\n");
+  EXPECT_EQ(PblStreamRead(in, buffer, sizeof(buffer) - 1), 0);
+  EXPECT_TRUE(PblStreamClose(in));
+}
+
+TEST(IOBufferedStreamTest, FlushPolicies) {
+  TempFilePath path;
+
+  PblIOStream_T *line = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("a"),
+                                      .flush = PBL_STREAM_FLUSH_LINE);
+  PblStreamWrite(line, "first", 5);
+  EXPECT_EQ(ReadFileContent(path), "");
+  PblStreamWrite(line, " line\n", 6);
+  EXPECT_EQ(ReadFileContent(path), "first line\n");
+
+  PblIOStream_T *none = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("a"),
+                                      .flush = PBL_STREAM_FLUSH_NONE);
+  PblStreamWrite(none, "x", 1);
+  EXPECT_EQ(ReadFileContent(path), "first line\nx");
+
+  PblIOStream_T *full = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("a"));
+  PblStreamWrite(full, "y\n", 2);
+  EXPECT_EQ(ReadFileContent(path), "first line\nx");
+  EXPECT_TRUE(PblStreamFlush(full));
+  EXPECT_EQ(ReadFileContent(path), "first line\nxy\n");
+
+  PblStreamClose(line);
+  PblStreamClose(none);
+  PblStreamClose(full);
+}
+
+TEST(IOBufferedStreamTest, UseAfterClose) {
+  TempFilePath path;
+  TempFilePath other_path;
+
+  PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"));
+  ASSERT_NE(stream, nullptr);
+  EXPECT_EQ(PblStreamWrite(stream, "content", 7), 7);
+  EXPECT_TRUE(PblStreamClose(stream));
+  EXPECT_TRUE(PblStreamClose(stream));
+
+  // Opening another file right away, which is likely to receive the descriptor number of the closed stream
+  PblIOStream_T *other = PblStreamOpen(.path = PblGetStringT(other_path.c_str()), .mode = PblGetStringT("w"));
+  ASSERT_NE(other, nullptr);
+
+  char buffer[8];
+  EXPECT_EQ(PblStreamWrite(stream, "after", 5), 0);
+  PblPrint(.out = PblGetStringT("after"), .stream = stream);
+  PblPrintArg_T arg = PblGetPrintArgOfCString("after");
+  EXPECT_EQ(PblPrintArgs(stream, &arg, 1), 0);
+  EXPECT_FALSE(PblStreamFlush(stream));
+  EXPECT_EQ(PblStreamRead(stream, buffer, sizeof(buffer)), 0);
+  EXPECT_EQ(PblReadLine(stream), nullptr);
+  EXPECT_EQ(PblStreamCopy(stream, other, PBL_STREAM_COPY_ALL).error, EBADF);
+
+  EXPECT_TRUE(PblStreamClose(other));
+  EXPECT_EQ(ReadFileContent(path), "content");
+  EXPECT_EQ(ReadFileContent(other_path), "");
+
+  // Streams using stdio do not touch the closed FILE anymore
+  FILE *file = fopen(path.c_str(), "a");
+  ASSERT_NE(file, nullptr);
+  PblIOStream_T *stdio = (PblIOStream_T *) PblMalloc(sizeof(PblIOStream_T));
+  *stdio = PblStream_T_DefDefault;
+  stdio->actual.file = PblGetIOFileT(file);
+  stdio->actual.open = PblGetBoolT(true);
+  EXPECT_TRUE(PblStreamClose(stdio));
+  EXPECT_EQ(PblStreamWrite(stdio, "after", 5), 0);
+  PblPrint(.out = PblGetStringT("after"), .stream = stdio);
+  EXPECT_FALSE(PblStreamFlush(stdio));
+  EXPECT_EQ(ReadFileContent(path), "content");
+}
+
+TEST(IOBufferedStreamTest, OpenFailure) {
+  EXPECT_EQ(PblStreamOpen(.path = PblGetStringT("/nonexistent/pbl/file")), nullptr);
+  EXPECT_EQ(PblStreamOpen(.path = PblGetStringT("/tmp"), .mode = PblGetStringT("x")), nullptr);
+}
+
+TEST(IOLineReadingTest, PblReadLine) {
+  TempFilePath path;
+  FILE *file = fopen(path.c_str(), "w");
+  fputs("first\n\nthird line which is longer than the buffer\nlast", file);
+  fclose(file);
+
+  // A tiny buffer ensures lines span multiple refills
+  PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path.c_str()), .buffer_size = 8);
+  std::vector<std::string> lines;
+  PblString_T *line;
+  while ((line = PblReadLine(stream)) != nullptr) lines.emplace_back(PblGetStringBytes(line));
+  PblStreamClose(stream);
+
+  EXPECT_EQ(lines, std::vector<std::string>({"first", "", "third line which is longer than the buffer", "last"}));
+
+  // The same for stdio streams
+  file = fopen(path.c_str(), "r");
+  PblIOStream_T *stdio_stream = (PblIOStream_T *) PblMalloc(sizeof(PblIOStream_T));
+  *stdio_stream = PblStream_T_DefDefault;
+  stdio_stream->actual.file = PblGetIOFileT(file);
+  EXPECT_STREQ(PblGetStringBytes(PblReadLine(stdio_stream)), "first");
+  EXPECT_STREQ(PblGetStringBytes(PblReadLine(stdio_stream)), "");
+  fclose(file);
+}
+
+TEST(IOLineReadingTest, PblLineIterator) {
+  TempFilePath path;
+  std::string content;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 1000; i++) {
+    // Every 100th line is longer than the initial block size, which forces the block to grow
+    std::string line = "line " + std::to_string(i) + (i % 100 == 0 ? std::string(100, 'x') : "");
+    expected.push_back(line);
+    content += line + "\n";
+  }
+  FILE *file = fopen(path.c_str(), "w");
+  fputs(content.c_str(), file);
+  fclose(file);
+
+  PblIOStream_T *stream = PblStreamOpen(.path = PblGetStringT(path.c_str()), .single_threaded = true);
+  PblLineIterator_T iter = PblGetLineIterator(stream, 64);
+  std::vector<std::string> lines;
+  PblStringView_T line;
+  while (PblLineIteratorNext(&iter, &line)) lines.emplace_back(line.actual.ptr, line.actual.len);
+  PblStreamClose(stream);
+
+  EXPECT_EQ(lines, expected);
+  EXPECT_GE(iter.capacity, 128);
+}
+
+TEST(IOStreamCopyTest, FileToFile) {
+  TempFilePath src_path;
+  TempFilePath dst_path;
+  std::string content;
+  for (int i = 0; i < 10000; i++) content += "artefact line " + std::to_string(i) + "\n";
+  FILE *file = fopen(src_path.c_str(), "w");
+  fwrite(content.data(), sizeof(char), content.size(), file);
+  fclose(file);
+
+  PblIOStream_T *src = PblStreamOpen(.path = PblGetStringT(src_path.c_str()), .buffer_size = 16);
+  PblIOStream_T *dst = PblStreamOpen(.path = PblGetStringT(dst_path.c_str()), .mode = PblGetStringT("w"));
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(dst, nullptr);
+
+  // Reading ahead into the buffer of the source and leaving a pending write in the destination
+  char buffer[8];
+  EXPECT_EQ(PblStreamRead(src, buffer, 5), 5);
+  EXPECT_EQ(PblStreamWrite(dst, "head:", 5), 5);
+
+  PblStreamCopyResult_T result = PblStreamCopy(src, dst, 100);
+  EXPECT_EQ(result.bytes, 100);
+  EXPECT_EQ(result.error, 0);
+  result = PblStreamCopy(src, dst, PBL_STREAM_COPY_ALL);
+  EXPECT_EQ(result.bytes, content.size() - 105);
+  EXPECT_EQ(result.error, 0);
+#ifdef __linux__
+  EXPECT_TRUE(result.path == PBL_STREAM_COPY_FILE_RANGE || result.path == PBL_STREAM_COPY_SENDFILE)
+    << PblGetStreamCopyPathName(result.path);
+#endif
+
+  // The source is exhausted
+  result = PblStreamCopy(src, dst, PBL_STREAM_COPY_ALL);
+  EXPECT_EQ(result.bytes, 0);
+  EXPECT_EQ(result.path, PBL_STREAM_COPY_NONE);
+
+  EXPECT_TRUE(PblStreamClose(src));
+  EXPECT_TRUE(PblStreamClose(dst));
+  EXPECT_EQ(ReadFileContent(dst_path), "head:" + content.substr(5));
+}
+
+TEST(IOStreamCopyTest, PipeAndMemoryStreams) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  PblIOStream_T *pipe_in = PblGetBufferedIOStreamT(fds[0], 0, PBL_STREAM_FLUSH_FULL, true);
+  PblIOStream_T *pipe_out = PblGetBufferedIOStreamT(fds[1], 0, PBL_STREAM_FLUSH_FULL, true);
+  EXPECT_EQ(PblStreamWrite(pipe_out, "through the pipe", 16), 16);
+  EXPECT_TRUE(PblStreamClose(pipe_out));
+
+  // A memory stream has no file descriptor, so the bytes have to be copied through user-space
+  char memory[64] = {0};
+  FILE *file = fmemopen(memory, sizeof(memory), "w");
+  PblIOStream_T *dst = (PblIOStream_T *) PblMalloc(sizeof(PblIOStream_T));
+  *dst = PblStream_T_DefDefault;
+  dst->actual.file = PblGetIOFileT(file);
+
+  PblStreamCopyResult_T result = PblStreamCopy(pipe_in, dst, PBL_STREAM_COPY_ALL);
+  EXPECT_EQ(result.bytes, 16);
+  EXPECT_EQ(result.path, PBL_STREAM_COPY_BUFFERED);
+  EXPECT_STREQ(PblGetStreamCopyPathName(result.path), "buffered");
+  fclose(file);
+  EXPECT_STREQ(memory, "through the pipe");
+  EXPECT_TRUE(PblStreamClose(pipe_in));
+
+  // Copying a stream onto itself is invalid
+  EXPECT_EQ(PblStreamCopy(pipe_in, pipe_in, 1).error, EINVAL);
+}
+
+#ifdef __linux__
+TEST(IOStreamCopyTest, SplicePipeToFile) {
+  TempFilePath path;
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  ASSERT_EQ(write(fds[1], "spliced content", 15), 15);
+  close(fds[1]);
+
+  PblIOStream_T *src = PblGetBufferedIOStreamT(fds[0], 0, PBL_STREAM_FLUSH_FULL, true);
+  PblIOStream_T *dst = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"));
+  PblStreamCopyResult_T result = PblStreamCopy(src, dst, PBL_STREAM_COPY_ALL);
+  EXPECT_EQ(result.bytes, 15);
+  EXPECT_EQ(result.path, PBL_STREAM_COPY_SPLICE) << PblGetStreamCopyPathName(result.path);
+  EXPECT_TRUE(PblStreamClose(src));
+  EXPECT_TRUE(PblStreamClose(dst));
+  EXPECT_EQ(ReadFileContent(path), "spliced content");
+}
+#endif
+
+TEST(IOPrintManyTest, PblPrintMany) {
+  TempFilePath path;
+  PblIOStream_T *out = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"));
+  ASSERT_NE(out, nullptr);
+
+  size_t written = PblPrintMany(out, PblGetStringT("id="), PblGetIntT(-42), " size=", PblGetSizeT(1024), " ratio=",
+                                PblGetDoubleT(0.1), " ok=", PblGetBoolT(true), ' ', PblGetCharT('c'), " ",
+                                PblGetStringViewOfCString("view"), " ", 18446744073709551615ULL, "\n");
+  EXPECT_EQ(written, 63);
+  // The min. value can not be negated as a signed number
+  PblPrintMany(out, INT64_MIN, " ", 1.0 / 3, " ", 0.1f, " ", 1e300, "\n");
+  EXPECT_TRUE(PblStreamClose(out));
+  EXPECT_EQ(ReadFileContent(path),
+            "id=-42 size=1024 ratio=0.1 ok=true c view 18446744073709551615\n"
+            "-9223372036854775808 0.3333333333333333 0.1 1e+300\n");
+}
+
+TEST(IOPrintManyTest, PblPrintManyExceedingMaxParts) {
+  TempFilePath path;
+  FILE *file = fopen(path.c_str(), "w");
+  PblIOStream_T *out = (PblIOStream_T *) PblMalloc(sizeof(PblIOStream_T));
+  *out = PblStream_T_DefDefault;
+  out->actual.file = PblGetIOFileT(file);
+
+  // Pending stdio data is written before the vectored write
+  fputs("start:", file);
+  std::vector<PblPrintArg_T> args;
+  std::string expected = "start:";
+  for (int i = 0; i < PBL_PRINT_MAX_PARTS * 3; i++) {
+    args.push_back(PblGetPrintArgOfSigned(i));
+    args.push_back(PblGetPrintArgOfChar(','));
+    expected += std::to_string(i) + ",";
+  }
+  EXPECT_EQ(PblPrintArgs(out, args.data(), args.size()), expected.size() - 6);
+  fclose(file);
+  EXPECT_EQ(ReadFileContent(path), expected);
+}
+
+TEST(IOPrintManyTest, PblPrintf) {
+  TempFilePath path;
+  PblIOStream_T *out = PblStreamOpen(.path = PblGetStringT(path.c_str()), .mode = PblGetStringT("w"),
+                                     .buffer_size = 8, .flush = PBL_STREAM_FLUSH_LINE);
+  ASSERT_NE(out, nullptr);
+
+  EXPECT_EQ(PblPrintf(out, "{} + {} = {}\n", 1, 2u, PblGetLongT(3)), 10);
+  PblPrintf(out, "{{escaped}} {} {}\n", PblGetStringT("only one arg"));
+  PblPrintf(out, "no args {}\n");
+  EXPECT_TRUE(PblStreamClose(out));
+  EXPECT_EQ(ReadFileContent(path), "1 + 2 = 3\n{escaped} only one arg {}\nno args {}\n");
+}
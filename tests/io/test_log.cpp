@@ -0,0 +1,147 @@
+///
+/// Testing for the header pbl-log.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/io/pbl-log.h>
+
+/// @brief Opens a new temporary file as a buffered stream and returns its path
+static std::string OpenTempLogStream(PblIOStream_T **stream) {
+  char path[] = "/tmp/pbl-test-log-XXXXXX";
+  close(mkstemp(path));
+  *stream = PblStreamOpen(.path = PblGetStringT(path), .mode = PblGetStringT("w"));
+  return path;
+}
+
+/// @brief Reads all lines of the file at the passed path
+static std::vector<std::string> ReadLines(const std::string &path) {
+  std::vector<std::string> lines;
+  FILE *file = fopen(path.c_str(), "r");
+  char buffer[256];
+  while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+    std::string line = buffer;
+    if (!line.empty() && line.back() == '\n') line.pop_back();
+    lines.push_back(line);
+  }
+  fclose(file);
+  return lines;
+}
+
+TEST(LogTest, NotRunning) {
+  uint64_t dropped = PblLogGetStats().records_dropped;
+  EXPECT_FALSE(PblLog(PblGetStringT("dropped")));
+  EXPECT_FALSE(PblLogFlush());
+  EXPECT_FALSE(PblLogStop());
+  EXPECT_EQ(PblLogGetStats().records_dropped, dropped + 1);
+}
+
+TEST(LogTest, RecordsFromManyThreads) {
+  PblIOStream_T *stream;
+  std::string path = OpenTempLogStream(&stream);
+  ASSERT_TRUE(PblLogStart(.stream = stream, .ring_size = 4096, .overflow = PBL_LOG_OVERFLOW_BLOCK));
+  EXPECT_FALSE(PblLogStart(.stream = stream));
+  PblLogStats_T before = PblLogGetStats();
+
+  const int threads = 4;
+  const int records = 5000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([t]() {
+      for (int i = 0; i < records; i++) PblLogMany("thread ", t, " record ", i);
+    });
+  }
+  for (auto &worker : workers) worker.join();
+
+  EXPECT_TRUE(PblLogFlush());
+  EXPECT_TRUE(PblLogStop());
+  EXPECT_TRUE(PblStreamClose(stream));
+
+  PblLogStats_T after = PblLogGetStats();
+  EXPECT_EQ(after.records_logged - before.records_logged, threads * records);
+  EXPECT_EQ(after.records_dropped, before.records_dropped);
+  EXPECT_GT(after.batches_written, before.batches_written);
+
+  // Every record is an entire line, and the records of a thread keep their order
+  std::vector<std::string> lines = ReadLines(path);
+  ASSERT_EQ(lines.size(), threads * records);
+  std::vector<int> next(threads, 0);
+  for (const std::string &line : lines) {
+    std::istringstream parts(line);
+    std::string thread_word, record_word;
+    int t, i;
+    parts >> thread_word >> t >> record_word >> i;
+    ASSERT_EQ(thread_word, "thread");
+    ASSERT_EQ(i, next[t]++);
+  }
+
+  unlink(path.c_str());
+}
+
+TEST(LogTest, StopWhileLogging) {
+  PblIOStream_T *stream;
+  std::string path = OpenTempLogStream(&stream);
+  ASSERT_TRUE(PblLogStart(.stream = stream, .ring_size = 4096, .overflow = PBL_LOG_OVERFLOW_BLOCK));
+  PblLogStats_T before = PblLogGetStats();
+
+  // Every record accepted before the logger stopped is written, including those committed during the last pass
+  std::atomic<bool> started{false};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; t++) {
+    workers.emplace_back([&started]() {
+      started = true;
+      while (PblLogBytes("record", 6)) {}
+    });
+  }
+  while (!started) std::this_thread::yield();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  EXPECT_TRUE(PblLogStop());
+  for (auto &worker : workers) worker.join();
+  EXPECT_TRUE(PblStreamClose(stream));
+
+  PblLogStats_T after = PblLogGetStats();
+  EXPECT_GT(after.records_logged, before.records_logged);
+  EXPECT_EQ(ReadLines(path).size(), after.records_logged - before.records_logged);
+
+  unlink(path.c_str());
+}
+
+TEST(LogTest, DropPolicy) {
+  PblIOStream_T *stream;
+  std::string path = OpenTempLogStream(&stream);
+  // A long flush interval, so the small ring buffer of the new thread overflows before it is drained
+  ASSERT_TRUE(PblLogStart(.stream = stream, .ring_size = 256, .flush_interval_ms = 60000,
+                          .overflow = PBL_LOG_OVERFLOW_DROP));
+  PblLogStats_T before = PblLogGetStats();
+
+  int accepted = 0;
+  std::thread worker([&accepted]() {
+    for (int i = 0; i < 1000; i++) accepted += PblLogBytes("0123456789abcdef", 16) ? 1 : 0;
+    // Larger than the entire ring buffer
+    EXPECT_FALSE(PblLogBytes(std::string(1024, 'x').c_str(), 1024));
+  });
+  worker.join();
+
+  EXPECT_TRUE(PblLogStop());
+  EXPECT_TRUE(PblStreamClose(stream));
+
+  PblLogStats_T after = PblLogGetStats();
+  EXPECT_EQ(after.records_logged - before.records_logged, accepted);
+  EXPECT_EQ(after.records_dropped - before.records_dropped, 1001 - accepted);
+  EXPECT_GT(after.records_dropped, before.records_dropped);
+  EXPECT_EQ(ReadLines(path).size(), accepted);
+
+  unlink(path.c_str());
+}
@@ -0,0 +1,103 @@
+///
+/// Testing for the header pbl-mmap.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <string>
+#include <unistd.h>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/io/pbl-mmap.h>
+
+/// @brief Creates a temporary file with the passed content and returns its path
+static std::string CreateTempFileWithContent(const std::string &content) {
+  char path[] = "/tmp/pbl-test-mmap-XXXXXX";
+  int fd = mkstemp(path);
+  EXPECT_EQ(write(fd, content.data(), content.size()), (ssize_t) content.size());
+  close(fd);
+  return path;
+}
+
+TEST(MappedFileTest, MapEntireFile) {
+  std::string path = CreateTempFileWithContent("first line\nsecond line\n");
+
+  PblMappedFile_T *file = PblMapFile(.path = PblGetStringT(path.c_str()), .advice = PBL_MAP_ADVICE_SEQUENTIAL);
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(PblMappedFile_T_Size, sizeof(int) + sizeof(size_t) + sizeof(const char *) + sizeof(unsigned int));
+  EXPECT_EQ(file->actual.size, 23);
+
+  PblStringView_T view = PblGetMappedFileView(file);
+  EXPECT_EQ(std::string(view.actual.ptr, view.actual.len), "first line\nsecond line\n");
+  EXPECT_TRUE(PblUnmapFile(file));
+  EXPECT_EQ(file->actual.data, nullptr);
+  EXPECT_EQ(file->actual.fd, -1);
+
+  unlink(path.c_str());
+}
+
+TEST(MappedFileTest, MapEmptyAndMissingFile) {
+  std::string path = CreateTempFileWithContent("");
+
+  PblMappedFile_T *file = PblMapFile(.path = PblGetStringT(path.c_str()));
+  ASSERT_NE(file, nullptr);
+  EXPECT_EQ(PblGetMappedFileView(file).actual.len, 0);
+  EXPECT_TRUE(PblUnmapFile(file));
+  EXPECT_EQ(PblMapFile(.path = PblGetStringT("/nonexistent/pbl/file")), nullptr);
+
+  unlink(path.c_str());
+}
+
+TEST(MappedFileTest, ChunkIterator) {
+  // Lines of different length, so the chunk boundaries never match a line end by chance
+  std::string content;
+  for (int i = 0; i < 5000; i++) content += "line " + std::to_string(i) + std::string(i % 7, '.') + "\n";
+  std::string path = CreateTempFileWithContent(content);
+
+  for (bool chunked : {true, false}) {
+    PblMappedFile_T *file = PblMapFile(.path = PblGetStringT(path.c_str()), .chunked = chunked);
+    ASSERT_NE(file, nullptr);
+
+    PblMappedChunkIter_T iter = PblGetMappedChunkIter(file, 1, true);
+    PblStringView_T chunk;
+    std::string joined;
+    int chunks = 0;
+    while (PblMappedChunkIterNext(&iter, &chunk)) {
+      // Every chunk ends with a complete line
+      EXPECT_EQ(chunk.actual.ptr[chunk.actual.len - 1], '\n');
+      EXPECT_LE(chunk.actual.len, iter.chunk_size);
+      joined.append(chunk.actual.ptr, chunk.actual.len);
+      chunks++;
+    }
+    EXPECT_EQ(joined, content);
+    EXPECT_GT(chunks, 1);
+    PblMappedChunkIterClose(&iter);
+    EXPECT_TRUE(PblUnmapFile(file));
+  }
+
+  unlink(path.c_str());
+}
+
+TEST(MappedFileTest, ChunkIteratorStoppedEarly) {
+  std::string content(64 * 1024, 'x');
+  std::string path = CreateTempFileWithContent(content);
+
+  PblMappedFile_T *file = PblMapFile(.path = PblGetStringT(path.c_str()), .chunked = true);
+  ASSERT_NE(file, nullptr);
+  PblMappedChunkIter_T iter = PblGetMappedChunkIter(file, 1, false);
+  PblStringView_T chunk;
+  ASSERT_TRUE(PblMappedChunkIterNext(&iter, &chunk));
+  EXPECT_NE(iter.window, nullptr);
+
+  // Closing the iterator releases the window of the current chunk, which is also safe to repeat
+  PblMappedChunkIterClose(&iter);
+  EXPECT_EQ(iter.window, nullptr);
+  EXPECT_EQ(iter.window_len, 0);
+  PblMappedChunkIterClose(&iter);
+  EXPECT_TRUE(PblUnmapFile(file));
+
+  unlink(path.c_str());
+}
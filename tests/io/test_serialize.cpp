@@ -0,0 +1,214 @@
+///
+/// Testing for the header pbl-serialize.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <climits>
+#include <string>
+#include <unistd.h>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/io/pbl-serialize.h>
+
+/// @brief Pbl struct type used for testing nested structs
+struct Point_Base {
+  PblInt_T *x;
+  PblInt_T *y;
+};
+struct Point { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct Point_Base) };
+typedef struct Point Point_T;
+
+static const PblSerialField_T POINT_FIELDS[] = {PBL_SERIAL_FIELD(Point_T, x, PBL_SERIAL_TYPE_INT),
+                                                PBL_SERIAL_FIELD(Point_T, y, PBL_SERIAL_TYPE_INT)};
+static const PblSerialType_T POINT_TYPE = PBL_SERIAL_STRUCT_TYPE(Point_T, "test.point", POINT_FIELDS);
+
+/// @brief Pbl struct type, which contains every kind of property
+struct Shape_Base {
+  PblString_T *name;
+  Point_T *origin;
+  PblDouble_T *scale;
+  PblAny_T *extra;
+  PblStringView_T *tag;
+  PblULongLong_T *id;
+};
+struct Shape { PBL_TYPE_DEFINITION_WRAPPER_CONSTRUCTOR(struct Shape_Base) };
+typedef struct Shape Shape_T;
+
+static const PblSerialField_T SHAPE_FIELDS[] = {PBL_SERIAL_FIELD(Shape_T, name, PBL_SERIAL_TYPE_STRING),
+                                                PBL_SERIAL_FIELD(Shape_T, origin, POINT_TYPE),
+                                                PBL_SERIAL_FIELD(Shape_T, scale, PBL_SERIAL_TYPE_DOUBLE),
+                                                PBL_SERIAL_FIELD(Shape_T, extra, PBL_SERIAL_TYPE_ANY),
+                                                PBL_SERIAL_FIELD(Shape_T, tag, PBL_SERIAL_TYPE_STRING_VIEW),
+                                                PBL_SERIAL_FIELD(Shape_T, id, PBL_SERIAL_TYPE_ULONG_LONG)};
+static const PblSerialType_T SHAPE_TYPE = PBL_SERIAL_STRUCT_TYPE(Shape_T, "test.shape", SHAPE_FIELDS);
+
+/// @brief Creates a new shape with all properties except 'tag' set
+static Shape_T *CreateShape() {
+  auto *origin = (Point_T *) PblMalloc(sizeof(Point_T));
+  origin->actual.x = PblGetIntT(-3);
+  origin->actual.y = PblGetIntT(INT_MAX);
+
+  PblInt_T *extra = PblGetIntT(42);
+  auto *shape = (Shape_T *) PblMalloc(sizeof(Shape_T));
+  shape->actual.name = PblGetStringT("triangle");
+  shape->actual.origin = origin;
+  shape->actual.scale = PblGetDoubleT(1.5);
+  shape->actual.extra = PblGetAnyT(extra, (PblType_T *) &PBL_SERIAL_TYPE_INT);
+  shape->actual.tag = nullptr;
+  shape->actual.id = PblGetULongLongT(ULLONG_MAX);
+  return shape;
+}
+
+TEST(SerializeTest, Varints) {
+  size_t len;
+  char *bytes = PblSerializeToBytes(&PBL_SERIAL_TYPE_INT, PblGetIntT(-1), &len);
+  EXPECT_EQ(len, 1);
+  EXPECT_EQ(bytes[0], 1);
+
+  bytes = PblSerializeToBytes(&PBL_SERIAL_TYPE_UINT, PblGetUIntT(300), &len);
+  ASSERT_EQ(len, 2);
+  EXPECT_EQ((unsigned char) bytes[0], 0xac);
+  EXPECT_EQ((unsigned char) bytes[1], 0x02);
+
+  bytes = PblSerializeToBytes(&PBL_SERIAL_TYPE_LONG_LONG, PblGetLongLongT(LLONG_MIN), &len);
+  EXPECT_EQ(len, 10);
+  auto *decoded = (PblLongLong_T *) PblDeserializeBytes(.data = bytes, .len = len, .type = &PBL_SERIAL_TYPE_LONG_LONG);
+  ASSERT_NE(decoded, nullptr);
+  EXPECT_EQ(decoded->actual, LLONG_MIN);
+
+  // Values out of the range of the decoded type are rejected
+  bytes = PblSerializeToBytes(&PBL_SERIAL_TYPE_INT, PblGetIntT(1000), &len);
+  enum PblSerialError error;
+  EXPECT_EQ(PblDeserializeBytes(.data = bytes, .len = len, .type = &PBL_SERIAL_TYPE_CHAR, .error = &error), nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_ERR_INVALID);
+}
+
+TEST(SerializeTest, NestedStructRoundTrip) {
+  Shape_T *shape = CreateShape();
+  size_t len;
+  char *bytes = PblSerializeToBytes(&SHAPE_TYPE, shape, &len);
+  ASSERT_NE(bytes, nullptr);
+
+  PblArena_T *arena = PblArenaCreate();
+  size_t consumed;
+  enum PblSerialError error;
+  auto *decoded = (Shape_T *) PblDeserializeBytes(.data = bytes, .len = len, .type = &SHAPE_TYPE, .arena = arena,
+                                                  .consumed = &consumed, .error = &error);
+  ASSERT_NE(decoded, nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_OK);
+  EXPECT_EQ(consumed, len);
+  EXPECT_GT(arena->actual.allocated, 0);
+
+  EXPECT_TRUE(decoded->meta.defined);
+  EXPECT_EQ(decoded->meta.type, (PblType_T *) &SHAPE_TYPE);
+  EXPECT_STREQ(PblGetStringBytes(decoded->actual.name), "triangle");
+  EXPECT_TRUE(PblStringEquals(decoded->actual.name, shape->actual.name));
+  EXPECT_EQ(decoded->actual.origin->actual.x->actual, -3);
+  EXPECT_EQ(decoded->actual.origin->actual.y->actual, INT_MAX);
+  EXPECT_EQ(decoded->actual.scale->actual, 1.5);
+  EXPECT_EQ(decoded->actual.extra->actual.type, (PblType_T *) &PBL_SERIAL_TYPE_INT);
+  EXPECT_EQ(((PblInt_T *) decoded->actual.extra->actual.val)->actual, 42);
+  EXPECT_EQ(decoded->actual.tag, nullptr);
+  EXPECT_EQ(decoded->actual.id->actual, ULLONG_MAX);
+
+  // Truncated input is rejected at every position
+  for (size_t i = 0; i < len; i++) {
+    EXPECT_EQ(PblDeserializeBytes(.data = bytes, .len = i, .type = &SHAPE_TYPE, .arena = arena, .error = &error),
+              nullptr);
+    EXPECT_EQ(error, PBL_SERIAL_ERR_TRUNCATED);
+  }
+
+  PblArenaDestroy(arena);
+}
+
+TEST(SerializeTest, ZeroCopyStringViews) {
+  Shape_T *shape = CreateShape();
+  PblStringView_T tag = PblGetStringViewOfCString("zero-copy");
+  shape->actual.tag = &tag;
+
+  size_t len;
+  char *bytes = PblSerializeToBytes(&SHAPE_TYPE, shape, &len);
+  auto *decoded = (Shape_T *) PblDeserializeBytes(.data = bytes, .len = len, .type = &SHAPE_TYPE);
+  ASSERT_NE(decoded, nullptr);
+  ASSERT_NE(decoded->actual.tag, nullptr);
+
+  // The view points directly into the encoded bytes
+  const char *ptr = decoded->actual.tag->actual.ptr;
+  EXPECT_GE(ptr, bytes);
+  EXPECT_LT(ptr, bytes + len);
+  EXPECT_EQ(std::string(ptr, decoded->actual.tag->actual.len), "zero-copy");
+}
+
+TEST(SerializeTest, StreamRoundTrip) {
+  char path[] = "/tmp/pbl-test-serialize-XXXXXX";
+  close(mkstemp(path));
+
+  // Registering the struct type, so it can be decoded inside 'PblAny_T'
+  EXPECT_TRUE(PblSerialRegisterType(&SHAPE_TYPE));
+  EXPECT_TRUE(PblSerialRegisterType(&POINT_TYPE));
+  EXPECT_TRUE(PblSerialRegisterType(&SHAPE_TYPE));
+
+  PblIOStream_T *out = PblStreamOpen(.path = PblGetStringT(path), .mode = PblGetStringT("w"));
+  Shape_T *shape = CreateShape();
+  shape->actual.extra = PblGetAnyT(shape->actual.origin, (PblType_T *) &POINT_TYPE);
+  EXPECT_TRUE(PblSerialize(out, &SHAPE_TYPE, shape));
+  EXPECT_TRUE(PblSerialize(out, &PBL_SERIAL_TYPE_STRING, PblGetStringT(std::string(200000, 'x').c_str())));
+  EXPECT_TRUE(PblSerialize(out, &PBL_SERIAL_TYPE_FLOAT, PblGetFloatT(-0.25f)));
+  EXPECT_TRUE(PblStreamClose(out));
+
+  // The values are decoded one after another from the same stream
+  PblIOStream_T *in = PblStreamOpen(.path = PblGetStringT(path));
+  PblArena_T *arena = PblArenaCreate(.block_size = 1024);
+  auto *decoded = (Shape_T *) PblDeserialize(.stream = in, .type = &SHAPE_TYPE, .arena = arena);
+  ASSERT_NE(decoded, nullptr);
+  EXPECT_EQ(decoded->actual.extra->actual.type, (PblType_T *) &POINT_TYPE);
+  EXPECT_EQ(((Point_T *) decoded->actual.extra->actual.val)->actual.y->actual, INT_MAX);
+
+  auto *str = (PblString_T *) PblDeserialize(.stream = in, .type = &PBL_SERIAL_TYPE_STRING, .arena = arena);
+  ASSERT_NE(str, nullptr);
+  EXPECT_EQ(str->actual.len->actual, 200000);
+  EXPECT_EQ(std::string(PblGetStringBytes(str)), std::string(200000, 'x'));
+  auto *val = (PblFloat_T *) PblDeserialize(.stream = in, .type = &PBL_SERIAL_TYPE_FLOAT);
+  ASSERT_NE(val, nullptr);
+  EXPECT_EQ(val->actual, -0.25f);
+
+  enum PblSerialError error;
+  EXPECT_EQ(PblDeserialize(.stream = in, .type = &PBL_SERIAL_TYPE_INT, .error = &error), nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_ERR_TRUNCATED);
+
+  PblArenaDestroy(arena);
+  PblStreamClose(in);
+  unlink(path);
+}
+
+TEST(SerializeTest, ForgedStringLengths) {
+  // A length of UINT_MAX would overflow the length of the string including the null-terminator
+  const char max_len[] = {'\xff', '\xff', '\xff', '\xff', '\x0f'};
+  enum PblSerialError error;
+  EXPECT_EQ(PblDeserializeBytes(.data = max_len, .len = sizeof(max_len), .type = &PBL_SERIAL_TYPE_STRING,
+                                .error = &error),
+            nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_ERR_INVALID);
+
+  // A stream claiming a string of almost 4 GiB, which only contains a few bytes, is only read as far as it goes
+  char path[] = "/tmp/pbl-test-serialize-XXXXXX";
+  int fd = mkstemp(path);
+  const char forged[] = {'\xf0', '\xff', '\xff', '\xff', '\x0f', 'a', 'b', 'c'};
+  EXPECT_EQ(write(fd, forged, sizeof(forged)), (ssize_t) sizeof(forged));
+  close(fd);
+
+  PblIOStream_T *in = PblStreamOpen(.path = PblGetStringT(path));
+  EXPECT_EQ(PblDeserialize(.stream = in, .type = &PBL_SERIAL_TYPE_STRING, .error = &error), nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_ERR_TRUNCATED);
+  PblStreamClose(in);
+
+  in = PblStreamOpen(.path = PblGetStringT(path));
+  EXPECT_EQ(PblDeserialize(.stream = in, .type = &PBL_SERIAL_TYPE_STRING_VIEW, .error = &error), nullptr);
+  EXPECT_EQ(error, PBL_SERIAL_ERR_TRUNCATED);
+  PblStreamClose(in);
+  unlink(path);
+}
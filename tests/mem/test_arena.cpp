@@ -0,0 +1,44 @@
+///
+/// Testing for the header pbl-arena.h
+///
+/// @author Luna-Klatzer
+
+// Including the required GTest
+#include "gtest/gtest.h"
+#include <cstdint>
+
+// Including the header to be tested
+#define PBL_DEBUG_VERBOSE
+#define PBL_OVERWRITE_DEFAULT_ALLOC_FUNCTIONS
+#include <libpbl/mem/pbl-arena.h>
+
+TEST(ArenaTest, AllocAndReset) {
+  PblArena_T *arena = PblArenaCreate(.block_size = 256);
+  EXPECT_EQ(arena->actual.block_size, 256);
+  EXPECT_EQ(arena->actual.blocks, nullptr);
+
+  char *first = (char *) PblArenaAlloc(arena, 3);
+  char *second = (char *) PblArenaAlloc(arena, 5);
+  EXPECT_EQ((uintptr_t) first % PBL_ARENA_ALIGNMENT, 0);
+  EXPECT_EQ((uintptr_t) second % PBL_ARENA_ALIGNMENT, 0);
+  EXPECT_EQ(second - first, PBL_ARENA_ALIGNMENT);
+  EXPECT_EQ(arena->actual.allocated, 2 * PBL_ARENA_ALIGNMENT);
+
+  // Large allocations get a block of their own and do not replace the current block
+  char *large = (char *) PblArenaAlloc(arena, 1000);
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(large[i], 0);
+  char *third = (char *) PblArenaAlloc(arena, 1);
+  EXPECT_EQ(third - first, 2 * PBL_ARENA_ALIGNMENT);
+
+  char *copy = PblArenaCopyBytes(arena, "arena", 5);
+  EXPECT_STREQ(copy, "arena");
+
+  // Resetting keeps the regular block, whose memory is handed out zeroed again
+  PblArenaReset(arena);
+  EXPECT_EQ(arena->actual.allocated, 0);
+  char *reused = (char *) PblArenaAlloc(arena, 64);
+  EXPECT_EQ(reused, first);
+  for (int i = 0; i < 64; i++) EXPECT_EQ(reused[i], 0);
+
+  PblArenaDestroy(arena);
+}
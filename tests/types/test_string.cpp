@@ -4,6 +4,9 @@
 
 // Including the required GTest
 #include "gtest/gtest.h"
+#include <random>
+#include <string>
+#include <vector>
 
 // Including the header to be tested
 #define PBL_DEBUG_VERBOSE
@@ -19,13 +22,17 @@ TEST(StringTypesTest, GetLenghtOfCString) {
 TEST(StringTypesTest, GetStringConversion) {
   PblString_T *string_1 = PblGetStringT("hello");
 
-  EXPECT_EQ(PblString_T_Size, sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *));
+  EXPECT_EQ(PblString_T_Size, sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *) +
+                                sizeof(char *) + sizeof(uint64_t) + sizeof(bool) + sizeof(bool) +
+                                sizeof(uint8_t));
   EXPECT_EQ(string_1->actual.len->actual, 5);
   EXPECT_EQ(string_1->actual.allocated_len->actual, 51);
 
   PblString_T *string_2 = PblGetStringT("world");
 
-  EXPECT_EQ(PblString_T_Size, sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *));
+  EXPECT_EQ(PblString_T_Size, sizeof(PblSize_T *) + sizeof(PblUInt_T *) + sizeof(PblUInt_T *) + sizeof(char *) +
+                                sizeof(char *) + sizeof(uint64_t) + sizeof(bool) + sizeof(bool) +
+                                sizeof(uint8_t));
   EXPECT_EQ(string_2->actual.len->actual, 5);
   EXPECT_EQ(string_2->actual.allocated_len->actual, 51);
 
@@ -164,4 +171,335 @@ TEST(StringTypesTest, PblWriteStringToStringT) {
   EXPECT_TRUE(PblCompareStringT(str_1, str_2)->actual);
   EXPECT_TRUE(PblCompareStringT(str_2, str_3)->actual);
   EXPECT_TRUE(PblCompareStringT(str_3, str_4)->actual);
-}
\ No newline at end of file
+}
+
+TEST(StringTypesTest, PblStringEquals) {
+  PblString_T *str_1 = PblGetStringT("hello world");
+  PblString_T *str_2 = PblGetStringT("hello world");
+  PblString_T *str_3 = PblGetStringT("hello worle");
+  PblString_T *str_4 = PblGetStringT("hello");
+
+  EXPECT_TRUE(PblStringEquals(str_1, str_1));
+  EXPECT_TRUE(PblStringEquals(str_1, str_2));
+  EXPECT_FALSE(PblStringEquals(str_1, str_3));
+  EXPECT_FALSE(PblStringEquals(str_1, str_4));
+  EXPECT_TRUE(PblStringEquals(PblGetStringT(""), PblGetStringT("")));
+}
+
+TEST(StringTypesTest, PblStringCompareOrder) {
+  PblString_T *str_1 = PblGetStringT("abc");
+  PblString_T *str_2 = PblGetStringT("abd");
+  PblString_T *str_3 = PblGetStringT("ab");
+
+  EXPECT_EQ(PblStringCompareOrder(str_1, PblGetStringT("abc")), 0);
+  EXPECT_LT(PblStringCompareOrder(str_1, str_2), 0);
+  EXPECT_GT(PblStringCompareOrder(str_2, str_1), 0);
+  EXPECT_LT(PblStringCompareOrder(str_3, str_1), 0);
+  EXPECT_GT(PblStringCompareOrder(str_1, str_3), 0);
+
+  // Bytes are compared unsigned, meaning non-ASCII bytes are ordered after ASCII bytes
+  EXPECT_LT(PblStringCompareOrder(str_1, PblGetStringT("\xc3\xa4")), 0);
+}
+
+TEST(StringTypesTest, PblGetStringHash) {
+  PblString_T *str_1 = PblGetStringT("hello world");
+  PblString_T *str_2 = PblGetStringT("hello world");
+
+  EXPECT_FALSE(str_1->actual.hash_cached);
+  EXPECT_EQ(PblGetStringHash(str_1), PblGetStringHash(str_2));
+  EXPECT_TRUE(str_1->actual.hash_cached);
+  EXPECT_EQ(PblGetStringHash(str_1), PblHashBytes("hello world", 11));
+
+  // Writing to the string invalidates the hash
+  uint64_t old_hash = PblGetStringHash(str_1);
+  PblWriteStringToStringT(str_1, PblGetStringT("hello x"), PblGetUIntT(7));
+  EXPECT_FALSE(str_1->actual.hash_cached);
+  EXPECT_NE(PblGetStringHash(str_1), old_hash);
+  EXPECT_FALSE(PblStringEquals(str_1, str_2));
+
+  // Resizing truncates the content and invalidates the hash as well
+  PblGetStringHash(str_2);
+  PblResizeStringT(str_2, PblGetUIntT(5));
+  EXPECT_FALSE(str_2->actual.hash_cached);
+  EXPECT_STREQ(PblGetStringBytes(str_2), "hello");
+  EXPECT_EQ(PblGetStringHash(str_2), PblHashBytes("hello", 5));
+
+  // Direct writes to 'str' are picked up once the string is notified
+  PBL_ASSIGN_TO_VAR(str_2->actual.str[0], PblChar_T, 'j');
+  PblStringContentChanged(str_2);
+  EXPECT_FALSE(str_2->actual.hash_cached);
+  EXPECT_EQ(str_2->actual.utf8_state, PBL_STRING_UTF8_UNKNOWN);
+  EXPECT_STREQ(PblGetStringBytes(str_2), "jello");
+  EXPECT_EQ(PblGetStringHash(str_2), PblHashBytes("jello", 5));
+}
+
+TEST(StringTypesTest, PblGetStringBytes) {
+  PblString_T *str = PblGetStringT("hello");
+  EXPECT_STREQ(PblGetStringBytes(str), "hello");
+
+  // The byte copy follows re-allocations of the string
+  PblWriteCharArrayToStringT(str, PblGetCharTArray("12345678901234567890123456789012345678901234567890123"),
+                             PblGetUIntT(53));
+  EXPECT_EQ(str->actual.allocated_len->actual, 101);
+  EXPECT_STREQ(PblGetStringBytes(str), "12345678901234567890123456789012345678901234567890123");
+}
+
+TEST(StringTypesTest, PblInternCString) {
+  PblString_T *str_1 = PblInternCString("intern-test");
+  PblString_T *str_2 = PblInternCString("intern-test");
+  PblString_T *str_3 = PblInternCString("intern-test-2");
+
+  EXPECT_EQ(str_1, str_2);
+  EXPECT_NE(str_1, str_3);
+  EXPECT_TRUE(str_1->actual.interned);
+  EXPECT_TRUE(str_1->actual.hash_cached);
+  EXPECT_STREQ(PblGetStringBytes(str_1), "intern-test");
+  EXPECT_FALSE(PblStringEquals(str_1, str_3));
+
+  // De-allocating interned strings is ignored, as they are owned by the table
+  PblDeallocateStringT(str_1);
+  EXPECT_TRUE(str_1->meta.defined);
+  EXPECT_EQ(PblInternCString("intern-test"), str_1);
+}
+
+TEST(StringTypesTest, PblInternString) {
+  PblString_T *str = PblGetStringT("intern-string-test");
+  PblString_T *interned = PblInternString(str);
+
+  EXPECT_NE(str, interned);
+  EXPECT_FALSE(str->actual.interned);
+  EXPECT_TRUE(PblStringEquals(str, interned));
+  EXPECT_EQ(PblInternString(interned), interned);
+  EXPECT_EQ(PblInternCString("intern-string-test"), interned);
+}
+
+TEST(StringTypesTest, PblInternedStringsAreImmutable) {
+  // Interned strings are shared by every user, meaning any write to them aborts
+  PblString_T *interned = PblInternCString("intern-immutable-test");
+  EXPECT_DEATH(PblResizeStringT(interned, PblGetUIntT(100)), "");
+  EXPECT_DEATH(PblWriteCharArrayToStringT(interned, PblGetCharTArray("other"), PblGetUIntT(5)), "");
+  EXPECT_DEATH(PblWriteStringToStringT(interned, PblGetStringT("other"), PblGetUIntT(5)), "");
+  EXPECT_STREQ(PblGetStringBytes(interned), "intern-immutable-test");
+}
+
+TEST(StringTypesTest, PblInternTableGrowth) {
+  // Forcing the table to grow multiple times, while previous entries stay canonical
+  PblString_T *first = PblInternCString("growth-0");
+  char buffer[32];
+  for (int i = 0; i < 2000; i++) {
+    snprintf(buffer, sizeof(buffer), "growth-%d", i);
+    EXPECT_STREQ(PblGetStringBytes(PblInternCString(buffer)), buffer);
+  }
+  EXPECT_EQ(PblInternCString("growth-0"), first);
+  EXPECT_EQ(PblInternCString("growth-1999"), PblInternCString("growth-1999"));
+}
+
+TEST(StringSearchTest, PblStringFind) {
+  PblString_T *str = PblGetStringT("the quick brown fox jumps over the lazy dog");
+
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("the")), 0);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("fox")), 16);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("g")), 42);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("")), 0);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("cat")), PBL_STRING_NOT_FOUND);
+  EXPECT_EQ(PblStringFind(PblGetStringT("ab"), PblGetStringT("abc")), PBL_STRING_NOT_FOUND);
+}
+
+TEST(StringSearchTest, PblStringFindLongHaystack) {
+  // Creating a haystack that spans many SIMD blocks with a match at the very end
+  std::string content(5000, 'a');
+  content += "needle";
+  PblString_T *str = PblGetStringT(content.c_str());
+
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("needle")), 5000);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("aneedle")), 4999);
+  EXPECT_EQ(PblStringFind(str, PblGetStringT("needles")), PBL_STRING_NOT_FOUND);
+
+  // Long needle, which uses the Two-Way algorithm
+  std::string long_needle(100, 'a');
+  long_needle += "needle";
+  EXPECT_EQ(PblStringFind(str, PblGetStringT(long_needle.c_str())), 4900);
+  long_needle[0] = 'b';
+  EXPECT_EQ(PblStringFind(str, PblGetStringT(long_needle.c_str())), PBL_STRING_NOT_FOUND);
+}
+
+TEST(StringSearchTest, LongNeedles) {
+  // Small alphabet with periodic and non-periodic needles, which are searched using the Two-Way algorithm
+  std::mt19937 random(42);
+  for (int round = 0; round < 200; round++) {
+    std::string content;
+    for (int i = 0; i < 2000; i++) content += (char) ('a' + random() % 2);
+    std::string needle;
+    if (round % 2 == 0) needle = content.substr(random() % 1900, 65 + random() % 35);
+    else
+      for (int i = 0; i < 66; i++) needle += (i % 3 == 2) ? 'b' : 'a';
+    PblString_T *str = PblGetStringT(content.c_str());
+    PblString_T *needle_str = PblGetStringT(needle.c_str());
+
+    size_t first = content.find(needle);
+    size_t last = content.rfind(needle);
+    EXPECT_EQ(PblStringFind(str, needle_str), first == std::string::npos ? PBL_STRING_NOT_FOUND : first);
+    EXPECT_EQ(PblStringFindLast(str, needle_str), last == std::string::npos ? PBL_STRING_NOT_FOUND : last);
+
+    size_t count = 0;
+    for (size_t pos = content.find(needle); pos != std::string::npos; pos = content.find(needle, pos + needle.size()))
+      count++;
+    EXPECT_EQ(PblStringCount(str, needle_str), count);
+  }
+}
+
+TEST(StringSearchTest, PblStringFindLast) {
+  PblString_T *str = PblGetStringT("abc-abc-abc-xyz-xyz-xyz-xyz-xyz-xyz-xyz-xyz-xyz");
+
+  EXPECT_EQ(PblStringFindLast(str, PblGetStringT("abc")), 8);
+  EXPECT_EQ(PblStringFindLast(str, PblGetStringT("-")), 43);
+  EXPECT_EQ(PblStringFindLast(str, PblGetStringT("xyz")), 44);
+  EXPECT_EQ(PblStringFindLast(str, PblGetStringT("")), 47);
+  EXPECT_EQ(PblStringFindLast(str, PblGetStringT("abd")), PBL_STRING_NOT_FOUND);
+}
+
+TEST(StringSearchTest, PblStringContainsAndCount) {
+  PblString_T *str = PblGetStringT("aaaa-bb-aaaa-bb-aaaa-bb-aaaa-bb-aaaa-bb-aaaa");
+
+  EXPECT_TRUE(PblStringContains(str, PblGetStringT("bb-a")));
+  EXPECT_FALSE(PblStringContains(str, PblGetStringT("bbb")));
+  EXPECT_EQ(PblStringCount(str, PblGetStringT("bb")), 5);
+  // Occurrences are counted non-overlapping
+  EXPECT_EQ(PblStringCount(str, PblGetStringT("aa")), 12);
+  EXPECT_EQ(PblStringCount(str, PblGetStringT("c")), 0);
+  EXPECT_EQ(PblStringCount(PblGetStringT("abc"), PblGetStringT("")), 4);
+}
+
+TEST(StringSearchTest, PblStringFindAnyOf) {
+  PblString_T *str = PblGetStringT("key_1=value;key_2=value;key_3=value;key_4=value;key_5=value");
+
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT("=;")), 5);
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT(";")), 11);
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT("54")), 40);
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT("!#$")), PBL_STRING_NOT_FOUND);
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT("")), PBL_STRING_NOT_FOUND);
+  // Char sets larger than 16 chars use a lookup table
+  EXPECT_EQ(PblStringFindAnyOf(str, PblGetStringT("ABCDEFGHIJKLMNOPQRSTUVWXYZ5")), 52);
+}
+
+/// @brief Collects all tokens of the iterator as std::string for easier comparison
+static std::vector<std::string> CollectTokens(PblStringSplitIter_T iter) {
+  std::vector<std::string> tokens;
+  PblStringView_T token;
+  while (PblStringSplitNext(&iter, &token)) tokens.emplace_back(token.actual.ptr, token.actual.len);
+  return tokens;
+}
+
+TEST(StringSplitTest, PblStringView) {
+  PblString_T *str = PblGetStringT("hello world");
+  PblStringView_T view = PblGetStringViewT(str);
+
+  EXPECT_EQ(PblStringView_T_Size, sizeof(const char *) + sizeof(size_t));
+  EXPECT_EQ(view.actual.ptr, PblGetStringBytes(str));
+  EXPECT_EQ(view.actual.len, 11);
+  EXPECT_TRUE(PblStringViewEquals(PblGetStringViewOfBytes(view.actual.ptr + 6, 5), PblGetStringViewOfCString("world")));
+  EXPECT_FALSE(PblStringViewEquals(view, PblGetStringViewOfCString("hello")));
+
+  PblString_T *copy = PblGetStringTFromView(PblGetStringViewOfBytes(view.actual.ptr, 5));
+  EXPECT_TRUE(PblStringEquals(copy, PblGetStringT("hello")));
+  EXPECT_EQ(copy->actual.allocated_len->actual, 51);
+}
+
+TEST(StringSplitTest, PblStringSplit) {
+  PblString_T *line = PblGetStringT("id,,name,value");
+
+  EXPECT_EQ(CollectTokens(PblStringSplit(PblGetStringViewT(line), PblGetStringViewOfCString(","))),
+            std::vector<std::string>({"id", "", "name", "value"}));
+  EXPECT_EQ(CollectTokens(PblStringSplit(PblGetStringViewOfCString("a::b::"), PblGetStringViewOfCString("::"))),
+            std::vector<std::string>({"a", "b", ""}));
+  EXPECT_EQ(CollectTokens(PblStringSplit(PblGetStringViewOfCString(""), PblGetStringViewOfCString(","))),
+            std::vector<std::string>({""}));
+  EXPECT_EQ(CollectTokens(PblStringSplit(PblGetStringViewT(line), PblGetStringViewOfCString(""))),
+            std::vector<std::string>({"id,,name,value"}));
+}
+
+TEST(StringSplitTest, PblStringSplitWhitespace) {
+  EXPECT_EQ(CollectTokens(PblStringSplitWhitespace(PblGetStringViewOfCString("  GET\t/index.html \r\n HTTP/1.1\n"))),
+            std::vector<std::string>({"GET", "/index.html", "HTTP/1.1"}));
+  EXPECT_EQ(CollectTokens(PblStringSplitWhitespace(PblGetStringViewOfCString(" \t\n "))), std::vector<std::string>());
+}
+
+TEST(StringSplitTest, PblStringSplitAnyOf) {
+  PblStringView_T source = PblGetStringViewOfCString("a=1;b=2;;c");
+
+  EXPECT_EQ(CollectTokens(PblStringSplitAnyOf(source, PblGetStringViewOfCString("=;"))),
+            std::vector<std::string>({"a", "1", "b", "2", "", "c"}));
+}
+
+TEST(StringSplitTest, PblStringJoin) {
+  PblString_T *parts[] = {PblGetStringT("id"), PblGetStringT(""), PblGetStringT("name")};
+
+  PblString_T *joined = PblStringJoin(parts, 3, PblGetStringT(", "));
+  EXPECT_EQ(std::string(PblGetStringBytes(joined)), "id, , name");
+  EXPECT_EQ(joined->actual.len->actual, 10);
+  EXPECT_EQ(joined->actual.str[3].actual, ' ');
+  EXPECT_EQ(PblStringJoin(parts, 0, PblGetStringT(","))->actual.len->actual, 0);
+
+  // Splitting and joining again should result in the original content
+  PblStringView_T tokens[4];
+  size_t amount = 0;
+  PblStringSplitIter_T iter = PblStringSplit(PblGetStringViewOfCString("a|bb||ccc"), PblGetStringViewOfCString("|"));
+  while (PblStringSplitNext(&iter, &tokens[amount])) amount++;
+  EXPECT_EQ(amount, 4);
+  EXPECT_EQ(std::string(PblGetStringBytes(PblStringJoinViews(tokens, amount, PblGetStringViewOfCString("|")))),
+            "a|bb||ccc");
+}
+
+TEST(StringUnicodeTest, PblValidateUtf8) {
+  EXPECT_TRUE(PblValidateUtf8("", 0));
+  EXPECT_TRUE(PblValidateUtf8("hello world", 11));
+  EXPECT_TRUE(PblValidateUtf8("gr\xC3\xBC\xC3\x9F" "e \xE2\x82\xAC \xF0\x9F\x98\x80", 16));
+  // Truncated sequence, lone continuation byte, overlong encoding, surrogate and codepoint above U+10FFFF
+  EXPECT_FALSE(PblValidateUtf8("abc\xE2\x82", 5));
+  EXPECT_FALSE(PblValidateUtf8("abc\x80", 4));
+  EXPECT_FALSE(PblValidateUtf8("\xC0\xAF", 2));
+  EXPECT_FALSE(PblValidateUtf8("\xED\xA0\x80", 3));
+  EXPECT_FALSE(PblValidateUtf8("\xF4\x90\x80\x80", 4));
+
+  // Sequences crossing the SIMD block boundaries
+  std::string long_text;
+  for (int i = 0; i < 100; i++) long_text += "a\xE2\x82\xAC\xF0\x9F\x98\x80";
+  EXPECT_TRUE(PblValidateUtf8(long_text.data(), long_text.size()));
+  long_text[long_text.size() - 37] = '\xFF';
+  EXPECT_FALSE(PblValidateUtf8(long_text.data(), long_text.size()));
+}
+
+TEST(StringUnicodeTest, PblStringIsValidUtf8AndAscii) {
+  PblString_T *ascii = PblGetStringT("hello world");
+  PblString_T *unicode = PblGetStringT("h\xC3\xA9llo w\xC3\xB6rld");
+  PblString_T *invalid = PblGetStringT("h\xC3llo");
+
+  EXPECT_TRUE(PblStringIsAscii(ascii));
+  EXPECT_TRUE(PblStringIsValidUtf8(ascii));
+  EXPECT_EQ(ascii->actual.utf8_state, PBL_STRING_UTF8_ASCII);
+  EXPECT_FALSE(PblStringIsAscii(unicode));
+  EXPECT_TRUE(PblStringIsValidUtf8(unicode));
+  EXPECT_EQ(unicode->actual.utf8_state, PBL_STRING_UTF8_VALID);
+  EXPECT_FALSE(PblStringIsValidUtf8(invalid));
+
+  // Writing resets the cached state
+  PblWriteStringToStringT(ascii, unicode, unicode->actual.len);
+  EXPECT_EQ(ascii->actual.utf8_state, PBL_STRING_UTF8_UNKNOWN);
+  EXPECT_FALSE(PblStringIsAscii(ascii));
+}
+
+TEST(StringUnicodeTest, PblStringCodepointLen) {
+  EXPECT_EQ(PblStringCodepointLen(PblGetStringT("hello")), 5);
+  EXPECT_EQ(PblStringCodepointLen(PblGetStringT("gr\xC3\xBC\xC3\x9F" "e \xE2\x82\xAC \xF0\x9F\x98\x80")), 9);
+  // Every invalid byte is counted as one replacement char
+  EXPECT_EQ(PblStringCodepointLen(PblGetStringT("a\x80\x80" "b")), 4);
+}
+
+TEST(StringUnicodeTest, PblCodepointIter) {
+  PblCodepointIter_T iter = PblStringCodepoints(PblGetStringViewOfCString("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xFF"));
+  std::vector<uint32_t> codepoints;
+  uint32_t codepoint;
+  while (PblCodepointIterNext(&iter, &codepoint)) codepoints.push_back(codepoint);
+
+  EXPECT_EQ(codepoints, std::vector<uint32_t>({0x61, 0xE9, 0x20AC, 0x1F600, PBL_UNICODE_REPLACEMENT_CHAR}));
+}